@@ -0,0 +1,153 @@
+#include <stdexcept>
+
+namespace lasd {
+
+/* ************************************************************************** */
+/* Shared state */
+
+inline std::atomic<unsigned long> Epoch::global{0};
+inline Epoch::Record Epoch::records[Epoch::MaxThreads];
+inline Epoch::Orphans Epoch::orphans;
+
+/* ************************************************************************** */
+/* Limbo lists */
+
+inline void Epoch::Limbo::Push(const Retired& item) {
+  if (count == items.Size()) {
+    items.Resize(count == 0 ? 16 : count * 2);
+  }
+  items[count++] = item;
+}
+
+inline void Epoch::Limbo::Free() noexcept {
+  for (unsigned long i = 0; i < count; ++i) {
+    items[i].deleter(items[i].ptr);
+  }
+  count = 0;
+}
+
+/* ************************************************************************** */
+/* Thread state */
+
+inline Epoch::ThreadState::ThreadState() {
+  for (slot = 0; slot < MaxThreads; ++slot) {
+    bool expected = false;
+    if (!records[slot].used.load(std::memory_order_relaxed) &&
+        records[slot].used.compare_exchange_strong(expected, true)) {
+      record = &records[slot];
+      return;
+    }
+  }
+  throw std::length_error("Too many threads for the epoch domain");
+}
+
+inline Epoch::ThreadState::~ThreadState() {
+  std::lock_guard<std::mutex> lock(orphans.mutex);
+  for (Limbo& list : limbo) {
+    for (unsigned long i = 0; i < list.count; ++i) {
+      Retired item = list.items[i];
+      item.epoch = list.epoch;
+      orphans.list.Push(item);
+    }
+    list.count = 0;
+  }
+  record->local.store(Idle);
+  record->used.store(false);
+}
+
+inline Epoch::Orphans::~Orphans() {
+  list.Free(); // Program exit: no thread is left inside a guard
+}
+
+/* ************************************************************************** */
+/* Epoch functions */
+
+inline Epoch::ThreadState& Epoch::State() {
+  thread_local ThreadState state;
+  return state;
+}
+
+inline unsigned long Epoch::ThreadSlot() {
+  return State().slot;
+}
+
+inline void Epoch::Enter() {
+  ThreadState& state = State();
+  if (state.depth++ > 0) return;
+
+  // Publish the epoch, then make sure it did not move meanwhile: otherwise
+  // two advances could slip in before the store and free what we are about to read
+  unsigned long epoch = global.load();
+  while (true) {
+    state.record->local.store(epoch);
+    unsigned long now = global.load();
+    if (now == epoch) break;
+    epoch = now;
+  }
+
+  if (epoch != state.lastEpoch) {
+    for (Limbo& list : state.limbo) {
+      if (list.count > 0 && list.epoch + 2 <= epoch) list.Free();
+    }
+    state.lastEpoch = epoch;
+  }
+}
+
+inline void Epoch::Leave() noexcept {
+  ThreadState& state = State();
+  if (--state.depth == 0) {
+    state.record->local.store(Idle, std::memory_order_release);
+  }
+}
+
+template <typename Type>
+void Epoch::Retire(Type* ptr) {
+  Retire(ptr, [](void* raw) { delete static_cast<Type*>(raw); });
+}
+
+inline void Epoch::Retire(void* ptr, void (*deleter)(void*)) {
+  ThreadState& state = State();
+  // Tag with the global epoch, not ours: a reader may have entered the next one
+  // while the node was still linked
+  unsigned long epoch = global.load();
+  Limbo& list = state.limbo[epoch % 3];
+  if (list.count > 0 && list.epoch != epoch) list.Free(); // Three epochs old at least
+  list.epoch = epoch;
+  list.Push(Retired{ptr, deleter, 0});
+  if (++state.sinceAdvance >= AdvanceEvery) {
+    state.sinceAdvance = 0;
+    TryAdvance();
+  }
+}
+
+inline void Epoch::TryAdvance() noexcept {
+  unsigned long epoch = global.load();
+  for (Record& rec : records) {
+    if (rec.used.load(std::memory_order_relaxed)) {
+      unsigned long local = rec.local.load();
+      if (local != Idle && local != epoch) return; // Someone still runs in an older epoch
+    }
+  }
+  global.compare_exchange_strong(epoch, epoch + 1);
+  FreeOrphans(epoch + 1);
+}
+
+inline void Epoch::FreeOrphans(unsigned long now) noexcept {
+  std::unique_lock<std::mutex> lock(orphans.mutex, std::try_to_lock);
+  if (!lock.owns_lock() || orphans.list.count == 0) return;
+
+  Limbo& list = orphans.list;
+  unsigned long kept = 0;
+  for (unsigned long i = 0; i < list.count; ++i) {
+    if (list.items[i].epoch + 2 <= now) {
+      list.items[i].deleter(list.items[i].ptr);
+    } else {
+      list.items[kept++] = list.items[i];
+    }
+  }
+  list.count = kept;
+}
+
+/* ************************************************************************** */
+
+}
@@ -0,0 +1,122 @@
+#ifndef EPOCH_HPP
+#define EPOCH_HPP
+
+/* ************************************************************************** */
+
+#include "../vector/vector.hpp"
+#include <atomic>
+#include <mutex>
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Epoch-based reclamation shared by the lock-free containers.
+// Threads read shared nodes only inside a Guard. An unlinked node is retired
+// rather than deleted, tagged with the global epoch of that moment, and is
+// freed once the global epoch has moved two steps past the tag: every guard
+// that could have reached it has ended by then.
+class Epoch {
+
+private:
+
+  static constexpr unsigned long MaxThreads = 256;
+  static constexpr unsigned long Idle = ~0UL;
+  static constexpr unsigned long AdvanceEvery = 64; // Retirements between attempts to advance
+
+  struct alignas(64) Record {
+
+    std::atomic<unsigned long> local{Idle}; // Epoch of the running guard, or Idle
+    std::atomic<bool> used{false};
+
+  };
+
+  struct Retired {
+
+    void* ptr = nullptr;
+    void (*deleter)(void*) = nullptr;
+    unsigned long epoch = 0; // Only for the orphans of exited threads
+
+    bool operator==(const Retired&) const = default; // Needed by Vector
+
+  };
+
+  struct Limbo {
+
+    Vector<Retired> items;
+    unsigned long count = 0;
+    unsigned long epoch = 0; // Tag shared by every pending item
+
+    void Push(const Retired&);
+    void Free() noexcept;
+
+  };
+
+  // Per-thread state: the record slot and one limbo list per tag modulo 3
+  struct ThreadState {
+
+    Record* record = nullptr;
+    unsigned long slot = 0;
+    unsigned long depth = 0;
+    unsigned long lastEpoch = 0;
+    unsigned long sinceAdvance = 0;
+    Limbo limbo[3];
+
+    ThreadState();
+    ~ThreadState(); // Hands the pending nodes to the orphan list
+
+  };
+
+  struct Orphans {
+
+    std::mutex mutex;
+    Limbo list;
+
+    ~Orphans();
+
+  };
+
+  static std::atomic<unsigned long> global;
+  static Record records[MaxThreads];
+  static Orphans orphans;
+
+  static ThreadState& State();
+  static void TryAdvance() noexcept;
+  static void FreeOrphans(unsigned long) noexcept;
+
+public:
+
+  // Scope of a read or update of shared nodes (nesting is allowed)
+  class Guard {
+
+  public:
+
+    Guard() { Epoch::Enter(); }
+    ~Guard() { Epoch::Leave(); }
+
+    Guard(const Guard&) = delete;
+    Guard& operator=(const Guard&) = delete;
+
+  };
+
+  static void Enter();
+  static void Leave() noexcept;
+
+  // Deletes the object as soon as no guard can reach it (call inside a guard, after unlinking it)
+  template <typename Type>
+  static void Retire(Type*);
+  static void Retire(void*, void (*)(void*));
+
+  static unsigned long ThreadSlot(); // Small, stable index of the calling thread
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "epoch.cpp"
+
+#endif
@@ -0,0 +1,214 @@
+#include <bit>
+#include <utility>
+
+namespace lasd {
+
+/* ************************************************************************** */
+/* Constructors */
+
+template <typename Data, typename Impl, typename Hash>
+ShardedDictionary<Data, Impl, Hash>::ShardedDictionary(unsigned long shardCount) {
+  count = std::bit_ceil(shardCount == 0 ? 1UL : shardCount);
+  shift = 64 - std::countr_zero(count);
+  shards = new Shard[count];
+}
+
+template <typename Data, typename Impl, typename Hash>
+ShardedDictionary<Data, Impl, Hash>::ShardedDictionary(const TraversableContainer<Data>& container, unsigned long shardCount)
+    : ShardedDictionary(shardCount) {
+  InsertAll(container);
+}
+
+template <typename Data, typename Impl, typename Hash>
+ShardedDictionary<Data, Impl, Hash>::ShardedDictionary(MappableContainer<Data>&& container, unsigned long shardCount)
+    : ShardedDictionary(shardCount) {
+  InsertAll(std::move(container));
+}
+
+/* ************************************************************************** */
+/* Destructor */
+
+template <typename Data, typename Impl, typename Hash>
+ShardedDictionary<Data, Impl, Hash>::~ShardedDictionary() {
+  delete[] shards;
+}
+
+/* ************************************************************************** */
+/* Container functions */
+
+template <typename Data, typename Impl, typename Hash>
+bool ShardedDictionary<Data, Impl, Hash>::Empty() const noexcept {
+  for (unsigned long i = 0; i < count; ++i) {
+    std::lock_guard<std::mutex> lock(shards[i].mutex);
+    if (!shards[i].set.Empty()) return false;
+  }
+  return true;
+}
+
+template <typename Data, typename Impl, typename Hash>
+unsigned long ShardedDictionary<Data, Impl, Hash>::Size() const noexcept {
+  unsigned long total = 0;
+  for (unsigned long i = 0; i < count; ++i) {
+    std::lock_guard<std::mutex> lock(shards[i].mutex);
+    total += shards[i].set.Size();
+  }
+  return total;
+}
+
+/* ************************************************************************** */
+/* Dictionary functions */
+
+template <typename Data, typename Impl, typename Hash>
+bool ShardedDictionary<Data, Impl, Hash>::Insert(const Data& dat) {
+  Shard& shard = shards[ShardOf(dat)];
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  return shard.set.Insert(dat);
+}
+
+template <typename Data, typename Impl, typename Hash>
+bool ShardedDictionary<Data, Impl, Hash>::Insert(Data&& dat) {
+  Shard& shard = shards[ShardOf(dat)];
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  return shard.set.Insert(std::move(dat));
+}
+
+template <typename Data, typename Impl, typename Hash>
+bool ShardedDictionary<Data, Impl, Hash>::Remove(const Data& dat) {
+  Shard& shard = shards[ShardOf(dat)];
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  return shard.set.Remove(dat);
+}
+
+template <typename Data, typename Impl, typename Hash>
+bool ShardedDictionary<Data, Impl, Hash>::InsertAll(const TraversableContainer<Data>& container) {
+  return Batched([&container](auto push) { container.Traverse([&push](const Data& dat) { push(dat); }); },
+                 [](Impl& set, Vector<Data>& batch) { return set.InsertAll(std::move(batch)); }, true);
+}
+
+template <typename Data, typename Impl, typename Hash>
+bool ShardedDictionary<Data, Impl, Hash>::InsertAll(MappableContainer<Data>&& container) {
+  return Batched([&container](auto push) { container.Map([&push](Data& dat) { push(std::move(dat)); }); },
+                 [](Impl& set, Vector<Data>& batch) { return set.InsertAll(std::move(batch)); }, true);
+}
+
+template <typename Data, typename Impl, typename Hash>
+bool ShardedDictionary<Data, Impl, Hash>::RemoveAll(const TraversableContainer<Data>& container) {
+  return Batched([&container](auto push) { container.Traverse([&push](const Data& dat) { push(dat); }); },
+                 [](Impl& set, Vector<Data>& batch) { return set.RemoveAll(batch); }, true);
+}
+
+template <typename Data, typename Impl, typename Hash>
+bool ShardedDictionary<Data, Impl, Hash>::InsertSome(const TraversableContainer<Data>& container) {
+  return Batched([&container](auto push) { container.Traverse([&push](const Data& dat) { push(dat); }); },
+                 [](Impl& set, Vector<Data>& batch) { return set.InsertSome(std::move(batch)); }, false);
+}
+
+template <typename Data, typename Impl, typename Hash>
+bool ShardedDictionary<Data, Impl, Hash>::InsertSome(MappableContainer<Data>&& container) {
+  return Batched([&container](auto push) { container.Map([&push](Data& dat) { push(std::move(dat)); }); },
+                 [](Impl& set, Vector<Data>& batch) { return set.InsertSome(std::move(batch)); }, false);
+}
+
+template <typename Data, typename Impl, typename Hash>
+bool ShardedDictionary<Data, Impl, Hash>::RemoveSome(const TraversableContainer<Data>& container) {
+  return Batched([&container](auto push) { container.Traverse([&push](const Data& dat) { push(dat); }); },
+                 [](Impl& set, Vector<Data>& batch) { return set.RemoveSome(batch); }, false);
+}
+
+template <typename Data, typename Impl, typename Hash>
+template <ForeignInputRange<Data> Range>
+bool ShardedDictionary<Data, Impl, Hash>::InsertAll(Range&& range) {
+  return Batched([&range](auto push) { for (auto&& dat : range) push(std::forward<decltype(dat)>(dat)); },
+                 [](Impl& set, Vector<Data>& batch) { return set.InsertAll(std::move(batch)); }, true);
+}
+
+template <typename Data, typename Impl, typename Hash>
+template <ForeignInputRange<Data> Range>
+bool ShardedDictionary<Data, Impl, Hash>::InsertSome(Range&& range) {
+  return Batched([&range](auto push) { for (auto&& dat : range) push(std::forward<decltype(dat)>(dat)); },
+                 [](Impl& set, Vector<Data>& batch) { return set.InsertSome(std::move(batch)); }, false);
+}
+
+/* ************************************************************************** */
+/* TraversableContainer function */
+
+template <typename Data, typename Impl, typename Hash>
+void ShardedDictionary<Data, Impl, Hash>::Traverse(TraverseFun fun) const {
+  for (unsigned long i = 0; i < count; ++i) {
+    std::lock_guard<std::mutex> lock(shards[i].mutex);
+    shards[i].set.Traverse(fun);
+  }
+}
+
+/* ************************************************************************** */
+/* TestableContainer function */
+
+template <typename Data, typename Impl, typename Hash>
+bool ShardedDictionary<Data, Impl, Hash>::Exists(const Data& dat) const noexcept {
+  const Shard& shard = shards[ShardOf(dat)];
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  return shard.set.Exists(dat);
+}
+
+/* ************************************************************************** */
+/* ClearableContainer function */
+
+template <typename Data, typename Impl, typename Hash>
+void ShardedDictionary<Data, Impl, Hash>::Clear() {
+  for (unsigned long i = 0; i < count; ++i) {
+    std::lock_guard<std::mutex> lock(shards[i].mutex);
+    shards[i].set.Clear();
+  }
+}
+
+/* ************************************************************************** */
+
+// Auxiliary functions
+
+template <typename Data, typename Impl, typename Hash>
+unsigned long ShardedDictionary<Data, Impl, Hash>::ShardOf(const Data& dat) const noexcept {
+  if (count == 1) return 0;
+  // A mix of its own (the MurmurHash3 finalizer): SetHash picks its home slot
+  // from the top bits of the hash times 0x9E3779B97F4A7C15, so choosing the
+  // shard from those same bits would leave each table a fraction of its slots
+  std::uint64_t mix = static_cast<std::uint64_t>(hasher(dat));
+  mix ^= mix >> 33;
+  mix *= 0xFF51AFD7ED558CCDULL;
+  mix ^= mix >> 33;
+  mix *= 0xC4CEB9FE1A85EC53ULL;
+  mix ^= mix >> 33;
+  return mix >> shift;
+}
+
+template <typename Data, typename Impl, typename Hash>
+template <typename Fill, typename Apply>
+bool ShardedDictionary<Data, Impl, Hash>::Batched(Fill fill, Apply apply, bool all) {
+  // Partition outside the locks
+  Vector<Vector<Data>> batches(count);
+  Vector<unsigned long> used(count);
+  fill([this, &batches, &used](auto&& dat) {
+    unsigned long index = ShardOf(dat);
+    Vector<Data>& batch = batches[index];
+    if (used[index] == batch.Size()) {
+      batch.Resize(used[index] == 0 ? 16 : used[index] * 2);
+    }
+    batch[used[index]++] = std::forward<decltype(dat)>(dat);
+  });
+
+  bool result = all;
+  for (unsigned long i = 0; i < count; ++i) {
+    if (used[i] == 0) continue;
+    batches[i].Resize(used[i]);
+    bool done;
+    {
+      std::lock_guard<std::mutex> lock(shards[i].mutex);
+      done = apply(shards[i].set, batches[i]);
+    }
+    result = all ? (result && done) : (result || done);
+  }
+  return result;
+}
+
+/* ************************************************************************** */
+
+}
@@ -0,0 +1,157 @@
+#ifndef SHARDEDDICTIONARY_HPP
+#define SHARDEDDICTIONARY_HPP
+
+/* ************************************************************************** */
+
+#include "../../container/dictionary.hpp"
+#include "../../container/traversable.hpp"
+#include "../../vector/vector.hpp"
+#include <cstdint>
+#include <functional>
+#include <mutex>
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Thread-safe dictionary made of independent shards of an existing one
+// (Impl: SetVec<Data>, SetLst<Data>, SetHash<Data>, ...). A value always
+// lives in the shard picked by its hash, and each shard has its own lock on
+// its own cache line, so threads working on different shards never wait for
+// each other. Single-value operations lock one shard; the bulk ones split the
+// input per shard first and take each lock once.
+template <typename Data, typename Impl, typename Hash = std::hash<Data>>
+class ShardedDictionary : public virtual DictionaryContainer<Data>,
+                          public virtual TraversableContainer<Data>,
+                          public virtual ClearableContainer {
+  // Must extend DictionaryContainer<Data>,
+  //             TraversableContainer<Data>,
+  //             ClearableContainer
+
+private:
+
+  static constexpr unsigned long DefaultShards = 16;
+
+  struct alignas(64) Shard {
+
+    mutable std::mutex mutex;
+    Impl set;
+
+  };
+
+  Shard* shards = nullptr;
+  unsigned long count = 0;  // A power of two
+  unsigned int shift = 64;  // The shard is the top bits of the mixed hash
+
+  [[no_unique_address]] Hash hasher{};
+
+public:
+
+  // Default constructor
+  explicit ShardedDictionary(unsigned long = DefaultShards); // Rounded up to a power of two
+
+  /* ************************************************************************ */
+
+  // Specific constructors
+  ShardedDictionary(const TraversableContainer<Data>&, unsigned long = DefaultShards); // Copy from TraversableContainer
+  ShardedDictionary(MappableContainer<Data>&&, unsigned long = DefaultShards);        // Move from MappableContainer
+
+  /* ************************************************************************ */
+
+  // Copy constructor
+  ShardedDictionary(const ShardedDictionary&) = delete;
+
+  // Move constructor
+  ShardedDictionary(ShardedDictionary&&) = delete;
+
+  /* ************************************************************************ */
+
+  // Destructor (no other thread may be using the dictionary)
+  ~ShardedDictionary();
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  ShardedDictionary& operator=(const ShardedDictionary&) = delete;
+
+  // Move assignment
+  ShardedDictionary& operator=(ShardedDictionary&&) = delete;
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from Container)
+
+  bool Empty() const noexcept override;
+  unsigned long Size() const noexcept override; // Locks the shards one at a time: a snapshot under concurrent updates
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from DictionaryContainer)
+
+  bool Insert(const Data&) override; // Copy
+  bool Insert(Data&&) override;      // Move
+  bool Remove(const Data&) override;
+
+  bool InsertAll(const TraversableContainer<Data>&) override;
+  bool InsertAll(MappableContainer<Data>&&) override;
+
+  bool RemoveAll(const TraversableContainer<Data>&) override;
+
+  bool InsertSome(const TraversableContainer<Data>&) override;
+  bool InsertSome(MappableContainer<Data>&&) override;
+
+  bool RemoveSome(const TraversableContainer<Data>&) override;
+
+  template <ForeignInputRange<Data> Range>
+  bool InsertAll(Range&&);
+  template <ForeignInputRange<Data> Range>
+  bool InsertSome(Range&&);
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from TraversableContainer)
+
+  using typename TraversableContainer<Data>::TraverseFun;
+  void Traverse(TraverseFun) const override; // Shard by shard, each under its lock
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from TestableContainer)
+
+  bool Exists(const Data&) const noexcept override;
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from ClearableContainer)
+
+  void Clear() override;
+
+  /* ************************************************************************ */
+
+  // Specific member function
+
+  unsigned long Shards() const noexcept { return count; }
+
+protected:
+
+  // Auxiliary functions, if necessary!
+
+  unsigned long ShardOf(const Data&) const noexcept;
+
+  // Splits the values pushed by fill into one exact-size batch per shard, then
+  // hands each non-empty batch to apply under its shard's lock. The results
+  // are and-ed (InsertAll, RemoveAll) or or-ed (InsertSome, RemoveSome).
+  template <typename Fill, typename Apply>
+  bool Batched(Fill, Apply, bool);
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "shardeddictionary.cpp"
+
+#endif
@@ -0,0 +1,284 @@
+#include <bit>
+#include <new>
+
+namespace lasd {
+
+/* ************************************************************************** */
+/* Constructor and destructor */
+
+template <typename Data>
+ConcurrentSetSkip<Data>::ConcurrentSetSkip() {
+  head = NewNode(Data{}, MaxLevel);
+}
+
+template <typename Data>
+ConcurrentSetSkip<Data>::~ConcurrentSetSkip() {
+  Clear();
+  DeleteNode(head);
+}
+
+/* ************************************************************************** */
+/* Specific member functions */
+
+template <typename Data>
+bool ConcurrentSetSkip<Data>::Insert(const Data& dat) {
+  Epoch::Guard guard;
+  Node* preds[MaxLevel];
+  Node* succs[MaxLevel];
+  Node* node = nullptr;
+
+  while (true) {
+    if (Find(dat, preds, succs)) {
+      if (node != nullptr) DeleteNode(node); // Never published
+      return false;
+    }
+    if (node == nullptr) node = NewNode(dat, RandomLevel());
+    for (unsigned int level = 0; level < node->height; ++level) {
+      node->Next()[level].store(Word(succs[level]), std::memory_order_relaxed);
+    }
+    // Linking level 0 is the linearization point
+    std::uintptr_t expected = Word(succs[0]);
+    if (preds[0]->Next()[0].compare_exchange_strong(expected, Word(node))) break;
+  }
+  AddSize(1);
+
+  unsigned int level = 1;
+  while (level < node->height && LinkLevel(node, level, dat, preds, succs)) ++level;
+
+  // A remover that ran while the upper levels were being linked may have
+  // missed one of them: unlink again before the node can be retired
+  if (Marked(node->Next()[0].load())) Find(dat, preds, succs);
+  Release(node); // Only now may a remover retire it
+  return true;
+}
+
+template <typename Data>
+bool ConcurrentSetSkip<Data>::Remove(const Data& dat) {
+  Epoch::Guard guard;
+  Node* preds[MaxLevel];
+  Node* succs[MaxLevel];
+
+  if (!Find(dat, preds, succs)) return false;
+  Node* victim = succs[0];
+
+  // Mark the upper levels top-down, then level 0: whoever marks it owns the removal
+  for (unsigned int level = victim->height - 1; level > 0; --level) {
+    std::uintptr_t link = victim->Next()[level].load();
+    while (!Marked(link) && !victim->Next()[level].compare_exchange_weak(link, link | 1)) {}
+  }
+  std::uintptr_t link = victim->Next()[0].load();
+  while (true) {
+    if (Marked(link)) return false; // Another thread removed it first
+    if (victim->Next()[0].compare_exchange_weak(link, link | 1)) break;
+  }
+
+  AddSize(-1);
+  Find(dat, preds, succs); // Unlinks it from every level
+  Release(victim); // Retired here, or by its inserter once it stops linking
+  return true;
+}
+
+template <typename Data>
+bool ConcurrentSetSkip<Data>::Exists(const Data& dat) const {
+  Epoch::Guard guard;
+  Node* pred;
+  Node* curr = Search(dat, pred);
+  return curr != nullptr && !(dat < curr->element);
+}
+
+template <typename Data>
+Data ConcurrentSetSkip<Data>::Min() const {
+  Epoch::Guard guard;
+  for (Node* curr = Ptr(head->Next()[0].load()); curr != nullptr; ) {
+    std::uintptr_t link = curr->Next()[0].load();
+    if (!Marked(link)) return curr->element;
+    curr = Ptr(link);
+  }
+  throw std::length_error("Empty set");
+}
+
+template <typename Data>
+Data ConcurrentSetSkip<Data>::Max() const {
+  Epoch::Guard guard;
+  Node* pred = head;
+  for (unsigned int level = MaxLevel; level > 0; --level) {
+    for (Node* curr = Ptr(pred->Next()[level - 1].load()); curr != nullptr; ) {
+      std::uintptr_t link = curr->Next()[level - 1].load();
+      if (!Marked(link)) pred = curr;
+      curr = Ptr(link);
+    }
+  }
+  if (pred == head) throw std::length_error("Empty set");
+  return pred->element;
+}
+
+template <typename Data>
+Data ConcurrentSetSkip<Data>::Predecessor(const Data& dat) const {
+  Epoch::Guard guard;
+  Node* pred;
+  Search(dat, pred);
+  if (pred == head) throw std::length_error("No predecessor");
+  return pred->element;
+}
+
+template <typename Data>
+Data ConcurrentSetSkip<Data>::Successor(const Data& dat) const {
+  Epoch::Guard guard;
+  Node* pred;
+  for (Node* curr = Search(dat, pred); curr != nullptr; ) {
+    std::uintptr_t link = curr->Next()[0].load();
+    if (!Marked(link) && dat < curr->element) return curr->element;
+    curr = Ptr(link);
+  }
+  throw std::length_error("No successor");
+}
+
+template <typename Data>
+unsigned long ConcurrentSetSkip<Data>::Size() const noexcept {
+  long total = 0;
+  for (const Counter& counter : counters) {
+    total += counter.value.load(std::memory_order_relaxed);
+  }
+  return (total > 0) ? static_cast<unsigned long>(total) : 0;
+}
+
+template <typename Data>
+void ConcurrentSetSkip<Data>::Traverse(std::function<void(const Data&)> fun) const {
+  Epoch::Guard guard;
+  for (Node* curr = Ptr(head->Next()[0].load()); curr != nullptr; ) {
+    std::uintptr_t link = curr->Next()[0].load();
+    if (!Marked(link)) fun(curr->element);
+    curr = Ptr(link);
+  }
+}
+
+template <typename Data>
+void ConcurrentSetSkip<Data>::Clear() {
+  Node* curr = Ptr(head->Next()[0].load());
+  while (curr != nullptr) {
+    Node* next = Ptr(curr->Next()[0].load());
+    DeleteNode(curr);
+    curr = next;
+  }
+  for (unsigned int level = 0; level < MaxLevel; ++level) {
+    head->Next()[level].store(0);
+  }
+  for (Counter& counter : counters) {
+    counter.value.store(0);
+  }
+}
+
+/* ************************************************************************** */
+
+// Auxiliary functions
+
+template <typename Data>
+typename ConcurrentSetSkip<Data>::Node* ConcurrentSetSkip<Data>::NewNode(const Data& dat, unsigned int height) {
+  // One allocation for the node and its links
+  void* raw = ::operator new(sizeof(Node) + height * sizeof(Link));
+  Node* node = new (raw) Node{dat, height};
+  for (unsigned int level = 0; level < height; ++level) {
+    new (node->Next() + level) Link(0);
+  }
+  return node;
+}
+
+template <typename Data>
+void ConcurrentSetSkip<Data>::DeleteNode(void* raw) noexcept {
+  Node* node = static_cast<Node*>(raw);
+  node->~Node(); // Links are trivially destructible
+  ::operator delete(raw);
+}
+
+template <typename Data>
+void ConcurrentSetSkip<Data>::Release(Node* node) {
+  if (node->owners.fetch_sub(1, std::memory_order_acq_rel) == 1) Epoch::Retire(node, DeleteNode);
+}
+
+template <typename Data>
+unsigned int ConcurrentSetSkip<Data>::RandomLevel() noexcept {
+  // Geometric with p = 1/2: one level per trailing one bit of a xorshift draw
+  thread_local std::uint64_t state = 0x9E3779B97F4A7C15ULL ^ reinterpret_cast<std::uintptr_t>(&state);
+  state ^= state << 13;
+  state ^= state >> 7;
+  state ^= state << 17;
+  unsigned int height = 1 + std::countr_one(state);
+  return (height < MaxLevel) ? height : MaxLevel;
+}
+
+template <typename Data>
+bool ConcurrentSetSkip<Data>::LinkLevel(Node* node, unsigned int level, const Data& dat, Node** preds, Node** succs) {
+  while (true) {
+    std::uintptr_t link = node->Next()[level].load();
+    if (Marked(link)) return false; // Already being removed: stop growing it
+    if (Ptr(link) != succs[level] && !node->Next()[level].compare_exchange_strong(link, Word(succs[level]))) continue;
+    std::uintptr_t expected = Word(succs[level]);
+    if (preds[level]->Next()[level].compare_exchange_strong(expected, Word(node))) return true;
+    Find(dat, preds, succs);
+    if (succs[0] != node) return false; // Removed meanwhile
+  }
+}
+
+template <typename Data>
+bool ConcurrentSetSkip<Data>::Find(const Data& dat, Node** preds, Node** succs) const {
+  while (true) {
+    Node* pred = head;
+    Node* curr = nullptr;
+    bool restart = false;
+    for (unsigned int level = MaxLevel; level > 0 && !restart; --level) {
+      const unsigned int lv = level - 1;
+      curr = Ptr(pred->Next()[lv].load());
+      while (curr != nullptr) {
+        std::uintptr_t link = curr->Next()[lv].load();
+        if (Marked(link)) {
+          // Deleted at this level: swing the predecessor past it
+          std::uintptr_t expected = Word(curr);
+          if (!pred->Next()[lv].compare_exchange_strong(expected, link & ~std::uintptr_t(1))) {
+            restart = true; // The predecessor changed or is being deleted too
+            break;
+          }
+          curr = Ptr(link);
+        } else if (curr->element < dat) {
+          pred = curr;
+          curr = Ptr(link);
+        } else {
+          break;
+        }
+      }
+      preds[lv] = pred;
+      succs[lv] = curr;
+    }
+    if (!restart) return curr != nullptr && !(dat < curr->element);
+  }
+}
+
+template <typename Data>
+typename ConcurrentSetSkip<Data>::Node* ConcurrentSetSkip<Data>::Search(const Data& dat, Node*& pred) const noexcept {
+  pred = head;
+  Node* curr = nullptr;
+  for (unsigned int level = MaxLevel; level > 0; --level) {
+    const unsigned int lv = level - 1;
+    curr = Ptr(pred->Next()[lv].load(std::memory_order_acquire));
+    while (curr != nullptr) {
+      std::uintptr_t link = curr->Next()[lv].load(std::memory_order_acquire);
+      if (Marked(link)) {
+        curr = Ptr(link); // Skip it, without helping
+      } else if (curr->element < dat) {
+        pred = curr;
+        curr = Ptr(link);
+      } else {
+        break;
+      }
+    }
+  }
+  return curr;
+}
+
+template <typename Data>
+void ConcurrentSetSkip<Data>::AddSize(long delta) noexcept {
+  counters[Epoch::ThreadSlot() % CounterStripes].value.fetch_add(delta, std::memory_order_relaxed);
+}
+
+/* ************************************************************************** */
+
+}
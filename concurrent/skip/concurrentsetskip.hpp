@@ -0,0 +1,142 @@
+#ifndef CONCURRENTSETSKIP_HPP
+#define CONCURRENTSETSKIP_HPP
+
+/* ************************************************************************** */
+
+#include "../epoch.hpp"
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Lock-free ordered set for many threads at once. Insert and Remove are
+// lock-free (a failed CAS means another thread made progress). Exists and the
+// ordered queries are lock-free too, and never write to the list: they skip
+// deleted nodes instead of helping unlink them. Unlinked nodes go to the epoch
+// domain (concurrent/epoch.hpp). Every operation opens a guard, and entering
+// one retries until it publishes a stable epoch, may run the deleters of the
+// thread's old retired nodes, and, on a thread's first use, throws
+// std::length_error once the domain has no free thread slot.
+//
+// It offers the queries of OrderedDictionaryContainer without deriving from
+// it. A const Data& into a shared node could dangle as soon as another thread
+// removes that node, so every query returns a copy. Size is a snapshot.
+template <typename Data>
+class ConcurrentSetSkip {
+
+private:
+
+  static constexpr unsigned int MaxLevel = 32;
+  static constexpr unsigned long CounterStripes = 16;
+
+  using Link = std::atomic<std::uintptr_t>; // Successor pointer, low bit set once the owner is deleted
+
+  struct alignas(Link) Node {
+
+    Data element{};
+    unsigned int height = 0;
+    std::atomic<unsigned int> owners{2}; // Inserter and remover: the last one to let go retires it
+
+    Link* Next() noexcept { return reinterpret_cast<Link*>(this + 1); } // Links follow the node in memory
+
+  };
+
+  Node* head = nullptr; // Sentinel with MaxLevel links
+
+  // Striped size counters: threads updating different stripes never share a line
+  struct alignas(64) Counter {
+
+    std::atomic<long> value{0};
+
+  };
+
+  Counter counters[CounterStripes];
+
+public:
+
+  // Default constructor
+  ConcurrentSetSkip();
+
+  /* ************************************************************************ */
+
+  // Copy constructor
+  ConcurrentSetSkip(const ConcurrentSetSkip&) = delete;
+
+  // Move constructor
+  ConcurrentSetSkip(ConcurrentSetSkip&&) = delete;
+
+  /* ************************************************************************ */
+
+  // Destructor (no other thread may be using the set)
+  ~ConcurrentSetSkip();
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  ConcurrentSetSkip& operator=(const ConcurrentSetSkip&) = delete;
+
+  // Move assignment
+  ConcurrentSetSkip& operator=(ConcurrentSetSkip&&) = delete;
+
+  /* ************************************************************************ */
+
+  // Specific member functions (thread-safe)
+
+  bool Insert(const Data&); // Lock-free
+  bool Remove(const Data&); // Lock-free
+  bool Exists(const Data&) const; // Lock-free
+
+  Data Min() const; // (must throw std::length_error when empty)
+  Data Max() const; // (must throw std::length_error when empty)
+  Data Predecessor(const Data&) const; // (must throw std::length_error when not found)
+  Data Successor(const Data&) const;   // (must throw std::length_error when not found)
+
+  bool Empty() const noexcept { return Size() == 0; }
+  unsigned long Size() const noexcept;
+
+  // Visits the values in ascending order; concurrent updates may or may not be seen
+  void Traverse(std::function<void(const Data&)>) const;
+
+  /* ************************************************************************ */
+
+  // Specific member function (not thread-safe)
+
+  void Clear();
+
+protected:
+
+  // Auxiliary functions, if necessary!
+
+  static Node* NewNode(const Data&, unsigned int);
+  static void DeleteNode(void*) noexcept;
+  static void Release(Node*); // Drops one owner, retiring the node after the last
+  static unsigned int RandomLevel() noexcept;
+
+  static Node* Ptr(std::uintptr_t word) noexcept { return reinterpret_cast<Node*>(word & ~std::uintptr_t(1)); }
+  static bool Marked(std::uintptr_t word) noexcept { return (word & 1) != 0; }
+  static std::uintptr_t Word(Node* node) noexcept { return reinterpret_cast<std::uintptr_t>(node); }
+
+  // Fills the neighbours of the value at every level, unlinking deleted nodes on the way
+  bool Find(const Data&, Node**, Node**) const;
+  bool LinkLevel(Node*, unsigned int, const Data&, Node**, Node**); // False once the node is being removed
+
+  // Last live node below the value at level 0, and the first live one not below it (read-only)
+  Node* Search(const Data&, Node*&) const noexcept;
+
+  void AddSize(long) noexcept;
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "concurrentsetskip.cpp"
+
+#endif
@@ -68,4 +68,42 @@ namespace lasd {
     
     /* ************************************************************************** */
     
+    template <typename Data>
+    template <ForeignInputRange<Data> Range>
+    bool DictionaryContainer<Data>::InsertAll(Range&& range) {
+      bool allInserted = true;
+      for (auto&& d : range) {
+        allInserted &= Insert(std::forward<decltype(d)>(d));
+      }
+      return allInserted;
+    }
+    
+    /* ************************************************************************** */
+    
+    template <typename Data>
+    template <ForeignInputRange<Data> Range>
+    bool DictionaryContainer<Data>::InsertSome(Range&& range) {
+      bool anyInserted = false;
+      for (auto&& d : range) {
+        anyInserted |= Insert(std::forward<decltype(d)>(d));
+      }
+      return anyInserted;
+    }
+    
+    /* ************************************************************************** */
+
+    template <typename Data>
+    const Data& OrderedDictionaryContainer<Data>::UpperBound(const Data& dat) const {
+      return Successor(dat);
+    }
+
+    template <typename Data>
+    unsigned long OrderedDictionaryContainer<Data>::RangeCount(const Data& lo, const Data& hi) const {
+      unsigned long count = 0;
+      RangeTraverse(lo, hi, [&count](const Data&) { ++count; });
+      return count;
+    }
+
+    /* ************************************************************************** */
+    
     }
\ No newline at end of file
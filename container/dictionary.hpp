@@ -59,6 +59,12 @@ public:
 
   virtual bool RemoveSome(const TraversableContainer<Data>&);
 
+  template <ForeignInputRange<Data> Range>
+  bool InsertAll(Range&&);   // Copy (or move, for prvalue elements) from any input range
+
+  template <ForeignInputRange<Data> Range>
+  bool InsertSome(Range&&);  // Copy (or move, for prvalue elements) from any input range
+
 };
 
 /* ************************************************************************** */
@@ -112,6 +118,19 @@ public:
   virtual Data SuccessorNRemove(const Data&) = 0;
   virtual void RemoveSuccessor(const Data&) = 0;
 
+  /* ************************************************************************ */
+
+  // Range queries (all ranges are half-open: [lo, hi))
+
+  using RangeFun = typename TraversableContainer<Data>::TraverseFun;
+
+  virtual const Data& LowerBound(const Data&) const = 0; // Smallest value not below the given one (length_error if none)
+  virtual const Data& UpperBound(const Data&) const;     // Smallest value above the given one (length_error if none)
+
+  virtual void RangeTraverse(const Data&, const Data&, RangeFun) const = 0; // Ascending order
+  virtual unsigned long RangeCount(const Data&, const Data&) const;
+  virtual unsigned long RangeRemove(const Data&, const Data&) = 0;         // Returns how many values were removed
+
 };
 
 /* ************************************************************************** */
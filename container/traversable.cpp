@@ -21,6 +21,16 @@ Accumulator TraversableContainer<Data>::Fold(FoldFun<Accumulator> fun, Accumulat
   return result;
 }
 
+template <typename Data>
+template <typename Accumulator>
+Accumulator TraversableContainer<Data>::FoldInPlace(FoldInPlaceFun<Accumulator> fun, Accumulator acc) const {
+  Accumulator result = std::move(acc);
+  Traverse([&result, &fun](const Data& d) {
+    fun(result, d);
+  });
+  return result;
+}
+
 /* ************************************************************************** */
 
 template <typename Data>
@@ -38,6 +48,16 @@ Accumulator PreOrderTraversableContainer<Data>::PreOrderFold(FoldFun<Accumulator
   return result;
 }
 
+template <typename Data>
+template <typename Accumulator>
+Accumulator PreOrderTraversableContainer<Data>::PreOrderFoldInPlace(FoldInPlaceFun<Accumulator> fun, Accumulator acc) const {
+  Accumulator result = std::move(acc);
+  PreOrderTraverse([&result, &fun](const Data& d) {
+    fun(result, d);
+  });
+  return result;
+}
+
 /* ************************************************************************** */
 
 template <typename Data>
@@ -55,6 +75,16 @@ Accumulator PostOrderTraversableContainer<Data>::PostOrderFold(FoldFun<Accumulat
   return result;
 }
 
+template <typename Data>
+template <typename Accumulator>
+Accumulator PostOrderTraversableContainer<Data>::PostOrderFoldInPlace(FoldInPlaceFun<Accumulator> fun, Accumulator acc) const {
+  Accumulator result = std::move(acc);
+  PostOrderTraverse([&result, &fun](const Data& d) {
+    fun(result, d);
+  });
+  return result;
+}
+
 /* ************************************************************************** */
 
 }
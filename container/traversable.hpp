@@ -3,7 +3,10 @@
 
 /* ************************************************************************** */
 
+#include <concepts>
 #include <functional>
+#include <ranges>
+#include <type_traits>
 
 /* ************************************************************************** */
 
@@ -58,6 +61,12 @@ public:
   template <typename Accumulator>
   Accumulator Fold(FoldFun<Accumulator> fun, Accumulator) const;
 
+  template <typename Accumulator>
+  using FoldInPlaceFun = std::function<void(Accumulator&, const Data&)>;
+
+  template <typename Accumulator>
+  Accumulator FoldInPlace(FoldInPlaceFun<Accumulator>, Accumulator) const; // The accumulator is updated, never copied
+
   /* ************************************************************************ */
 
   // Specific member function (inherited from TestableContainer)
@@ -68,6 +77,15 @@ public:
 
 /* ************************************************************************** */
 
+// Any input range yielding values convertible to Data which is not itself
+// a TraversableContainer (those keep going through the virtual overloads).
+template <typename Range, typename Data>
+concept ForeignInputRange = std::ranges::input_range<Range> &&
+                            !std::derived_from<std::remove_cvref_t<Range>, TraversableContainer<Data>> &&
+                            std::convertible_to<std::ranges::range_reference_t<Range>, Data>;
+
+/* ************************************************************************** */
+
 template <typename Data>
 class PreOrderTraversableContainer : public virtual TraversableContainer<Data> {
   // Must extend TraversableContainer<Data>
@@ -111,6 +129,12 @@ public:
   template <typename Accumulator>
   Accumulator PreOrderFold(FoldFun<Accumulator>, Accumulator) const;
 
+  template <typename Accumulator>
+  using FoldInPlaceFun = typename TraversableContainer<Data>::template FoldInPlaceFun<Accumulator>;
+
+  template <typename Accumulator>
+  Accumulator PreOrderFoldInPlace(FoldInPlaceFun<Accumulator>, Accumulator) const;
+
   /* ************************************************************************ */
 
   // Specific member function (inherited from TraversableContainer)
@@ -164,6 +188,12 @@ public:
   template <typename Accumulator>
   Accumulator PostOrderFold(FoldFun<Accumulator> fun, Accumulator) const;
 
+  template <typename Accumulator>
+  using FoldInPlaceFun = typename TraversableContainer<Data>::template FoldInPlaceFun<Accumulator>;
+
+  template <typename Accumulator>
+  Accumulator PostOrderFoldInPlace(FoldInPlaceFun<Accumulator>, Accumulator) const;
+
   /* ************************************************************************ */
 
   // Specific member function (inherited from TraversableContainer)
@@ -0,0 +1,146 @@
+#include <stdexcept>
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+template <typename Derived, typename Data>
+const Data& FlatLinearContainer<Derived, Data>::Front() const {
+  if (Self().Size() == 0)
+    throw std::length_error("Access to front of an empty container");
+  return Self()[0];
+}
+
+template <typename Derived, typename Data>
+const Data& FlatLinearContainer<Derived, Data>::Back() const {
+  if (Self().Size() == 0)
+    throw std::length_error("Access to back of an empty container");
+  return Self()[Self().Size() - 1];
+}
+
+/* ************************************************************************** */
+
+template <typename Derived, typename Data>
+template <typename Fun>
+void FlatLinearContainer<Derived, Data>::Traverse(Fun fun) const {
+  Self().PreOrderTraverse(fun);
+}
+
+template <typename Derived, typename Data>
+template <typename Fun>
+void FlatLinearContainer<Derived, Data>::PreOrderTraverse(Fun fun) const {
+  for (const Data& dat : Self())
+    fun(dat);
+}
+
+template <typename Derived, typename Data>
+template <typename Fun>
+void FlatLinearContainer<Derived, Data>::PostOrderTraverse(Fun fun) const {
+  for (unsigned long i = Self().Size(); i > 0; --i)
+    fun(Self()[i - 1]);
+}
+
+template <typename Derived, typename Data>
+template <typename Accumulator, typename Fun>
+Accumulator FlatLinearContainer<Derived, Data>::Fold(Fun fun, Accumulator acc) const {
+  Self().Traverse([&acc, &fun](const Data& dat) {
+    acc = fun(dat, acc);
+  });
+  return acc;
+}
+
+template <typename Derived, typename Data>
+template <typename Accumulator, typename Fun>
+Accumulator FlatLinearContainer<Derived, Data>::PreOrderFold(Fun fun, Accumulator acc) const {
+  Self().PreOrderTraverse([&acc, &fun](const Data& dat) {
+    acc = fun(dat, acc);
+  });
+  return acc;
+}
+
+template <typename Derived, typename Data>
+template <typename Accumulator, typename Fun>
+Accumulator FlatLinearContainer<Derived, Data>::PostOrderFold(Fun fun, Accumulator acc) const {
+  Self().PostOrderTraverse([&acc, &fun](const Data& dat) {
+    acc = fun(dat, acc);
+  });
+  return acc;
+}
+
+template <typename Derived, typename Data>
+template <typename Accumulator, typename Fun>
+Accumulator FlatLinearContainer<Derived, Data>::FoldInPlace(Fun fun, Accumulator acc) const {
+  Self().Traverse([&acc, &fun](const Data& dat) {
+    fun(acc, dat);
+  });
+  return acc;
+}
+
+template <typename Derived, typename Data>
+template <typename Accumulator, typename Fun>
+Accumulator FlatLinearContainer<Derived, Data>::PreOrderFoldInPlace(Fun fun, Accumulator acc) const {
+  Self().PreOrderTraverse([&acc, &fun](const Data& dat) {
+    fun(acc, dat);
+  });
+  return acc;
+}
+
+template <typename Derived, typename Data>
+template <typename Accumulator, typename Fun>
+Accumulator FlatLinearContainer<Derived, Data>::PostOrderFoldInPlace(Fun fun, Accumulator acc) const {
+  Self().PostOrderTraverse([&acc, &fun](const Data& dat) {
+    fun(acc, dat);
+  });
+  return acc;
+}
+
+template <typename Derived, typename Data>
+bool FlatLinearContainer<Derived, Data>::Exists(const Data& dat) const noexcept {
+  for (const Data& val : Self())
+    if (val == dat) return true;
+  return false;
+}
+
+/* ************************************************************************** */
+
+template <typename Derived, typename Data>
+template <typename Fun>
+void FlatLinearContainer<Derived, Data>::Map(Fun fun) {
+  Self().PreOrderMap(fun);
+}
+
+template <typename Derived, typename Data>
+template <typename Fun>
+void FlatLinearContainer<Derived, Data>::PreOrderMap(Fun fun) {
+  for (Data& dat : Self())
+    fun(dat);
+}
+
+template <typename Derived, typename Data>
+template <typename Fun>
+void FlatLinearContainer<Derived, Data>::PostOrderMap(Fun fun) {
+  for (unsigned long i = Self().Size(); i > 0; --i)
+    fun(Self()[i - 1]);
+}
+
+/* ************************************************************************** */
+
+template <typename Derived, typename Data>
+bool FlatLinearContainer<Derived, Data>::operator==(const Derived& other) const noexcept {
+  if (Self().Size() != other.Size()) return false;
+  auto it = other.begin();
+  for (const Data& dat : Self()) {
+    if (dat != *it) return false;
+    ++it;
+  }
+  return true;
+}
+
+template <typename Derived, typename Data>
+bool FlatLinearContainer<Derived, Data>::operator!=(const Derived& other) const noexcept {
+  return !(*this == other);
+}
+
+/* ************************************************************************** */
+
+}
@@ -0,0 +1,119 @@
+
+#ifndef FLAT_HPP
+#define FLAT_HPP
+
+/* ************************************************************************** */
+
+#include <concepts>
+#include <type_traits>
+
+/* ************************************************************************** */
+
+#include "../container/traversable.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Input ranges accepted by the flat containers (a flat container never
+// treats a copy of itself as a foreign range).
+template <typename Range, typename Data, typename Container>
+concept FlatSourceRange = ForeignInputRange<Range, Data> &&
+                          !std::same_as<std::remove_cvref_t<Range>, Container>;
+
+/* ************************************************************************** */
+
+// CRTP base of the flat (non-virtual) containers: the derived class provides
+// Size(), operator[] and begin()/end(); everything else is resolved statically.
+template <typename Derived, typename Data>
+class FlatLinearContainer {
+
+protected:
+
+  // Default constructor
+  FlatLinearContainer() = default;
+
+  // Destructor
+  ~FlatLinearContainer() = default;
+
+  /* ************************************************************************ */
+
+  // Auxiliary member functions
+  const Derived& Self() const noexcept { return static_cast<const Derived&>(*this); }
+  Derived& Self() noexcept { return static_cast<Derived&>(*this); }
+
+public:
+
+  // Specific member functions (Container)
+  bool Empty() const noexcept { return (Self().Size() == 0); }
+
+  /* ************************************************************************ */
+
+  // Specific member functions (LinearContainer)
+
+  const Data& Front() const; // throws std::length_error if empty
+  const Data& Back() const;  // throws std::length_error if empty
+
+  /* ************************************************************************ */
+
+  // Specific member functions (TraversableContainer and friends)
+
+  template <typename Fun>
+  void Traverse(Fun) const;
+
+  template <typename Fun>
+  void PreOrderTraverse(Fun) const;
+
+  template <typename Fun>
+  void PostOrderTraverse(Fun) const;
+
+  template <typename Accumulator, typename Fun>
+  Accumulator Fold(Fun, Accumulator) const;
+
+  template <typename Accumulator, typename Fun>
+  Accumulator PreOrderFold(Fun, Accumulator) const;
+
+  template <typename Accumulator, typename Fun>
+  Accumulator PostOrderFold(Fun, Accumulator) const;
+
+  template <typename Accumulator, typename Fun>
+  Accumulator FoldInPlace(Fun, Accumulator) const;
+
+  template <typename Accumulator, typename Fun>
+  Accumulator PreOrderFoldInPlace(Fun, Accumulator) const;
+
+  template <typename Accumulator, typename Fun>
+  Accumulator PostOrderFoldInPlace(Fun, Accumulator) const;
+
+  bool Exists(const Data&) const noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member functions (MappableContainer and friends, mutable containers only)
+
+  template <typename Fun>
+  void Map(Fun);
+
+  template <typename Fun>
+  void PreOrderMap(Fun);
+
+  template <typename Fun>
+  void PostOrderMap(Fun);
+
+  /* ************************************************************************ */
+
+  // Comparison operators
+  bool operator==(const Derived&) const noexcept;
+  bool operator!=(const Derived&) const noexcept;
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "flat.cpp"
+
+#endif
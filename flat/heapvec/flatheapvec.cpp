@@ -0,0 +1,74 @@
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+template <typename Data>
+FlatHeapVec<Data>::FlatHeapVec(const TraversableContainer<Data>& container) : vec(container) {
+  Heapify();
+}
+
+template <typename Data>
+template <FlatSourceRange<Data, FlatHeapVec<Data>> Range>
+FlatHeapVec<Data>::FlatHeapVec(Range&& range) : vec(std::forward<Range>(range)) {
+  Heapify();
+}
+
+/* ************************************************************************** */
+
+template <typename Data>
+bool FlatHeapVec<Data>::IsHeap() const noexcept {
+  const Data* elems = vec.begin();
+  unsigned long size = vec.Size();
+  for (unsigned long i = 0; i < size / 2; ++i) {
+    unsigned long left = 2 * i + 1;
+    unsigned long right = 2 * i + 2;
+    if (left < size && elems[i] < elems[left])
+      return false;
+    if (right < size && elems[i] < elems[right])
+      return false;
+  }
+  return true;
+}
+
+template <typename Data>
+void FlatHeapVec<Data>::Heapify() noexcept {
+  unsigned long size = vec.Size();
+  if (size <= 1) return;
+  for (unsigned long i = size / 2; i > 0; --i)
+    HeapifyDown(i - 1, size);
+}
+
+template <typename Data>
+void FlatHeapVec<Data>::HeapifyDown(unsigned long i, unsigned long size) noexcept {
+  Data* elems = vec.begin();
+  while (true) {
+    unsigned long largest = i;
+    unsigned long left = 2 * i + 1;
+    unsigned long right = 2 * i + 2;
+
+    if (left < size && elems[left] > elems[largest])
+      largest = left;
+    if (right < size && elems[right] > elems[largest])
+      largest = right;
+
+    if (largest == i)
+      break;
+    std::swap(elems[i], elems[largest]);
+    i = largest;
+  }
+}
+
+template <typename Data>
+void FlatHeapVec<Data>::Sort() noexcept {
+  Heapify();
+  Data* elems = vec.begin();
+  for (unsigned long i = vec.Size(); i > 1; --i) {
+    std::swap(elems[0], elems[i - 1]);
+    HeapifyDown(0, i - 1);
+  }
+}
+
+/* ************************************************************************** */
+
+}
@@ -0,0 +1,99 @@
+
+#ifndef FLATHEAPVEC_HPP
+#define FLATHEAPVEC_HPP
+
+/* ************************************************************************** */
+
+#include "../vector/flatvector.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Same member API as HeapVec (a max-heap over a vector), but without any
+// virtual base: it simply owns a FlatVector.
+template <typename Data>
+class FlatHeapVec final : public FlatLinearContainer<FlatHeapVec<Data>, Data> {
+
+private:
+
+  FlatVector<Data> vec;
+
+  /* ************************************************************************ */
+
+  // Auxiliary member functions
+  void HeapifyDown(unsigned long, unsigned long) noexcept;
+
+public:
+
+  // Default constructor
+  FlatHeapVec() = default;
+
+  // Specific constructors
+  FlatHeapVec(const TraversableContainer<Data>&); // A heap obtained from a TraversableContainer
+
+  template <FlatSourceRange<Data, FlatHeapVec> Range>
+  FlatHeapVec(Range&&);                           // A heap obtained from any input range
+
+  // Copy constructor
+  FlatHeapVec(const FlatHeapVec&) = default;
+
+  // Move constructor
+  FlatHeapVec(FlatHeapVec&&) noexcept = default;
+
+  // Destructor
+  ~FlatHeapVec() = default;
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  FlatHeapVec& operator=(const FlatHeapVec&) = default;
+
+  // Move assignment
+  FlatHeapVec& operator=(FlatHeapVec&&) noexcept = default;
+
+  /* ************************************************************************ */
+
+  // Specific member functions (Heap)
+
+  bool IsHeap() const noexcept;
+  void Heapify() noexcept;
+
+  void Sort() noexcept; // Heap sort, in place
+
+  /* ************************************************************************ */
+
+  // Specific member functions (Vector)
+
+  unsigned long Size() const noexcept { return vec.Size(); }
+
+  const Data& operator[](unsigned long index) const { return vec[index]; }
+  Data& operator[](unsigned long index) { return vec[index]; }
+
+  void Clear() { vec.Clear(); }
+  void Resize(unsigned long newsize) { vec.Resize(newsize); }
+
+  /* ************************************************************************ */
+
+  // Iterators
+  using iterator = typename FlatVector<Data>::iterator;
+  using const_iterator = typename FlatVector<Data>::const_iterator;
+
+  iterator begin() noexcept { return vec.begin(); }
+  iterator end() noexcept { return vec.end(); }
+  const_iterator begin() const noexcept { return vec.begin(); }
+  const_iterator end() const noexcept { return vec.end(); }
+  const_iterator cbegin() const noexcept { return vec.cbegin(); }
+  const_iterator cend() const noexcept { return vec.cend(); }
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "flatheapvec.cpp"
+
+#endif
@@ -0,0 +1,246 @@
+#include <stdexcept>
+
+namespace lasd {
+
+/* ************************************************************************** */
+/* Utility functions */
+
+template <typename Data>
+void FlatList<Data>::CopyFrom(const FlatList& other) {
+  for (Node* curr = other.head; curr != nullptr; curr = curr->next)
+    InsertAtBack(curr->element);
+}
+
+/* ************************************************************************** */
+/* Constructors and Destructor */
+
+template <typename Data>
+FlatList<Data>::FlatList(const TraversableContainer<Data>& container) {
+  container.Traverse([this](const Data& dat) { InsertAtBack(dat); });
+}
+
+template <typename Data>
+template <FlatSourceRange<Data, FlatList<Data>> Range>
+FlatList<Data>::FlatList(Range&& range) {
+  for (auto&& dat : range)
+    InsertAtBack(std::forward<decltype(dat)>(dat));
+}
+
+template <typename Data>
+FlatList<Data>::FlatList(const FlatList& other) {
+  CopyFrom(other);
+}
+
+template <typename Data>
+FlatList<Data>::FlatList(FlatList&& other) noexcept {
+  std::swap(head, other.head);
+  std::swap(tail, other.tail);
+  std::swap(size, other.size);
+}
+
+template <typename Data>
+FlatList<Data>::~FlatList() {
+  Clear();
+}
+
+/* ************************************************************************** */
+/* Assignment operators */
+
+template <typename Data>
+FlatList<Data>& FlatList<Data>::operator=(const FlatList& other) {
+  if (this != &other) {
+    Clear();
+    CopyFrom(other);
+  }
+  return *this;
+}
+
+template <typename Data>
+FlatList<Data>& FlatList<Data>::operator=(FlatList&& other) noexcept {
+  std::swap(head, other.head);
+  std::swap(tail, other.tail);
+  std::swap(size, other.size);
+  return *this;
+}
+
+/* ************************************************************************** */
+/* Insert / Remove Front */
+
+template <typename Data>
+void FlatList<Data>::InsertAtFront(const Data& dat) {
+  Node* newNode = new Node(dat);
+  newNode->next = head;
+  head = newNode;
+  if (tail == nullptr) tail = newNode;
+  ++size;
+}
+
+template <typename Data>
+void FlatList<Data>::InsertAtFront(Data&& dat) {
+  Node* newNode = new Node(std::move(dat));
+  newNode->next = head;
+  head = newNode;
+  if (tail == nullptr) tail = newNode;
+  ++size;
+}
+
+template <typename Data>
+void FlatList<Data>::RemoveFromFront() {
+  if (size == 0) throw std::length_error("List is empty");
+  Node* tmp = head;
+  head = head->next;
+  delete tmp;
+  --size;
+  if (size == 0) tail = nullptr;
+}
+
+template <typename Data>
+Data FlatList<Data>::FrontNRemove() {
+  if (size == 0) throw std::length_error("List is empty");
+  Data ret = std::move(head->element);
+  RemoveFromFront();
+  return ret;
+}
+
+/* ************************************************************************** */
+/* Insert / Remove Back */
+
+template <typename Data>
+void FlatList<Data>::InsertAtBack(const Data& dat) {
+  Node* newNode = new Node(dat);
+  if (tail == nullptr) {
+    head = tail = newNode;
+  } else {
+    tail->next = newNode;
+    tail = newNode;
+  }
+  ++size;
+}
+
+template <typename Data>
+void FlatList<Data>::InsertAtBack(Data&& dat) {
+  Node* newNode = new Node(std::move(dat));
+  if (tail == nullptr) {
+    head = tail = newNode;
+  } else {
+    tail->next = newNode;
+    tail = newNode;
+  }
+  ++size;
+}
+
+template <typename Data>
+void FlatList<Data>::RemoveFromBack() {
+  if (size == 0) throw std::length_error("List is empty");
+  if (size == 1) {
+    delete head;
+    head = tail = nullptr;
+  } else {
+    Node* prev = head;
+    while (prev->next != tail)
+      prev = prev->next;
+    delete tail;
+    tail = prev;
+    tail->next = nullptr;
+  }
+  --size;
+}
+
+template <typename Data>
+Data FlatList<Data>::BackNRemove() {
+  if (size == 0) throw std::length_error("List is empty");
+  Data ret = std::move(tail->element);
+  RemoveFromBack();
+  return ret;
+}
+
+/* ************************************************************************** */
+/* Accessors */
+
+template <typename Data>
+const Data& FlatList<Data>::operator[](unsigned long index) const {
+  if (index >= size) throw std::out_of_range("Index out of range");
+  Node* current = head;
+  for (unsigned long i = 0; i < index; ++i)
+    current = current->next;
+  return current->element;
+}
+
+template <typename Data>
+Data& FlatList<Data>::operator[](unsigned long index) {
+  if (index >= size) throw std::out_of_range("Index out of range");
+  Node* current = head;
+  for (unsigned long i = 0; i < index; ++i)
+    current = current->next;
+  return current->element;
+}
+
+template <typename Data>
+const Data& FlatList<Data>::Front() const {
+  if (size == 0) throw std::length_error("List is empty");
+  return head->element;
+}
+
+template <typename Data>
+Data& FlatList<Data>::Front() {
+  if (size == 0) throw std::length_error("List is empty");
+  return head->element;
+}
+
+template <typename Data>
+const Data& FlatList<Data>::Back() const {
+  if (size == 0) throw std::length_error("List is empty");
+  return tail->element;
+}
+
+template <typename Data>
+Data& FlatList<Data>::Back() {
+  if (size == 0) throw std::length_error("List is empty");
+  return tail->element;
+}
+
+/* ************************************************************************** */
+/* Post-order visits */
+
+template <typename Data>
+template <typename Fun>
+void FlatList<Data>::PostOrderTraverse(Fun fun) const {
+  // Collect the nodes once instead of recursing through std::function
+  Node** nodes = new Node*[size];
+  unsigned long i = 0;
+  for (Node* curr = head; curr != nullptr; curr = curr->next)
+    nodes[i++] = curr;
+  while (i > 0)
+    fun(static_cast<const Data&>(nodes[--i]->element));
+  delete[] nodes;
+}
+
+template <typename Data>
+template <typename Fun>
+void FlatList<Data>::PostOrderMap(Fun fun) {
+  Node** nodes = new Node*[size];
+  unsigned long i = 0;
+  for (Node* curr = head; curr != nullptr; curr = curr->next)
+    nodes[i++] = curr;
+  while (i > 0)
+    fun(nodes[--i]->element);
+  delete[] nodes;
+}
+
+/* ************************************************************************** */
+/* Clear */
+
+template <typename Data>
+void FlatList<Data>::Clear() {
+  while (head != nullptr) {
+    Node* tmp = head;
+    head = head->next;
+    delete tmp;
+  }
+  tail = nullptr;
+  size = 0;
+}
+
+/* ************************************************************************** */
+
+}
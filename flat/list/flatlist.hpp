@@ -0,0 +1,168 @@
+
+#ifndef FLATLIST_HPP
+#define FLATLIST_HPP
+
+/* ************************************************************************** */
+
+#include <iterator>
+
+/* ************************************************************************** */
+
+#include "../flat.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Same member API as List, but without any virtual base.
+template <typename Data>
+class FlatList final : public FlatLinearContainer<FlatList<Data>, Data> {
+
+private:
+
+  struct Node {
+
+    Data element;
+    Node* next = nullptr;
+
+    // Specific constructors
+    Node(const Data& dat) : element(dat) {}
+    Node(Data&& dat) noexcept : element(std::move(dat)) {}
+
+  };
+
+  Node* head = nullptr;
+  Node* tail = nullptr;
+  unsigned long size = 0;
+
+  /* ************************************************************************ */
+
+  // Forward iterator over the nodes (Value is Data or const Data)
+  template <typename Value>
+  class Iterator {
+
+  private:
+
+    friend class FlatList<Data>;
+
+    Node* node = nullptr;
+
+    explicit Iterator(Node* nod) noexcept : node(nod) {}
+
+  public:
+
+    using iterator_concept = std::forward_iterator_tag;
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::remove_const_t<Value>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Value*;
+    using reference = Value&;
+
+    Iterator() = default;
+
+    // A mutable iterator converts to a constant one
+    template <typename Other> requires (std::is_const_v<Value> && std::is_same_v<Other, Data>)
+    Iterator(const Iterator<Other>& it) noexcept : node(it.node) {}
+
+    reference operator*() const noexcept { return node->element; }
+    pointer operator->() const noexcept { return &node->element; }
+
+    Iterator& operator++() noexcept { node = node->next; return *this; }
+    Iterator operator++(int) noexcept { Iterator tmp = *this; node = node->next; return tmp; }
+
+    friend bool operator==(const Iterator& it1, const Iterator& it2) noexcept { return it1.node == it2.node; }
+
+    template <typename> friend class Iterator;
+
+  };
+
+  /* ************************************************************************ */
+
+  // Auxiliary member functions
+  void CopyFrom(const FlatList&);
+
+public:
+
+  using iterator = Iterator<Data>;
+  using const_iterator = Iterator<const Data>;
+
+  // Default constructor
+  FlatList() = default;
+
+  // Specific constructors
+  FlatList(const TraversableContainer<Data>&); // Copy from TraversableContainer
+
+  template <FlatSourceRange<Data, FlatList> Range>
+  FlatList(Range&&);                           // Copy (or move, for prvalue elements) from any input range
+
+  // Copy constructor
+  FlatList(const FlatList&);
+
+  // Move constructor
+  FlatList(FlatList&&) noexcept;
+
+  // Destructor
+  ~FlatList();
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  FlatList& operator=(const FlatList&);
+
+  // Move assignment
+  FlatList& operator=(FlatList&&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member functions
+
+  unsigned long Size() const noexcept { return size; }
+
+  void InsertAtFront(const Data&);  // Copy
+  void InsertAtFront(Data&&);       // Move
+  void RemoveFromFront();           // Throws std::length_error if empty
+  Data FrontNRemove();              // Throws std::length_error if empty
+
+  void InsertAtBack(const Data&);   // Copy
+  void InsertAtBack(Data&&);        // Move
+  void RemoveFromBack();            // Throws std::length_error if empty
+  Data BackNRemove();               // Throws std::length_error if empty
+
+  const Data& operator[](unsigned long) const; // throws std::out_of_range
+  Data& operator[](unsigned long);             // throws std::out_of_range
+
+  const Data& Front() const; // throws std::length_error if empty
+  Data& Front();             // throws std::length_error if empty
+  const Data& Back() const;  // throws std::length_error if empty
+  Data& Back();              // throws std::length_error if empty
+
+  // Post-order visits need the nodes in reverse: no random access on a list
+  template <typename Fun>
+  void PostOrderTraverse(Fun) const;
+
+  template <typename Fun>
+  void PostOrderMap(Fun);
+
+  void Clear();
+
+  /* ************************************************************************ */
+
+  // Iterators
+  iterator begin() noexcept { return iterator(head); }
+  iterator end() noexcept { return iterator(); }
+  const_iterator begin() const noexcept { return const_iterator(head); }
+  const_iterator end() const noexcept { return const_iterator(); }
+  const_iterator cbegin() const noexcept { return const_iterator(head); }
+  const_iterator cend() const noexcept { return const_iterator(); }
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "flatlist.cpp"
+
+#endif
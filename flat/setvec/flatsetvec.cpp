@@ -0,0 +1,332 @@
+#include <stdexcept>
+
+namespace lasd {
+
+/* ************************************************************************** */
+/* Auxiliary member functions */
+
+template <typename Data>
+unsigned long FlatSetVec<Data>::LowerBound(const Data& dat) const noexcept {
+  unsigned long left = 0;
+  unsigned long right = size;
+  while (left < right) {
+    unsigned long mid = left + (right - left) / 2;
+    if (elements[mid] < dat)
+      left = mid + 1;
+    else
+      right = mid;
+  }
+  return left;
+}
+
+template <typename Data>
+unsigned long FlatSetVec<Data>::UpperBound(const Data& dat) const noexcept {
+  unsigned long left = 0;
+  unsigned long right = size;
+  while (left < right) {
+    unsigned long mid = left + (right - left) / 2;
+    if (dat < elements[mid])
+      right = mid;
+    else
+      left = mid + 1;
+  }
+  return left;
+}
+
+template <typename Data>
+void FlatSetVec<Data>::Reserve(unsigned long newCap) {
+  Data* newElems = new Data[newCap];
+  for (unsigned long i = 0; i < size; ++i)
+    newElems[i] = std::move(elements[i]);
+  delete[] elements;
+  elements = newElems;
+  capacity = newCap;
+}
+
+template <typename Data>
+template <typename Value>
+bool FlatSetVec<Data>::InsertValue(Value&& dat) {
+  unsigned long pos = LowerBound(dat);
+  if (pos < size && elements[pos] == dat) return false;
+  if (size == capacity)
+    Reserve(capacity == 0 ? 1 : capacity * 2);
+  for (unsigned long i = size; i > pos; --i)
+    elements[i] = std::move(elements[i - 1]);
+  elements[pos] = std::forward<Value>(dat);
+  ++size;
+  return true;
+}
+
+template <typename Data>
+void FlatSetVec<Data>::RemoveAt(unsigned long index) {
+  for (unsigned long i = index; i + 1 < size; ++i)
+    elements[i] = std::move(elements[i + 1]);
+  --size;
+  if (size < capacity / 4 && capacity > 1)
+    Reserve(capacity / 2);
+}
+
+/* ************************************************************************** */
+/* Constructors, destructor and assignments */
+
+template <typename Data>
+FlatSetVec<Data>::FlatSetVec(const TraversableContainer<Data>& container) {
+  container.Traverse([this](const Data& dat) { Insert(dat); });
+}
+
+template <typename Data>
+template <FlatSourceRange<Data, FlatSetVec<Data>> Range>
+FlatSetVec<Data>::FlatSetVec(Range&& range) {
+  for (auto&& dat : range)
+    Insert(std::forward<decltype(dat)>(dat));
+}
+
+template <typename Data>
+FlatSetVec<Data>::FlatSetVec(const FlatSetVec& other) {
+  elements = new Data[other.size];
+  capacity = size = other.size;
+  for (unsigned long i = 0; i < size; ++i)
+    elements[i] = other.elements[i];
+}
+
+template <typename Data>
+FlatSetVec<Data>::FlatSetVec(FlatSetVec&& other) noexcept {
+  std::swap(elements, other.elements);
+  std::swap(size, other.size);
+  std::swap(capacity, other.capacity);
+}
+
+template <typename Data>
+FlatSetVec<Data>::~FlatSetVec() {
+  delete[] elements;
+}
+
+template <typename Data>
+FlatSetVec<Data>& FlatSetVec<Data>::operator=(const FlatSetVec& other) {
+  if (this != &other) {
+    FlatSetVec tmp(other);
+    std::swap(elements, tmp.elements);
+    std::swap(size, tmp.size);
+    std::swap(capacity, tmp.capacity);
+  }
+  return *this;
+}
+
+template <typename Data>
+FlatSetVec<Data>& FlatSetVec<Data>::operator=(FlatSetVec&& other) noexcept {
+  std::swap(elements, other.elements);
+  std::swap(size, other.size);
+  std::swap(capacity, other.capacity);
+  return *this;
+}
+
+/* ************************************************************************** */
+/* Min / Max */
+
+template <typename Data>
+const Data& FlatSetVec<Data>::Min() const {
+  if (size == 0) throw std::length_error("Empty set");
+  return elements[0];
+}
+
+template <typename Data>
+Data FlatSetVec<Data>::MinNRemove() {
+  if (size == 0) throw std::length_error("Empty set");
+  Data tmp = std::move(elements[0]);
+  RemoveAt(0);
+  return tmp;
+}
+
+template <typename Data>
+void FlatSetVec<Data>::RemoveMin() {
+  if (size == 0) throw std::length_error("Empty set");
+  RemoveAt(0);
+}
+
+template <typename Data>
+const Data& FlatSetVec<Data>::Max() const {
+  if (size == 0) throw std::length_error("Empty set");
+  return elements[size - 1];
+}
+
+template <typename Data>
+Data FlatSetVec<Data>::MaxNRemove() {
+  if (size == 0) throw std::length_error("Empty set");
+  Data tmp = std::move(elements[size - 1]);
+  RemoveAt(size - 1);
+  return tmp;
+}
+
+template <typename Data>
+void FlatSetVec<Data>::RemoveMax() {
+  if (size == 0) throw std::length_error("Empty set");
+  RemoveAt(size - 1);
+}
+
+/* ************************************************************************** */
+/* Predecessor / Successor */
+
+template <typename Data>
+const Data& FlatSetVec<Data>::Predecessor(const Data& dat) const {
+  unsigned long pos = LowerBound(dat);
+  if (pos == 0) throw std::length_error("No predecessor");
+  return elements[pos - 1];
+}
+
+template <typename Data>
+Data FlatSetVec<Data>::PredecessorNRemove(const Data& dat) {
+  unsigned long pos = LowerBound(dat);
+  if (pos == 0) throw std::length_error("No predecessor");
+  Data tmp = std::move(elements[pos - 1]);
+  RemoveAt(pos - 1);
+  return tmp;
+}
+
+template <typename Data>
+void FlatSetVec<Data>::RemovePredecessor(const Data& dat) {
+  unsigned long pos = LowerBound(dat);
+  if (pos == 0) throw std::length_error("No predecessor");
+  RemoveAt(pos - 1);
+}
+
+template <typename Data>
+const Data& FlatSetVec<Data>::Successor(const Data& dat) const {
+  unsigned long pos = UpperBound(dat);
+  if (pos == size) throw std::length_error("No successor");
+  return elements[pos];
+}
+
+template <typename Data>
+Data FlatSetVec<Data>::SuccessorNRemove(const Data& dat) {
+  unsigned long pos = UpperBound(dat);
+  if (pos == size) throw std::length_error("No successor");
+  Data tmp = std::move(elements[pos]);
+  RemoveAt(pos);
+  return tmp;
+}
+
+template <typename Data>
+void FlatSetVec<Data>::RemoveSuccessor(const Data& dat) {
+  unsigned long pos = UpperBound(dat);
+  if (pos == size) throw std::length_error("No successor");
+  RemoveAt(pos);
+}
+
+/* ************************************************************************** */
+/* Insert / Remove */
+
+template <typename Data>
+bool FlatSetVec<Data>::Insert(const Data& dat) {
+  return InsertValue(dat);
+}
+
+template <typename Data>
+bool FlatSetVec<Data>::Insert(Data&& dat) {
+  return InsertValue(std::move(dat));
+}
+
+template <typename Data>
+bool FlatSetVec<Data>::Remove(const Data& dat) {
+  unsigned long pos = LowerBound(dat);
+  if (pos == size || !(elements[pos] == dat)) return false;
+  RemoveAt(pos);
+  return true;
+}
+
+template <typename Data>
+bool FlatSetVec<Data>::InsertAll(const TraversableContainer<Data>& container) {
+  bool allInserted = true;
+  container.Traverse([this, &allInserted](const Data& dat) { allInserted &= Insert(dat); });
+  return allInserted;
+}
+
+template <typename Data>
+bool FlatSetVec<Data>::InsertSome(const TraversableContainer<Data>& container) {
+  bool anyInserted = false;
+  container.Traverse([this, &anyInserted](const Data& dat) { anyInserted |= Insert(dat); });
+  return anyInserted;
+}
+
+template <typename Data>
+bool FlatSetVec<Data>::RemoveAll(const TraversableContainer<Data>& container) {
+  bool allRemoved = true;
+  container.Traverse([this, &allRemoved](const Data& dat) { allRemoved &= Remove(dat); });
+  return allRemoved;
+}
+
+template <typename Data>
+bool FlatSetVec<Data>::RemoveSome(const TraversableContainer<Data>& container) {
+  bool anyRemoved = false;
+  container.Traverse([this, &anyRemoved](const Data& dat) { anyRemoved |= Remove(dat); });
+  return anyRemoved;
+}
+
+template <typename Data>
+template <ForeignInputRange<Data> Range>
+bool FlatSetVec<Data>::InsertAll(Range&& range) {
+  bool allInserted = true;
+  for (auto&& dat : range)
+    allInserted &= Insert(std::forward<decltype(dat)>(dat));
+  return allInserted;
+}
+
+template <typename Data>
+template <ForeignInputRange<Data> Range>
+bool FlatSetVec<Data>::InsertSome(Range&& range) {
+  bool anyInserted = false;
+  for (auto&& dat : range)
+    anyInserted |= Insert(std::forward<decltype(dat)>(dat));
+  return anyInserted;
+}
+
+template <typename Data>
+template <ForeignInputRange<Data> Range>
+bool FlatSetVec<Data>::RemoveAll(Range&& range) {
+  bool allRemoved = true;
+  for (auto&& dat : range)
+    allRemoved &= Remove(dat);
+  return allRemoved;
+}
+
+template <typename Data>
+template <ForeignInputRange<Data> Range>
+bool FlatSetVec<Data>::RemoveSome(Range&& range) {
+  bool anyRemoved = false;
+  for (auto&& dat : range)
+    anyRemoved |= Remove(dat);
+  return anyRemoved;
+}
+
+/* ************************************************************************** */
+/* Access, Exists, Clear, Resize */
+
+template <typename Data>
+const Data& FlatSetVec<Data>::operator[](unsigned long index) const {
+  if (index >= size) throw std::out_of_range("Index out of range");
+  return elements[index];
+}
+
+template <typename Data>
+bool FlatSetVec<Data>::Exists(const Data& dat) const noexcept {
+  unsigned long pos = LowerBound(dat);
+  return (pos < size && elements[pos] == dat);
+}
+
+template <typename Data>
+void FlatSetVec<Data>::Clear() {
+  delete[] elements;
+  elements = nullptr;
+  size = 0;
+  capacity = 0;
+}
+
+template <typename Data>
+void FlatSetVec<Data>::Resize(unsigned long newCap) {
+  if (newCap < size)
+    throw std::length_error("Resize too small");
+  Reserve(newCap);
+}
+
+/* ************************************************************************** */
+
+}
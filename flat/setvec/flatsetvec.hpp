@@ -0,0 +1,138 @@
+
+#ifndef FLATSETVEC_HPP
+#define FLATSETVEC_HPP
+
+/* ************************************************************************** */
+
+#include "../flat.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Same member API as SetVec, but without any virtual base. The elements are
+// kept sorted at the front of the buffer (no wrap-around to account for).
+template <typename Data>
+class FlatSetVec final : public FlatLinearContainer<FlatSetVec<Data>, Data> {
+
+private:
+
+  Data* elements = nullptr;
+  unsigned long size = 0;
+  unsigned long capacity = 0;
+
+  /* ************************************************************************ */
+
+  // Auxiliary member functions
+  unsigned long LowerBound(const Data&) const noexcept; // First index not less than the value
+  unsigned long UpperBound(const Data&) const noexcept; // First index greater than the value
+  void Reserve(unsigned long);
+  template <typename Value>
+  bool InsertValue(Value&&);
+  void RemoveAt(unsigned long);
+
+public:
+
+  // Default constructor
+  FlatSetVec() = default;
+
+  // Specific constructors
+  FlatSetVec(const TraversableContainer<Data>&); // Copy from TraversableContainer
+
+  template <FlatSourceRange<Data, FlatSetVec> Range>
+  FlatSetVec(Range&&);                           // Copy (or move, for prvalue elements) from any input range
+
+  // Copy constructor
+  FlatSetVec(const FlatSetVec&);
+
+  // Move constructor
+  FlatSetVec(FlatSetVec&&) noexcept;
+
+  // Destructor
+  ~FlatSetVec();
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  FlatSetVec& operator=(const FlatSetVec&);
+
+  // Move assignment
+  FlatSetVec& operator=(FlatSetVec&&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member functions (OrderedDictionaryContainer)
+
+  const Data& Min() const; // throws std::length_error when empty
+  Data MinNRemove();       // throws std::length_error when empty
+  void RemoveMin();        // throws std::length_error when empty
+
+  const Data& Max() const; // throws std::length_error when empty
+  Data MaxNRemove();       // throws std::length_error when empty
+  void RemoveMax();        // throws std::length_error when empty
+
+  const Data& Predecessor(const Data&) const; // throws std::length_error if not found
+  Data PredecessorNRemove(const Data&);       // throws std::length_error if not found
+  void RemovePredecessor(const Data&);        // throws std::length_error if not found
+
+  const Data& Successor(const Data&) const;   // throws std::length_error if not found
+  Data SuccessorNRemove(const Data&);         // throws std::length_error if not found
+  void RemoveSuccessor(const Data&);          // throws std::length_error if not found
+
+  /* ************************************************************************ */
+
+  // Specific member functions (DictionaryContainer)
+
+  bool Insert(const Data&); // Copy
+  bool Insert(Data&&);      // Move
+  bool Remove(const Data&);
+
+  bool InsertAll(const TraversableContainer<Data>&);
+  bool InsertSome(const TraversableContainer<Data>&);
+  bool RemoveAll(const TraversableContainer<Data>&);
+  bool RemoveSome(const TraversableContainer<Data>&);
+
+  template <ForeignInputRange<Data> Range>
+  bool InsertAll(Range&&);
+  template <ForeignInputRange<Data> Range>
+  bool InsertSome(Range&&);
+  template <ForeignInputRange<Data> Range>
+  bool RemoveAll(Range&&);
+  template <ForeignInputRange<Data> Range>
+  bool RemoveSome(Range&&);
+
+  /* ************************************************************************ */
+
+  // Specific member functions (LinearContainer, TestableContainer, ResizableContainer)
+
+  unsigned long Size() const noexcept { return size; }
+
+  const Data& operator[](unsigned long) const; // throws std::out_of_range
+
+  bool Exists(const Data&) const noexcept;
+
+  void Clear();
+  void Resize(unsigned long); // Sets the capacity; throws std::length_error if below the size
+
+  /* ************************************************************************ */
+
+  // Iterators (read-only: elements must stay ordered)
+  using const_iterator = const Data*;
+  using iterator = const_iterator;
+
+  const_iterator begin() const noexcept { return elements; }
+  const_iterator end() const noexcept { return elements + size; }
+  const_iterator cbegin() const noexcept { return elements; }
+  const_iterator cend() const noexcept { return elements + size; }
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "flatsetvec.cpp"
+
+#endif
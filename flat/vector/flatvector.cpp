@@ -0,0 +1,144 @@
+#include <algorithm>
+#include <stdexcept>
+
+namespace lasd {
+
+/* ************************************************************************** */
+/* Constructors */
+
+template <typename Data>
+FlatVector<Data>::FlatVector(const unsigned long newsize) {
+  elements = new Data[newsize]();
+  size = newsize;
+}
+
+template <typename Data>
+FlatVector<Data>::FlatVector(const TraversableContainer<Data>& container) {
+  size = container.Size();
+  elements = new Data[size];
+  unsigned long i = 0;
+  container.Traverse([this, &i](const Data& dat) {
+    elements[i++] = dat;
+  });
+}
+
+template <typename Data>
+template <FlatSourceRange<Data, FlatVector<Data>> Range>
+FlatVector<Data>::FlatVector(Range&& range) {
+  if constexpr (std::ranges::sized_range<Range>) {
+    size = std::ranges::size(range);
+    elements = new Data[size];
+    unsigned long i = 0;
+    for (auto&& dat : range)
+      elements[i++] = std::forward<decltype(dat)>(dat);
+  } else {
+    unsigned long count = 0;
+    for (auto&& dat : range) {
+      if (count == size)
+        Resize(size == 0 ? 1 : size * 2);
+      elements[count++] = std::forward<decltype(dat)>(dat);
+    }
+    if (count != size)
+      Resize(count);
+  }
+}
+
+template <typename Data>
+FlatVector<Data>::FlatVector(const FlatVector& vec) {
+  size = vec.size;
+  elements = new Data[size];
+  for (unsigned long i = 0; i < size; ++i)
+    elements[i] = vec.elements[i];
+}
+
+template <typename Data>
+FlatVector<Data>::FlatVector(FlatVector&& vec) noexcept {
+  std::swap(elements, vec.elements);
+  std::swap(size, vec.size);
+}
+
+template <typename Data>
+FlatVector<Data>::~FlatVector() {
+  delete[] elements;
+}
+
+/* ************************************************************************** */
+/* Assignment operators */
+
+template <typename Data>
+FlatVector<Data>& FlatVector<Data>::operator=(const FlatVector& vec) {
+  if (this != &vec) {
+    FlatVector tmp(vec);
+    std::swap(elements, tmp.elements);
+    std::swap(size, tmp.size);
+  }
+  return *this;
+}
+
+template <typename Data>
+FlatVector<Data>& FlatVector<Data>::operator=(FlatVector&& vec) noexcept {
+  std::swap(elements, vec.elements);
+  std::swap(size, vec.size);
+  return *this;
+}
+
+/* ************************************************************************** */
+/* Access functions */
+
+template <typename Data>
+const Data& FlatVector<Data>::operator[](const unsigned long index) const {
+  if (index >= size) throw std::out_of_range("Access out of range");
+  return elements[index];
+}
+
+template <typename Data>
+Data& FlatVector<Data>::operator[](const unsigned long index) {
+  if (index >= size) throw std::out_of_range("Access out of range");
+  return elements[index];
+}
+
+template <typename Data>
+Data& FlatVector<Data>::Front() {
+  if (size == 0) throw std::length_error("Vector is empty");
+  return elements[0];
+}
+
+template <typename Data>
+Data& FlatVector<Data>::Back() {
+  if (size == 0) throw std::length_error("Vector is empty");
+  return elements[size - 1];
+}
+
+/* ************************************************************************** */
+/* Clear / Resize / Sort */
+
+template <typename Data>
+void FlatVector<Data>::Clear() {
+  delete[] elements;
+  elements = nullptr;
+  size = 0;
+}
+
+template <typename Data>
+void FlatVector<Data>::Resize(const unsigned long newsize) {
+  if (newsize == 0) {
+    Clear();
+  } else {
+    Data* tmp = new Data[newsize]();
+    unsigned long min = (newsize < size) ? newsize : size;
+    for (unsigned long i = 0; i < min; ++i)
+      tmp[i] = std::move(elements[i]);
+    delete[] elements;
+    elements = tmp;
+    size = newsize;
+  }
+}
+
+template <typename Data>
+void FlatVector<Data>::Sort() {
+  std::sort(elements, elements + size);
+}
+
+/* ************************************************************************** */
+
+}
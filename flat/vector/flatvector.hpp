@@ -0,0 +1,93 @@
+
+#ifndef FLATVECTOR_HPP
+#define FLATVECTOR_HPP
+
+/* ************************************************************************** */
+
+#include "../flat.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Same member API as Vector/SortableVector, but without any virtual base:
+// sizeof is two words and every call can be inlined.
+template <typename Data>
+class FlatVector final : public FlatLinearContainer<FlatVector<Data>, Data> {
+
+private:
+
+  Data* elements = nullptr;
+  unsigned long size = 0;
+
+public:
+
+  // Default constructor
+  FlatVector() = default;
+
+  // Specific constructors
+  FlatVector(unsigned long);
+  FlatVector(const TraversableContainer<Data>&); // Copy from TraversableContainer
+
+  template <FlatSourceRange<Data, FlatVector> Range>
+  FlatVector(Range&&);                           // Copy (or move, for prvalue elements) from any input range
+
+  // Copy constructor
+  FlatVector(const FlatVector&);
+
+  // Move constructor
+  FlatVector(FlatVector&&) noexcept;
+
+  // Destructor
+  ~FlatVector();
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  FlatVector& operator=(const FlatVector&);
+
+  // Move assignment
+  FlatVector& operator=(FlatVector&&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member functions
+  unsigned long Size() const noexcept { return size; }
+
+  const Data& operator[](unsigned long) const; // throws std::out_of_range
+  Data& operator[](unsigned long);             // throws std::out_of_range
+
+  using FlatLinearContainer<FlatVector<Data>, Data>::Front;
+  using FlatLinearContainer<FlatVector<Data>, Data>::Back;
+  Data& Front(); // throws std::length_error if empty
+  Data& Back();  // throws std::length_error if empty
+
+  void Clear();
+  void Resize(unsigned long);
+
+  void Sort();
+
+  /* ************************************************************************ */
+
+  // Iterators
+  using iterator = Data*;
+  using const_iterator = const Data*;
+
+  iterator begin() noexcept { return elements; }
+  iterator end() noexcept { return elements + size; }
+  const_iterator begin() const noexcept { return elements; }
+  const_iterator end() const noexcept { return elements + size; }
+  const_iterator cbegin() const noexcept { return elements; }
+  const_iterator cend() const noexcept { return elements + size; }
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "flatvector.cpp"
+
+#endif
@@ -26,6 +26,15 @@ namespace lasd {
     
     /* ************************************************************************** */
     
+    // Costruttore da un input range qualsiasi
+    template <typename Data>
+    template <ForeignInputRange<Data> Range>
+    HeapVec<Data>::HeapVec(Range&& range) : SortableVector<Data>(std::forward<Range>(range)) {
+      HeapVec<Data>::Heapify();
+    }
+    
+    /* ************************************************************************** */
+    
     // Copy constructor
     template <typename Data>
     HeapVec<Data>::HeapVec(const HeapVec<Data>& other) : SortableVector<Data>(other) {
@@ -104,18 +113,22 @@ namespace lasd {
 
     template <typename Data>
     void HeapVec<Data>::HeapifyDown(unsigned long i) noexcept {
+      // Confronti sul buffer: operator[] non-const marcherebbe ogni lettura come scrittura
+      Data* elements = Vector<Data>::elements_;
       while (true) {
         unsigned long largest = i;
         unsigned long left = 2 * i + 1;
         unsigned long right = 2 * i + 2;
     
-        if (left < size && (*this)[left] > (*this)[largest])
+        if (left < size && elements[left] > elements[largest])
           largest = left;
-        if (right < size && (*this)[right] > (*this)[largest])
+        if (right < size && elements[right] > elements[largest])
           largest = right;
     
         if (largest != i) {
-          std::swap((*this)[i], (*this)[largest]);
+          std::swap(elements[i], elements[largest]);
+          Vector<Data>::Touch(i);
+          Vector<Data>::Touch(largest);
           i = largest;
         } else {
           break;
@@ -126,10 +139,13 @@ namespace lasd {
     // HeapifyUp (per ripristinare l’heap bottom-up)
     template <typename Data>
     void HeapVec<Data>::HeapifyUp(unsigned long i) noexcept {
+      Data* elements = Vector<Data>::elements_;
       while (i > 0) {
         unsigned long parent = (i - 1) / 2;
-        if ((*this)[i] > (*this)[parent]) {
-          std::swap((*this)[i], (*this)[parent]);
+        if (elements[i] > elements[parent]) {
+          std::swap(elements[i], elements[parent]);
+          Vector<Data>::Touch(i);
+          Vector<Data>::Touch(parent);
           i = parent;
         } else {
           break;
@@ -143,9 +159,11 @@ namespace lasd {
     template <typename Data>
     void HeapVec<Data>::Sort() noexcept {
       Heapify(); // Prima costruiamo l'heap
+      Vector<Data>::TouchAll(); // L'ordinamento riscrive tutto il vettore: un solo marcatore
     
+      Data* elements = Vector<Data>::elements_;
       for (unsigned long i = size - 1; i > 0; --i) {
-        std::swap((*this)[0], (*this)[i]);
+        std::swap(elements[0], elements[i]);
         unsigned long newSize = i;
         unsigned long root = 0;
     
@@ -154,13 +172,13 @@ namespace lasd {
           unsigned long left = 2 * root + 1;
           unsigned long right = 2 * root + 2;
     
-          if (left < newSize && (*this)[left] > (*this)[largest])
+          if (left < newSize && elements[left] > elements[largest])
             largest = left;
-          if (right < newSize && (*this)[right] > (*this)[largest])
+          if (right < newSize && elements[right] > elements[largest])
             largest = right;
     
           if (largest != root) {
-            std::swap((*this)[root], (*this)[largest]);
+            std::swap(elements[root], elements[largest]);
             root = largest;
           } else {
             break;
@@ -42,6 +42,9 @@ public:
   HeapVec(const TraversableContainer<Data>&); // A heap obtained from a TraversableContainer
   HeapVec(MappableContainer<Data>&&);         // A heap obtained from a MappableContainer
 
+  template <ForeignInputRange<Data> Range>
+  HeapVec(Range&&);                           // A heap obtained from any input range
+
   /* ************************************************************************ */
 
   // Copy constructor
@@ -86,6 +86,14 @@ namespace lasd {
       container.Map([this](Data& dat) { InsertAtBack(std::move(dat)); });
     }
     
+    template <typename Data>
+    template <ForeignInputRange<Data> Range>
+    List<Data>::List(Range&& range) {
+      for (auto&& dat : range) {
+        InsertAtBack(std::forward<decltype(dat)>(dat));
+      }
+    }
+    
     template <typename Data>
     List<Data>::List(const List& other) {
       head = CopyList(other.head);
@@ -54,8 +54,52 @@ protected:
   void ClearList();
   void RemoveAt(unsigned long); // for SetLst use
 
+  /* ************************************************************************ */
+
+  // Forward iterator over the nodes (Value is Data or const Data)
+  template <typename Value>
+  class Iterator {
+
+  private:
+
+    friend class List<Data>;
+
+    Node* node = nullptr;
+
+    explicit Iterator(Node* nod) noexcept : node(nod) {}
+
+  public:
+
+    using iterator_concept = std::forward_iterator_tag;
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::remove_const_t<Value>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Value*;
+    using reference = Value&;
+
+    Iterator() = default;
+
+    // A mutable iterator converts to a constant one
+    template <typename Other> requires (std::is_const_v<Value> && std::is_same_v<Other, Data>)
+    Iterator(const Iterator<Other>& it) noexcept : node(it.node) {}
+
+    reference operator*() const noexcept { return node->element; }
+    pointer operator->() const noexcept { return &node->element; }
+
+    Iterator& operator++() noexcept { node = node->next; return *this; }
+    Iterator operator++(int) noexcept { Iterator tmp = *this; node = node->next; return tmp; }
+
+    friend bool operator==(const Iterator& it1, const Iterator& it2) noexcept { return it1.node == it2.node; }
+
+    template <typename> friend class Iterator;
+
+  };
+
 public:
 
+  using iterator = Iterator<Data>;
+  using const_iterator = Iterator<const Data>;
+
   // Bring base class methods into scope to avoid -Woverloaded-virtual warnings
   using LinearContainer<Data>::operator==;
   using LinearContainer<Data>::operator!=;
@@ -69,6 +113,9 @@ public:
   List(const TraversableContainer<Data>&); // Copy from TraversableContainer
   List(MappableContainer<Data>&&);         // Move from MappableContainer
 
+  template <ForeignInputRange<Data> Range>
+  List(Range&&);                           // Copy (or move, for prvalue elements) from any input range
+
   /* ************************************************************************ */
 
   // Copy constructor
@@ -157,6 +204,16 @@ public:
   // Specific member functions (inherited from ClearableContainer)
   void Clear() override;
 
+  /* ************************************************************************ */
+
+  // Iterators
+  iterator begin() noexcept { return iterator(head); }
+  iterator end() noexcept { return iterator(); }
+  const_iterator begin() const noexcept { return const_iterator(head); }
+  const_iterator end() const noexcept { return const_iterator(); }
+  const_iterator cbegin() const noexcept { return const_iterator(head); }
+  const_iterator cend() const noexcept { return const_iterator(); }
+
 };
 
 /* ************************************************************************** */
@@ -1,5 +1,6 @@
 #include "zlasdtest/test.hpp"  // test ufficiali
 #include "zmytest/test.hpp"    // miei test
+#include "zmybench/bench.hpp"  // benchmark
 
 #include <iostream>
 #include <string>
@@ -15,6 +16,8 @@ int main() {
     std::cout << "2. Test personalizzati - Parte 1 [Vector, List, Set, SetVec, SetLst]\n";
     std::cout << "3. Test personalizzati - Parte 2 [Heap, HeapVec, PQ, PQHeap]\n";
     std::cout << "4. Test personalizzati - Tutti\n";
+    std::cout << "5. Benchmark (zmybench)\n";
+    std::cout << "6. Test personalizzati - Parte 3 [SetAVL, SetBTree, SetHash, BloomSet, ConcurrentSetSkip, ShardedDictionary, OrderedMap, SetRoaring, SetVEB, SetPMA]\n";
     std::cout << "0. Esci\n";
     std::cout << ">> ";
   
@@ -42,6 +45,16 @@ int main() {
         lasd::RunAllTests();
         break;
   
+      case 5:
+        std::cout << "\n== Avvio benchmark ==\n" << std::endl;
+        lasd::RunAllBenchmarks();
+        break;
+  
+      case 6:
+        std::cout << "\n== Avvio test personalizzati - Parte 3 ==\n" << std::endl;
+        lasd::RunAllTests3();
+        break;
+  
       case 0:
         std::cout << "Uscita dal programma." << std::endl;
         continua = false;
@@ -52,7 +65,7 @@ int main() {
         break;
     }
   
-    if (scelta >= 1 && scelta <= 4) {
+    if (scelta >= 1 && scelta <= 6) {
       std::cout << "\nVuoi eseguire un altro test? (s/n): ";
       std::string risposta;
       std::cin >> risposta;
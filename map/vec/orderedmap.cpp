@@ -0,0 +1,287 @@
+#include <algorithm>
+#include <bit>
+#include <utility>
+
+namespace lasd {
+
+/* ************************************************************************** */
+/* Copy and move */
+
+template <typename Key, typename Value>
+OrderedMap<Key, Value>::OrderedMap(const OrderedMap& other) {
+  // Already sorted: copy straight into arrays starting at 0
+  if (other.size > 0) {
+    capacity = std::bit_ceil(other.size);
+    keys = new Key[capacity];
+    values = new Value[capacity];
+    for (unsigned long i = 0; i < other.size; ++i) {
+      const unsigned long slot = other.CircularIndex(i);
+      keys[i] = other.keys[slot];
+      values[i] = other.values[slot];
+    }
+    size = other.size;
+  }
+}
+
+template <typename Key, typename Value>
+OrderedMap<Key, Value>::OrderedMap(OrderedMap&& other) noexcept {
+  std::swap(keys, other.keys);
+  std::swap(values, other.values);
+  std::swap(head, other.head);
+  std::swap(size, other.size);
+  std::swap(capacity, other.capacity);
+}
+
+template <typename Key, typename Value>
+OrderedMap<Key, Value>::~OrderedMap() {
+  delete[] keys;
+  delete[] values;
+}
+
+template <typename Key, typename Value>
+OrderedMap<Key, Value>& OrderedMap<Key, Value>::operator=(const OrderedMap& other) {
+  if (this != &other) {
+    OrderedMap tmp(other);
+    std::swap(*this, tmp);
+  }
+  return *this;
+}
+
+template <typename Key, typename Value>
+OrderedMap<Key, Value>& OrderedMap<Key, Value>::operator=(OrderedMap&& other) noexcept {
+  std::swap(keys, other.keys);
+  std::swap(values, other.values);
+  std::swap(head, other.head);
+  std::swap(size, other.size);
+  std::swap(capacity, other.capacity);
+  return *this;
+}
+
+/* ************************************************************************** */
+/* Comparison operators */
+
+template <typename Key, typename Value>
+bool OrderedMap<Key, Value>::operator==(const OrderedMap& other) const noexcept {
+  if (size != other.size) return false;
+  for (unsigned long i = 0; i < size; ++i) {
+    const unsigned long mine = CircularIndex(i);
+    const unsigned long theirs = other.CircularIndex(i);
+    if (keys[mine] != other.keys[theirs] || values[mine] != other.values[theirs]) return false;
+  }
+  return true;
+}
+
+template <typename Key, typename Value>
+bool OrderedMap<Key, Value>::operator!=(const OrderedMap& other) const noexcept {
+  return !(*this == other);
+}
+
+/* ************************************************************************** */
+/* Insert / Remove */
+
+template <typename Key, typename Value>
+bool OrderedMap<Key, Value>::Insert(const Key& key, const Value& val) {
+  const unsigned long index = LowerIndex(key);
+  if (index < size && !(key < keys[CircularIndex(index)])) return false;
+  OpenGap(index);
+  const unsigned long slot = CircularIndex(index);
+  keys[slot] = key;
+  values[slot] = val;
+  return true;
+}
+
+template <typename Key, typename Value>
+bool OrderedMap<Key, Value>::Insert(Key&& key, Value&& val) {
+  const unsigned long index = LowerIndex(key);
+  if (index < size && !(key < keys[CircularIndex(index)])) return false;
+  OpenGap(index);
+  const unsigned long slot = CircularIndex(index);
+  keys[slot] = std::move(key);
+  values[slot] = std::move(val);
+  return true;
+}
+
+template <typename Key, typename Value>
+bool OrderedMap<Key, Value>::Remove(const Key& key) {
+  const long index = FindIndex(key);
+  if (index == -1) return false;
+
+  RemoveAt(index);
+
+  if (size < capacity / 4 && capacity > 1)
+    Relocate(capacity / 2);
+
+  return true;
+}
+
+/* ************************************************************************** */
+/* Lookup */
+
+template <typename Key, typename Value>
+bool OrderedMap<Key, Value>::Exists(const Key& key) const noexcept {
+  return FindIndex(key) != -1;
+}
+
+template <typename Key, typename Value>
+const Value& OrderedMap<Key, Value>::Find(const Key& key) const {
+  const long index = FindIndex(key);
+  if (index == -1) throw std::length_error("Key not found");
+  return values[CircularIndex(index)];
+}
+
+template <typename Key, typename Value>
+Value& OrderedMap<Key, Value>::Find(const Key& key) {
+  const long index = FindIndex(key);
+  if (index == -1) throw std::length_error("Key not found");
+  return values[CircularIndex(index)];
+}
+
+/* ************************************************************************** */
+/* Min / Max */
+
+template <typename Key, typename Value>
+const Key& OrderedMap<Key, Value>::Min() const {
+  if (size == 0) throw std::length_error("Empty map");
+  return keys[head];
+}
+
+template <typename Key, typename Value>
+const Key& OrderedMap<Key, Value>::Max() const {
+  if (size == 0) throw std::length_error("Empty map");
+  return keys[CircularIndex(size - 1)];
+}
+
+/* ************************************************************************** */
+/* Predecessor / Successor */
+
+template <typename Key, typename Value>
+const Key& OrderedMap<Key, Value>::Predecessor(const Key& key) const {
+  const unsigned long index = LowerIndex(key);
+  if (index == 0) throw std::length_error("No predecessor");
+  return keys[CircularIndex(index - 1)];
+}
+
+template <typename Key, typename Value>
+const Key& OrderedMap<Key, Value>::Successor(const Key& key) const {
+  const unsigned long index = UpperIndex(key);
+  if (index == size) throw std::length_error("No successor");
+  return keys[CircularIndex(index)];
+}
+
+/* ************************************************************************** */
+/* Positional access */
+
+template <typename Key, typename Value>
+const Key& OrderedMap<Key, Value>::KeyAt(unsigned long index) const {
+  if (index >= size) throw std::out_of_range("Index out of range");
+  return keys[CircularIndex(index)];
+}
+
+template <typename Key, typename Value>
+const Value& OrderedMap<Key, Value>::ValueAt(unsigned long index) const {
+  if (index >= size) throw std::out_of_range("Index out of range");
+  return values[CircularIndex(index)];
+}
+
+template <typename Key, typename Value>
+Value& OrderedMap<Key, Value>::ValueAt(unsigned long index) {
+  if (index >= size) throw std::out_of_range("Index out of range");
+  return values[CircularIndex(index)];
+}
+
+/* ************************************************************************** */
+/* Traverse / Map */
+
+template <typename Key, typename Value>
+void OrderedMap<Key, Value>::Traverse(TraverseFun fun) const {
+  const unsigned long first = FirstSegment();
+  for (unsigned long i = head; i < head + first; ++i) fun(keys[i], values[i]);
+  for (unsigned long i = 0; i < size - first; ++i) fun(keys[i], values[i]);
+}
+
+template <typename Key, typename Value>
+void OrderedMap<Key, Value>::Map(MapFun fun) {
+  const unsigned long first = FirstSegment();
+  for (unsigned long i = head; i < head + first; ++i) fun(keys[i], values[i]);
+  for (unsigned long i = 0; i < size - first; ++i) fun(keys[i], values[i]);
+}
+
+/* ************************************************************************** */
+/* Clear */
+
+template <typename Key, typename Value>
+void OrderedMap<Key, Value>::Clear() {
+  delete[] keys;
+  delete[] values;
+  keys = nullptr;
+  values = nullptr;
+  size = 0;
+  capacity = 0;
+  head = 0;
+}
+
+/* ************************************************************************** */
+
+// Auxiliary functions
+
+template <typename Key, typename Value>
+unsigned long OrderedMap<Key, Value>::CircularIndex(unsigned long index) const noexcept {
+  return CircularSlot(head, index, capacity); // Capacity is always a power of two
+}
+
+template <typename Key, typename Value>
+unsigned long OrderedMap<Key, Value>::FirstSegment() const noexcept {
+  return CircularFirstSegment(head, size, capacity);
+}
+
+template <typename Key, typename Value>
+unsigned long OrderedMap<Key, Value>::LowerIndex(const Key& key) const {
+  return CircularLowerIndex(keys, head, size, capacity, key);
+}
+
+template <typename Key, typename Value>
+unsigned long OrderedMap<Key, Value>::UpperIndex(const Key& key) const {
+  return CircularUpperIndex(keys, head, size, capacity, key);
+}
+
+template <typename Key, typename Value>
+long OrderedMap<Key, Value>::FindIndex(const Key& key) const {
+  const unsigned long index = LowerIndex(key);
+  return (index < size && !(key < keys[CircularIndex(index)])) ? static_cast<long>(index) : -1;
+}
+
+template <typename Key, typename Value>
+void OrderedMap<Key, Value>::Relocate(unsigned long newCap) {
+  Key* newKeys = new Key[newCap];
+  Value* newValues = new Value[newCap];
+  for (unsigned long i = 0; i < size; ++i) {
+    const unsigned long slot = CircularIndex(i);
+    newKeys[i] = std::move(keys[slot]);
+    newValues[i] = std::move(values[slot]);
+  }
+  delete[] keys;
+  delete[] values;
+  keys = newKeys;
+  values = newValues;
+  capacity = newCap;
+  head = 0;
+}
+
+template <typename Key, typename Value>
+void OrderedMap<Key, Value>::OpenGap(unsigned long index) {
+  if (size == capacity) {
+    Relocate(capacity == 0 ? 1 : capacity * 2);
+  }
+  CircularOpenGap(head, size, capacity, index, keys, values);
+  ++size;
+}
+
+template <typename Key, typename Value>
+void OrderedMap<Key, Value>::RemoveAt(unsigned long index) {
+  CircularRemoveAt(head, size, capacity, index, keys, values);
+  --size;
+}
+
+/* ************************************************************************** */
+
+}
@@ -0,0 +1,127 @@
+#ifndef ORDEREDMAP_HPP
+#define ORDEREDMAP_HPP
+
+/* ************************************************************************** */
+
+#include "../../container/container.hpp"
+#include "../../set/vec/circular.hpp"
+#include <functional>
+#include <stdexcept>
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Sorted map from Key to Value on the same circular buffer as SetVec (the
+// shifts and searches in circular.hpp): a power-of-two capacity, a moving
+// head, insertions and removals that shift the shorter side, and a binary
+// search over the run that can hold the key.
+// Keys and values live in two parallel arrays, so a search only reads keys
+// and the values are touched once the slot is known.
+template <typename Key, typename Value>
+class OrderedMap : public virtual ClearableContainer {
+  // Must extend ClearableContainer
+
+private:
+
+  Key* keys = nullptr;        // Sorted, starting at head and wrapping around
+  Value* values = nullptr;    // values[i] belongs to keys[i]
+  unsigned long head = 0;     // Slot of the smallest key
+  unsigned long capacity = 0; // Slots in each array: zero or a power of two
+
+protected:
+
+  using Container::size;
+
+public:
+
+  // Default constructor
+  OrderedMap() = default;
+
+  /* ************************************************************************ */
+
+  // Copy constructor
+  OrderedMap(const OrderedMap&);
+
+  // Move constructor
+  OrderedMap(OrderedMap&&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Destructor
+  virtual ~OrderedMap();
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  OrderedMap& operator=(const OrderedMap&);
+
+  // Move assignment
+  OrderedMap& operator=(OrderedMap&&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Comparison operators
+  bool operator==(const OrderedMap&) const noexcept;
+  bool operator!=(const OrderedMap&) const noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member functions
+
+  bool Insert(const Key&, const Value&); // False (and nothing changes) if the key is already there
+  bool Insert(Key&&, Value&&);
+  bool Remove(const Key&);
+
+  bool Exists(const Key&) const noexcept;
+  const Value& Find(const Key&) const; // (throw std::length_error when the key is missing)
+  Value& Find(const Key&);             // (throw std::length_error when the key is missing)
+
+  const Key& Min() const; // (throw std::length_error when empty)
+  const Key& Max() const; // (throw std::length_error when empty)
+
+  const Key& Predecessor(const Key&) const; // Largest key below (throw std::length_error when not found)
+  const Key& Successor(const Key&) const;   // Smallest key above (throw std::length_error when not found)
+
+  // Positional access in key order (throw std::out_of_range)
+  const Key& KeyAt(unsigned long) const;
+  const Value& ValueAt(unsigned long) const;
+  Value& ValueAt(unsigned long);
+
+  using TraverseFun = std::function<void(const Key&, const Value&)>;
+  void Traverse(TraverseFun) const; // In key order
+
+  using MapFun = std::function<void(const Key&, Value&)>;
+  void Map(MapFun); // In key order; only the values may change
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from ClearableContainer)
+
+  void Clear() override;
+
+protected:
+
+  // Auxiliary functions, if necessary!
+
+  unsigned long CircularIndex(unsigned long) const noexcept;
+  unsigned long FirstSegment() const noexcept;  // Length of the run from head to the end of the arrays
+  unsigned long LowerIndex(const Key&) const;   // First index whose key is not below the given one
+  unsigned long UpperIndex(const Key&) const;   // First index whose key is above the given one
+  long FindIndex(const Key&) const;             // -1 if missing
+
+  void Relocate(unsigned long);   // New capacity (a power of two), with the keys from slot 0
+  void OpenGap(unsigned long);    // Makes room at the given index, shifting the shorter side
+  void RemoveAt(unsigned long);   // Closes the gap from the shorter side
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "orderedmap.cpp"
+
+#endif
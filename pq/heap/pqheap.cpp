@@ -16,6 +16,13 @@ PQHeap<Data>::PQHeap(MappableContainer<Data>&& cont) : HeapVec<Data>(std::move(c
   this->capacity = cont.Size();
 }
 
+// Costruttore da un input range qualsiasi
+template <typename Data>
+template <ForeignInputRange<Data> Range>
+PQHeap<Data>::PQHeap(Range&& range) : HeapVec<Data>(std::forward<Range>(range)) {
+  this->capacity = size;
+}
+
 /* ************************************************************************** */
 
 // Tip (massimo)
@@ -58,6 +65,7 @@ void PQHeap<Data>::Insert(const Data& dat) {
     Resize((capacity == 0) ? 1 : capacity * 2);
 
   Vector<Data>::elements_[size] = dat; 
+  Vector<Data>::Touch(size);
   ++size;
   HeapifyUp(size - 1);
 }
@@ -71,6 +79,7 @@ void PQHeap<Data>::Insert(Data&& dat) {
     Resize((capacity == 0) ? 1 : capacity * 2);
 
   Vector<Data>::elements_[size] = std::move(dat); 
+  Vector<Data>::Touch(size);
   ++size;
   HeapifyUp(size - 1);
 }
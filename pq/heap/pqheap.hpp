@@ -39,6 +39,9 @@ public:
   PQHeap(const TraversableContainer<Data>&); // Costruisce da container
   PQHeap(MappableContainer<Data>&&);         // Costruisce da container rvalue
 
+  template <ForeignInputRange<Data> Range>
+  PQHeap(Range&&);                           // Costruisce da un input range qualsiasi
+
   /* ************************************************************************ */
 
   // Copy constructor
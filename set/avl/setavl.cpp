@@ -0,0 +1,593 @@
+#include <utility>
+
+namespace lasd {
+
+/* ************************************************************************** */
+/* Constructors */
+
+template <typename Data>
+SetAVL<Data>::SetAVL(const TraversableContainer<Data>& container) {
+  container.Traverse([this](const Data& dat) {
+    Insert(dat);
+  });
+}
+
+template <typename Data>
+SetAVL<Data>::SetAVL(MappableContainer<Data>&& container) {
+  container.Map([this](Data& dat) {
+    Insert(std::move(dat));
+  });
+}
+
+template <typename Data>
+template <ForeignInputRange<Data> Range>
+SetAVL<Data>::SetAVL(Range&& range) {
+  for (auto&& dat : range) {
+    Insert(std::forward<decltype(dat)>(dat));
+  }
+}
+
+template <typename Data>
+SetAVL<Data>::SetAVL(const SetAVL& other) {
+  // Already sorted: build a perfectly balanced tree in one in-order walk
+  Cursor cursor(other.root);
+  root = Build(other.size, cursor);
+  size = other.size;
+}
+
+template <typename Data>
+SetAVL<Data>::SetAVL(SetAVL&& other) noexcept {
+  std::swap(root, other.root);
+  std::swap(size, other.size);
+  std::swap(chunks, other.chunks);
+  std::swap(chunkCount, other.chunkCount);
+  std::swap(nextChunk, other.nextChunk);
+  std::swap(freeNodes, other.freeNodes);
+}
+
+/* ************************************************************************** */
+/* Destructor */
+
+template <typename Data>
+SetAVL<Data>::~SetAVL() {
+  ReleasePool();
+}
+
+/* ************************************************************************** */
+/* Assignment operators */
+
+template <typename Data>
+SetAVL<Data>& SetAVL<Data>::operator=(const SetAVL& other) {
+  if (this != &other) {
+    SetAVL tmp(other);
+    std::swap(*this, tmp);
+  }
+  return *this;
+}
+
+template <typename Data>
+SetAVL<Data>& SetAVL<Data>::operator=(SetAVL&& other) noexcept {
+  std::swap(root, other.root);
+  std::swap(size, other.size);
+  std::swap(chunks, other.chunks);
+  std::swap(chunkCount, other.chunkCount);
+  std::swap(nextChunk, other.nextChunk);
+  std::swap(freeNodes, other.freeNodes);
+  return *this;
+}
+
+/* ************************************************************************** */
+/* Comparison operators */
+
+template <typename Data>
+bool SetAVL<Data>::operator==(const SetAVL& other) const {
+  if (size != other.size) return false;
+  Cursor mine(root);
+  Cursor theirs(other.root);
+  for (const Node* node = mine.Next(); node != nullptr; node = mine.Next()) {
+    if (node->element != theirs.Next()->element) return false;
+  }
+  return true;
+}
+
+template <typename Data>
+bool SetAVL<Data>::operator!=(const SetAVL& other) const {
+  return !(*this == other);
+}
+
+/* ************************************************************************** */
+/* OrderedDictionary functions */
+
+template <typename Data>
+const Data& SetAVL<Data>::Min() const {
+  if (root == nullptr) throw std::length_error("Empty set");
+  const Node* node = root;
+  while (node->left != nullptr) node = node->left;
+  return node->element;
+}
+
+template <typename Data>
+Data SetAVL<Data>::MinNRemove() {
+  if (root == nullptr) throw std::length_error("Empty set");
+  Node* min = nullptr;
+  root = RemoveLeftmost(root, min);
+  Data tmp = std::move(min->element);
+  FreeNode(min);
+  --size;
+  return tmp;
+}
+
+template <typename Data>
+void SetAVL<Data>::RemoveMin() {
+  (void)MinNRemove();
+}
+
+template <typename Data>
+const Data& SetAVL<Data>::Max() const {
+  if (root == nullptr) throw std::length_error("Empty set");
+  const Node* node = root;
+  while (node->right != nullptr) node = node->right;
+  return node->element;
+}
+
+template <typename Data>
+Data SetAVL<Data>::MaxNRemove() {
+  Data tmp = Max();
+  Remove(tmp);
+  return tmp;
+}
+
+template <typename Data>
+void SetAVL<Data>::RemoveMax() {
+  (void)MaxNRemove();
+}
+
+template <typename Data>
+const Data& SetAVL<Data>::Predecessor(const Data& dat) const {
+  const Node* node = FindPredecessor(dat);
+  if (node == nullptr) throw std::length_error("No predecessor");
+  return node->element;
+}
+
+template <typename Data>
+Data SetAVL<Data>::PredecessorNRemove(const Data& dat) {
+  Data tmp = Predecessor(dat);
+  Remove(tmp);
+  return tmp;
+}
+
+template <typename Data>
+void SetAVL<Data>::RemovePredecessor(const Data& dat) {
+  (void)PredecessorNRemove(dat);
+}
+
+template <typename Data>
+const Data& SetAVL<Data>::Successor(const Data& dat) const {
+  const Node* node = FindUpper(dat);
+  if (node == nullptr) throw std::length_error("No successor");
+  return node->element;
+}
+
+template <typename Data>
+Data SetAVL<Data>::SuccessorNRemove(const Data& dat) {
+  Data tmp = Successor(dat);
+  Remove(tmp);
+  return tmp;
+}
+
+template <typename Data>
+void SetAVL<Data>::RemoveSuccessor(const Data& dat) {
+  (void)SuccessorNRemove(dat);
+}
+
+/* ************************************************************************** */
+/* Range queries */
+
+template <typename Data>
+const Data& SetAVL<Data>::LowerBound(const Data& dat) const {
+  const Node* node = FindLower(dat);
+  if (node == nullptr) throw std::length_error("No lower bound");
+  return node->element;
+}
+
+template <typename Data>
+const Data& SetAVL<Data>::UpperBound(const Data& dat) const {
+  const Node* node = FindUpper(dat);
+  if (node == nullptr) throw std::length_error("No upper bound");
+  return node->element;
+}
+
+template <typename Data>
+void SetAVL<Data>::RangeTraverse(const Data& lo, const Data& hi, RangeFun fun) const {
+  if (lo < hi) InRange(root, lo, hi, fun);
+}
+
+template <typename Data>
+unsigned long SetAVL<Data>::RangeCount(const Data& lo, const Data& hi) const {
+  if (!(lo < hi)) return 0;
+  return Rank(hi) - Rank(lo);
+}
+
+template <typename Data>
+unsigned long SetAVL<Data>::RangeRemove(const Data& lo, const Data& hi) {
+  unsigned long removed = 0;
+  for (const Node* node = FindLower(lo); node != nullptr && node->element < hi; node = FindLower(lo)) {
+    Data victim = node->element;
+    Remove(victim);
+    ++removed;
+  }
+  return removed;
+}
+
+/* ************************************************************************** */
+/* Dictionary functions */
+
+template <typename Data>
+bool SetAVL<Data>::Insert(const Data& dat) {
+  bool inserted = false;
+  root = InsertNode(root, dat, inserted);
+  size += inserted;
+  return inserted;
+}
+
+template <typename Data>
+bool SetAVL<Data>::Insert(Data&& dat) {
+  bool inserted = false;
+  root = InsertNode(root, std::move(dat), inserted);
+  size += inserted;
+  return inserted;
+}
+
+template <typename Data>
+bool SetAVL<Data>::Remove(const Data& dat) {
+  bool removed = false;
+  root = RemoveNode(root, dat, removed);
+  size -= removed;
+  return removed;
+}
+
+/* ************************************************************************** */
+/* LinearContainer functions */
+
+template <typename Data>
+const Data& SetAVL<Data>::operator[](unsigned long index) const {
+  if (index >= size) throw std::out_of_range("Index out of range");
+  const Node* node = root;
+  while (true) {
+    unsigned long left = Count(node->left);
+    if (index < left) {
+      node = node->left;
+    } else if (index > left) {
+      index -= left + 1;
+      node = node->right;
+    } else {
+      return node->element;
+    }
+  }
+}
+
+/* ************************************************************************** */
+/* TraversableContainer functions */
+
+template <typename Data>
+void SetAVL<Data>::Traverse(TraverseFun fun) const {
+  InOrder(root, fun);
+}
+
+template <typename Data>
+void SetAVL<Data>::PreOrderTraverse(TraverseFun fun) const {
+  InOrder(root, fun);
+}
+
+template <typename Data>
+void SetAVL<Data>::PostOrderTraverse(TraverseFun fun) const {
+  ReverseOrder(root, fun);
+}
+
+/* ************************************************************************** */
+/* TestableContainer function */
+
+template <typename Data>
+bool SetAVL<Data>::Exists(const Data& dat) const noexcept {
+  const Node* node = FindLower(dat);
+  return (node != nullptr && !(dat < node->element));
+}
+
+/* ************************************************************************** */
+/* ClearableContainer / ResizableContainer functions */
+
+template <typename Data>
+void SetAVL<Data>::Clear() {
+  ReleasePool();
+}
+
+template <typename Data>
+void SetAVL<Data>::Resize(unsigned long newSize) {
+  if (newSize == 0) {
+    Clear();
+    return;
+  }
+  while (size > newSize) {
+    RemoveMax();
+  }
+}
+
+/* ************************************************************************** */
+
+// Auxiliary functions
+
+/* Pool */
+
+template <typename Data>
+typename SetAVL<Data>::Node* SetAVL<Data>::NewNode() {
+  if (freeNodes == nullptr) {
+    // Grab a new chunk and thread it onto the free list
+    Node* chunk = new Node[nextChunk];
+    if (chunkCount == chunks.Size()) {
+      chunks.Resize(chunkCount == 0 ? 8 : chunkCount * 2);
+    }
+    chunks[chunkCount++] = chunk;
+    for (unsigned long i = nextChunk; i > 0; --i) {
+      chunk[i - 1].right = freeNodes;
+      freeNodes = &chunk[i - 1];
+    }
+    if (nextChunk < MaxChunk) nextChunk *= 2;
+  }
+
+  Node* node = freeNodes;
+  freeNodes = node->right;
+  node->left = node->right = nullptr;
+  node->count = 1;
+  node->height = 1;
+  return node;
+}
+
+template <typename Data>
+void SetAVL<Data>::FreeNode(Node* node) noexcept {
+  node->element = Data(); // Release what the value holds now, not when the slot is reused
+  node->right = freeNodes;
+  freeNodes = node;
+}
+
+template <typename Data>
+void SetAVL<Data>::ReleasePool() noexcept {
+  for (unsigned long i = 0; i < chunkCount; ++i) {
+    delete[] chunks[i];
+  }
+  chunks.Clear();
+  chunkCount = 0;
+  nextChunk = FirstChunk;
+  freeNodes = nullptr;
+  root = nullptr;
+  size = 0;
+}
+
+/* Tree maintenance */
+
+template <typename Data>
+int SetAVL<Data>::Height(const Node* node) noexcept {
+  return (node == nullptr) ? 0 : node->height;
+}
+
+template <typename Data>
+unsigned long SetAVL<Data>::Count(const Node* node) noexcept {
+  return (node == nullptr) ? 0 : node->count;
+}
+
+template <typename Data>
+void SetAVL<Data>::Update(Node* node) noexcept {
+  int left = Height(node->left);
+  int right = Height(node->right);
+  node->height = 1 + (left > right ? left : right);
+  node->count = 1 + Count(node->left) + Count(node->right);
+}
+
+template <typename Data>
+typename SetAVL<Data>::Node* SetAVL<Data>::RotateLeft(Node* node) noexcept {
+  Node* pivot = node->right;
+  node->right = pivot->left;
+  pivot->left = node;
+  Update(node);
+  Update(pivot);
+  return pivot;
+}
+
+template <typename Data>
+typename SetAVL<Data>::Node* SetAVL<Data>::RotateRight(Node* node) noexcept {
+  Node* pivot = node->left;
+  node->left = pivot->right;
+  pivot->right = node;
+  Update(node);
+  Update(pivot);
+  return pivot;
+}
+
+template <typename Data>
+typename SetAVL<Data>::Node* SetAVL<Data>::Rebalance(Node* node) noexcept {
+  Update(node);
+  int balance = Height(node->left) - Height(node->right);
+  if (balance > 1) {
+    if (Height(node->left->left) < Height(node->left->right)) node->left = RotateLeft(node->left);
+    return RotateRight(node);
+  }
+  if (balance < -1) {
+    if (Height(node->right->right) < Height(node->right->left)) node->right = RotateRight(node->right);
+    return RotateLeft(node);
+  }
+  return node;
+}
+
+template <typename Data>
+template <typename Value>
+typename SetAVL<Data>::Node* SetAVL<Data>::InsertNode(Node* node, Value&& dat, bool& inserted) {
+  if (node == nullptr) {
+    Node* fresh = NewNode();
+    fresh->element = std::forward<Value>(dat);
+    inserted = true;
+    return fresh;
+  }
+  if (dat < node->element) {
+    node->left = InsertNode(node->left, std::forward<Value>(dat), inserted);
+  } else if (node->element < dat) {
+    node->right = InsertNode(node->right, std::forward<Value>(dat), inserted);
+  } else {
+    return node;
+  }
+  return inserted ? Rebalance(node) : node;
+}
+
+template <typename Data>
+typename SetAVL<Data>::Node* SetAVL<Data>::RemoveLeftmost(Node* node, Node*& min) {
+  if (node->left == nullptr) {
+    min = node;
+    return node->right;
+  }
+  node->left = RemoveLeftmost(node->left, min);
+  return Rebalance(node);
+}
+
+template <typename Data>
+typename SetAVL<Data>::Node* SetAVL<Data>::RemoveNode(Node* node, const Data& dat, bool& removed) {
+  if (node == nullptr) return nullptr;
+  if (dat < node->element) {
+    node->left = RemoveNode(node->left, dat, removed);
+  } else if (node->element < dat) {
+    node->right = RemoveNode(node->right, dat, removed);
+  } else {
+    removed = true;
+    Node* replacement;
+    if (node->left == nullptr || node->right == nullptr) {
+      replacement = (node->left != nullptr) ? node->left : node->right;
+    } else {
+      // Two children: the successor node takes this node's place
+      Node* successor = nullptr;
+      Node* right = RemoveLeftmost(node->right, successor);
+      successor->left = node->left;
+      successor->right = right;
+      replacement = Rebalance(successor);
+    }
+    FreeNode(node);
+    return replacement;
+  }
+  return removed ? Rebalance(node) : node;
+}
+
+/* Queries */
+
+template <typename Data>
+SetAVL<Data>::Cursor::Cursor(const Node* node) noexcept {
+  Descend(node);
+}
+
+template <typename Data>
+void SetAVL<Data>::Cursor::Descend(const Node* node) noexcept {
+  for (; node != nullptr; node = node->left) stack[top++] = node;
+}
+
+template <typename Data>
+const typename SetAVL<Data>::Node* SetAVL<Data>::Cursor::Next() noexcept {
+  if (top == 0) return nullptr;
+  const Node* node = stack[--top];
+  Descend(node->right);
+  return node;
+}
+
+template <typename Data>
+typename SetAVL<Data>::Node* SetAVL<Data>::Build(unsigned long count, Cursor& cursor) {
+  if (count == 0) return nullptr;
+  unsigned long leftCount = count / 2;
+  Node* left = Build(leftCount, cursor);
+  Node* node = NewNode();
+  node->element = cursor.Next()->element;
+  node->left = left;
+  node->right = Build(count - leftCount - 1, cursor);
+  Update(node);
+  return node;
+}
+
+template <typename Data>
+unsigned long SetAVL<Data>::Rank(const Data& dat) const {
+  unsigned long rank = 0;
+  for (const Node* node = root; node != nullptr; ) {
+    if (node->element < dat) {
+      rank += Count(node->left) + 1;
+      node = node->right;
+    } else {
+      node = node->left;
+    }
+  }
+  return rank;
+}
+
+template <typename Data>
+const typename SetAVL<Data>::Node* SetAVL<Data>::FindLower(const Data& dat) const {
+  const Node* found = nullptr;
+  for (const Node* node = root; node != nullptr; ) {
+    if (node->element < dat) {
+      node = node->right;
+    } else {
+      found = node;
+      node = node->left;
+    }
+  }
+  return found;
+}
+
+template <typename Data>
+const typename SetAVL<Data>::Node* SetAVL<Data>::FindUpper(const Data& dat) const {
+  const Node* found = nullptr;
+  for (const Node* node = root; node != nullptr; ) {
+    if (dat < node->element) {
+      found = node;
+      node = node->left;
+    } else {
+      node = node->right;
+    }
+  }
+  return found;
+}
+
+template <typename Data>
+const typename SetAVL<Data>::Node* SetAVL<Data>::FindPredecessor(const Data& dat) const {
+  const Node* found = nullptr;
+  for (const Node* node = root; node != nullptr; ) {
+    if (node->element < dat) {
+      found = node;
+      node = node->right;
+    } else {
+      node = node->left;
+    }
+  }
+  return found;
+}
+
+template <typename Data>
+void SetAVL<Data>::InOrder(const Node* node, const TraverseFun& fun) {
+  Cursor cursor(node);
+  for (const Node* curr = cursor.Next(); curr != nullptr; curr = cursor.Next()) {
+    fun(curr->element);
+  }
+}
+
+template <typename Data>
+void SetAVL<Data>::ReverseOrder(const Node* node, const TraverseFun& fun) {
+  if (node == nullptr) return;
+  ReverseOrder(node->right, fun);
+  fun(node->element);
+  ReverseOrder(node->left, fun);
+}
+
+template <typename Data>
+void SetAVL<Data>::InRange(const Node* node, const Data& lo, const Data& hi, const RangeFun& fun) {
+  // Prune the subtrees that lie entirely outside [lo, hi)
+  if (node == nullptr) return;
+  bool aboveLo = !(node->element < lo);
+  bool belowHi = node->element < hi;
+  if (aboveLo) InRange(node->left, lo, hi, fun);
+  if (aboveLo && belowHi) fun(node->element);
+  if (belowHi) InRange(node->right, lo, hi, fun);
+}
+
+/* ************************************************************************** */
+
+} // namespace lasd
@@ -0,0 +1,280 @@
+#ifndef SETAVL_HPP
+#define SETAVL_HPP
+
+/* ************************************************************************** */
+
+#include "../set.hpp"
+#include "../../vector/vector.hpp"
+#include <compare>
+#include <iterator>
+#include <stdexcept>
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+template <typename Data>
+class SetAVL : public virtual Set<Data>,
+               public virtual ResizableContainer {
+  // Must extend Set<Data>,
+  //             ResizableContainer
+
+private:
+
+  struct Node {
+
+    Data element{};
+    Node* left = nullptr;
+    Node* right = nullptr;       // Also links the free nodes of the pool
+    unsigned long count = 1;     // Nodes in this subtree (for select and rank)
+    int height = 1;
+
+  };
+
+  Node* root = nullptr;
+
+  // Node pool: chunks of growing size, recycled through a free list
+  static constexpr unsigned long FirstChunk = 16;
+  static constexpr unsigned long MaxChunk = 4096;
+  static constexpr unsigned long MaxHeight = 96; // An AVL tree of 2^64 nodes is shallower
+
+  Vector<Node*> chunks;
+  unsigned long chunkCount = 0;
+  unsigned long nextChunk = FirstChunk;
+  Node* freeNodes = nullptr;
+
+protected:
+
+  using Container::size;
+
+public:
+
+  // Bring base class methods into scope
+  using LinearContainer<Data>::operator==;
+  using LinearContainer<Data>::operator!=;
+  using DictionaryContainer<Data>::InsertAll;
+  using DictionaryContainer<Data>::InsertSome;
+
+  /* ************************************************************************ */
+
+  // Random-access iterator by rank (read-only: elements must stay ordered; each step is O(log n))
+  class ConstIterator {
+
+  private:
+
+    const SetAVL* set = nullptr;
+    unsigned long index = 0;
+
+  public:
+
+    using iterator_concept = std::random_access_iterator_tag;
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = Data;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Data*;
+    using reference = const Data&;
+
+    ConstIterator() = default;
+    ConstIterator(const SetAVL* st, unsigned long idx) noexcept : set(st), index(idx) {}
+
+    reference operator*() const { return (*set)[index]; }
+    pointer operator->() const { return &**this; }
+    reference operator[](difference_type off) const { return *(*this + off); }
+
+    ConstIterator& operator++() noexcept { ++index; return *this; }
+    ConstIterator operator++(int) noexcept { ConstIterator tmp = *this; ++index; return tmp; }
+    ConstIterator& operator--() noexcept { --index; return *this; }
+    ConstIterator operator--(int) noexcept { ConstIterator tmp = *this; --index; return tmp; }
+
+    ConstIterator& operator+=(difference_type off) noexcept { index += off; return *this; }
+    ConstIterator& operator-=(difference_type off) noexcept { index -= off; return *this; }
+
+    friend ConstIterator operator+(ConstIterator it, difference_type off) noexcept { return it += off; }
+    friend ConstIterator operator+(difference_type off, ConstIterator it) noexcept { return it += off; }
+    friend ConstIterator operator-(ConstIterator it, difference_type off) noexcept { return it -= off; }
+    friend difference_type operator-(const ConstIterator& it1, const ConstIterator& it2) noexcept {
+      return static_cast<difference_type>(it1.index) - static_cast<difference_type>(it2.index);
+    }
+
+    friend bool operator==(const ConstIterator& it1, const ConstIterator& it2) noexcept { return it1.index == it2.index; }
+    friend std::strong_ordering operator<=>(const ConstIterator& it1, const ConstIterator& it2) noexcept { return it1.index <=> it2.index; }
+
+  };
+
+  using const_iterator = ConstIterator;
+  using iterator = ConstIterator;
+
+  /* ************************************************************************ */
+
+  // Default constructor
+  SetAVL() = default;
+
+  /* ************************************************************************ */
+
+  // Specific constructors
+  SetAVL(const TraversableContainer<Data>&); // Copy from TraversableContainer
+  SetAVL(MappableContainer<Data>&&);         // Move from MappableContainer
+
+  template <ForeignInputRange<Data> Range>
+  SetAVL(Range&&);                           // Copy (or move, for prvalue elements) from any input range
+
+  /* ************************************************************************ */
+
+  // Copy constructor
+  SetAVL(const SetAVL&);
+
+  // Move constructor
+  SetAVL(SetAVL&&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Destructor
+  ~SetAVL();
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  SetAVL& operator=(const SetAVL&);
+
+  // Move assignment
+  SetAVL& operator=(SetAVL&&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Comparison operators
+  bool operator==(const SetAVL&) const;
+  bool operator!=(const SetAVL&) const;
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from OrderedDictionaryContainer)
+
+  const Data& Min() const override;
+  Data MinNRemove() override;
+  void RemoveMin() override;
+
+  const Data& Max() const override;
+  Data MaxNRemove() override;
+  void RemoveMax() override;
+
+  const Data& Predecessor(const Data&) const override;
+  Data PredecessorNRemove(const Data&) override;
+  void RemovePredecessor(const Data&) override;
+
+  const Data& Successor(const Data&) const override;
+  Data SuccessorNRemove(const Data&) override;
+  void RemoveSuccessor(const Data&) override;
+
+  using typename OrderedDictionaryContainer<Data>::RangeFun;
+  const Data& LowerBound(const Data&) const override;
+  const Data& UpperBound(const Data&) const override;
+  void RangeTraverse(const Data&, const Data&, RangeFun) const override;
+  unsigned long RangeCount(const Data&, const Data&) const override;
+  unsigned long RangeRemove(const Data&, const Data&) override;
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from DictionaryContainer)
+
+  bool Insert(const Data&) override; // Copy
+  bool Insert(Data&&) override;      // Move
+  bool Remove(const Data&) override;
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from LinearContainer)
+
+  const Data& operator[](unsigned long) const override; // Select by rank, O(log n)
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from TraversableContainer)
+
+  using typename TraversableContainer<Data>::TraverseFun;
+  void Traverse(TraverseFun) const override;
+  void PreOrderTraverse(TraverseFun) const override;  // Ascending order
+  void PostOrderTraverse(TraverseFun) const override; // Descending order
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from TestableContainer)
+
+  bool Exists(const Data&) const noexcept override;
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from ClearableContainer)
+
+  void Clear() override;
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from ResizableContainer)
+
+  // Resize the container to the given size by removing the largest elements if the size is reduced.
+  void Resize(unsigned long) override;
+
+  /* ************************************************************************ */
+
+  // Iterators
+  const_iterator begin() const noexcept { return ConstIterator(this, 0); }
+  const_iterator end() const noexcept { return ConstIterator(this, size); }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
+
+protected:
+
+  // Auxiliary functions, if necessary!
+
+  // Pool
+  Node* NewNode();
+  void FreeNode(Node*) noexcept;
+  void ReleasePool() noexcept;
+
+  // Tree maintenance
+  static int Height(const Node*) noexcept;
+  static unsigned long Count(const Node*) noexcept;
+  static void Update(Node*) noexcept;
+  static Node* RotateLeft(Node*) noexcept;
+  static Node* RotateRight(Node*) noexcept;
+  static Node* Rebalance(Node*) noexcept;
+
+  template <typename Value>
+  Node* InsertNode(Node*, Value&&, bool&);
+  Node* RemoveNode(Node*, const Data&, bool&);
+  Node* RemoveLeftmost(Node*, Node*&); // Detaches the minimum of the subtree
+
+  // In-order walk with an explicit stack
+  struct Cursor {
+
+    const Node* stack[MaxHeight];
+    unsigned long top = 0;
+
+    explicit Cursor(const Node*) noexcept;
+    void Descend(const Node*) noexcept;
+    const Node* Next() noexcept; // nullptr at the end
+
+  };
+
+  Node* Build(unsigned long, Cursor&); // Perfectly balanced copy of the next values of the walk
+  unsigned long Rank(const Data&) const; // Values below the given one
+
+  const Node* FindLower(const Data&) const; // First node not below the value, or nullptr
+  const Node* FindUpper(const Data&) const; // First node above the value, or nullptr
+  const Node* FindPredecessor(const Data&) const;
+
+  static void InOrder(const Node*, const TraverseFun&);
+  static void ReverseOrder(const Node*, const TraverseFun&);
+  static void InRange(const Node*, const Data&, const Data&, const RangeFun&);
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "setavl.cpp"
+
+#endif
@@ -0,0 +1,278 @@
+#include <algorithm>
+#include <new>
+#include <utility>
+
+namespace lasd {
+
+/* ************************************************************************** */
+/* Constructors */
+
+template <typename Data, typename SetImpl, typename Hash>
+BloomSet<Data, SetImpl, Hash>::BloomSet(const TraversableContainer<Data>& container) : set(container) {
+  size = set.Size();
+}
+
+template <typename Data, typename SetImpl, typename Hash>
+BloomSet<Data, SetImpl, Hash>::BloomSet(MappableContainer<Data>&& container) : set(std::move(container)) {
+  size = set.Size();
+}
+
+template <typename Data, typename SetImpl, typename Hash>
+BloomSet<Data, SetImpl, Hash>::BloomSet(const BloomSet& other) : set(other.set), hasher(other.hasher) {
+  if (other.blockCount > 0) {
+    blocks = new Block[other.blockCount];
+    std::copy(other.blocks, other.blocks + other.blockCount, blocks);
+  }
+  blockCount = other.blockCount;
+  capacity = other.capacity;
+  removed = other.removed;
+  stale = other.stale;
+  size = other.size;
+}
+
+template <typename Data, typename SetImpl, typename Hash>
+BloomSet<Data, SetImpl, Hash>::BloomSet(BloomSet&& other) noexcept : set(std::move(other.set)), hasher(other.hasher) {
+  std::swap(blocks, other.blocks);
+  std::swap(blockCount, other.blockCount);
+  std::swap(capacity, other.capacity);
+  std::swap(removed, other.removed);
+  std::swap(stale, other.stale);
+  size = other.size;
+  other.size = other.set.Size();
+}
+
+/* ************************************************************************** */
+/* Destructor */
+
+template <typename Data, typename SetImpl, typename Hash>
+BloomSet<Data, SetImpl, Hash>::~BloomSet() {
+  delete[] blocks;
+}
+
+/* ************************************************************************** */
+/* Assignment operators */
+
+template <typename Data, typename SetImpl, typename Hash>
+BloomSet<Data, SetImpl, Hash>& BloomSet<Data, SetImpl, Hash>::operator=(const BloomSet& other) {
+  if (this != &other) {
+    BloomSet tmp(other);
+    std::swap(*this, tmp);
+  }
+  return *this;
+}
+
+template <typename Data, typename SetImpl, typename Hash>
+BloomSet<Data, SetImpl, Hash>& BloomSet<Data, SetImpl, Hash>::operator=(BloomSet&& other) noexcept {
+  std::swap(set, other.set);
+  std::swap(blocks, other.blocks);
+  std::swap(blockCount, other.blockCount);
+  std::swap(capacity, other.capacity);
+  std::swap(removed, other.removed);
+  std::swap(stale, other.stale);
+  std::swap(size, other.size);
+  std::swap(hasher, other.hasher);
+  return *this;
+}
+
+/* ************************************************************************** */
+/* Comparison operators */
+
+template <typename Data, typename SetImpl, typename Hash>
+bool BloomSet<Data, SetImpl, Hash>::operator==(const BloomSet& other) const noexcept {
+  return set == other.set;
+}
+
+template <typename Data, typename SetImpl, typename Hash>
+bool BloomSet<Data, SetImpl, Hash>::operator!=(const BloomSet& other) const noexcept {
+  return !(*this == other);
+}
+
+/* ************************************************************************** */
+/* Dictionary functions */
+
+template <typename Data, typename SetImpl, typename Hash>
+bool BloomSet<Data, SetImpl, Hash>::Insert(const Data& dat) {
+  if (!set.Insert(dat)) return false;
+  ++size;
+  if (!stale && size <= capacity) Add(Mix(dat));
+  else stale = true;
+  return true;
+}
+
+template <typename Data, typename SetImpl, typename Hash>
+bool BloomSet<Data, SetImpl, Hash>::Insert(Data&& dat) {
+  std::uint64_t mix = Mix(dat); // Before the value is moved away
+  if (!set.Insert(std::move(dat))) return false;
+  ++size;
+  if (!stale && size <= capacity) Add(mix);
+  else stale = true;
+  return true;
+}
+
+template <typename Data, typename SetImpl, typename Hash>
+bool BloomSet<Data, SetImpl, Hash>::Remove(const Data& dat) {
+  if (!set.Remove(dat)) return false;
+  --size;
+  AfterRemovals(1);
+  return true;
+}
+
+template <typename Data, typename SetImpl, typename Hash>
+bool BloomSet<Data, SetImpl, Hash>::InsertAll(const TraversableContainer<Data>& container) {
+  Absorb(container);
+  bool result = set.InsertAll(container);
+  size = set.Size();
+  return result;
+}
+
+template <typename Data, typename SetImpl, typename Hash>
+bool BloomSet<Data, SetImpl, Hash>::InsertAll(MappableContainer<Data>&& container) {
+  Absorb(container);
+  bool result = set.InsertAll(std::move(container));
+  size = set.Size();
+  return result;
+}
+
+template <typename Data, typename SetImpl, typename Hash>
+bool BloomSet<Data, SetImpl, Hash>::RemoveAll(const TraversableContainer<Data>& container) {
+  bool result = set.RemoveAll(container);
+  AfterRemovals(size - set.Size());
+  size = set.Size();
+  return result;
+}
+
+template <typename Data, typename SetImpl, typename Hash>
+bool BloomSet<Data, SetImpl, Hash>::InsertSome(const TraversableContainer<Data>& container) {
+  Absorb(container);
+  bool result = set.InsertSome(container);
+  size = set.Size();
+  return result;
+}
+
+template <typename Data, typename SetImpl, typename Hash>
+bool BloomSet<Data, SetImpl, Hash>::InsertSome(MappableContainer<Data>&& container) {
+  Absorb(container);
+  bool result = set.InsertSome(std::move(container));
+  size = set.Size();
+  return result;
+}
+
+template <typename Data, typename SetImpl, typename Hash>
+bool BloomSet<Data, SetImpl, Hash>::RemoveSome(const TraversableContainer<Data>& container) {
+  bool result = set.RemoveSome(container);
+  AfterRemovals(size - set.Size());
+  size = set.Size();
+  return result;
+}
+
+/* ************************************************************************** */
+/* TraversableContainer function */
+
+template <typename Data, typename SetImpl, typename Hash>
+void BloomSet<Data, SetImpl, Hash>::Traverse(TraverseFun fun) const {
+  set.Traverse(fun);
+}
+
+/* ************************************************************************** */
+/* TestableContainer function */
+
+template <typename Data, typename SetImpl, typename Hash>
+bool BloomSet<Data, SetImpl, Hash>::Exists(const Data& dat) const noexcept {
+  return MayContain(dat) && set.Exists(dat);
+}
+
+/* ************************************************************************** */
+/* ClearableContainer function */
+
+template <typename Data, typename SetImpl, typename Hash>
+void BloomSet<Data, SetImpl, Hash>::Clear() {
+  set.Clear();
+  size = 0;
+  removed = 0;
+  stale = true;
+}
+
+/* ************************************************************************** */
+/* Specific member function */
+
+template <typename Data, typename SetImpl, typename Hash>
+bool BloomSet<Data, SetImpl, Hash>::MayContain(const Data& dat) const noexcept {
+  if (size == 0) return false;
+  if (stale && !Rebuild()) return true; // No filter: let the set answer
+  return Test(Mix(dat));
+}
+
+/* ************************************************************************** */
+
+// Auxiliary functions
+
+template <typename Data, typename SetImpl, typename Hash>
+std::uint64_t BloomSet<Data, SetImpl, Hash>::Mix(const Data& dat) const noexcept {
+  // Fibonacci hashing, as in SetHash: the top half picks the block, the bottom half the bits
+  return static_cast<std::uint64_t>(hasher(dat)) * 0x9E3779B97F4A7C15ULL;
+}
+
+template <typename Data, typename SetImpl, typename Hash>
+void BloomSet<Data, SetImpl, Hash>::Add(std::uint64_t mix) const noexcept {
+  Block& block = blocks[((mix >> 32) * blockCount) >> 32];
+  const std::uint32_t key = static_cast<std::uint32_t>(mix);
+  for (unsigned int i = 0; i < 8; ++i) {
+    block.words[i] |= std::uint64_t(1) << ((key * Salt[i]) >> 26);
+  }
+}
+
+template <typename Data, typename SetImpl, typename Hash>
+bool BloomSet<Data, SetImpl, Hash>::Test(std::uint64_t mix) const noexcept {
+  const Block& block = blocks[((mix >> 32) * blockCount) >> 32];
+  const std::uint32_t key = static_cast<std::uint32_t>(mix);
+  // No early exit: the eight words share the cache line, and this keeps the loop branch-free
+  std::uint64_t hit = 1;
+  for (unsigned int i = 0; i < 8; ++i) {
+    hit &= block.words[i] >> ((key * Salt[i]) >> 26);
+  }
+  return (hit & 1) != 0;
+}
+
+template <typename Data, typename SetImpl, typename Hash>
+bool BloomSet<Data, SetImpl, Hash>::Rebuild() const noexcept {
+  // Room for twice the current values, so that growth alone rebuilds only on doubling
+  unsigned long needed = (2 * size * BitsPerValue + 511) / 512;
+  if (needed == 0) needed = 1;
+  if (needed != blockCount) {
+    // Lookups are noexcept: on failure keep the old blocks and stay stale
+    Block* fresh = new (std::nothrow) Block[needed];
+    if (fresh == nullptr) return false;
+    delete[] blocks;
+    blocks = fresh;
+    blockCount = needed;
+  } else {
+    std::fill(blocks, blocks + blockCount, Block{});
+  }
+  capacity = blockCount * 512 / BitsPerValue;
+
+  set.Traverse([this](const Data& dat) { Add(Mix(dat)); });
+  removed = 0;
+  stale = false;
+  return true;
+}
+
+template <typename Data, typename SetImpl, typename Hash>
+void BloomSet<Data, SetImpl, Hash>::Absorb(const TraversableContainer<Data>& container) {
+  // Values already present are added again, which changes nothing
+  if (!stale && size + container.Size() <= capacity) {
+    container.Traverse([this](const Data& dat) { Add(Mix(dat)); });
+  } else {
+    stale = true;
+  }
+}
+
+template <typename Data, typename SetImpl, typename Hash>
+void BloomSet<Data, SetImpl, Hash>::AfterRemovals(unsigned long count) noexcept {
+  // Removed values still answer "maybe": rebuild once they are a good share of the filter
+  removed += count;
+  if (removed * StaleDivisor > size + removed) stale = true;
+}
+
+/* ************************************************************************** */
+
+}
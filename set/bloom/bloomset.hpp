@@ -0,0 +1,168 @@
+#ifndef BLOOMSET_HPP
+#define BLOOMSET_HPP
+
+/* ************************************************************************** */
+
+#include "../../container/dictionary.hpp"
+#include "../../container/traversable.hpp"
+#include <cstdint>
+#include <functional>
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Any dictionary (SetVec<Data>, SetLst<Data>, ...) behind a blocked Bloom
+// filter. Each value sets one bit in each 64-bit word of a single 64-byte
+// block, so a miss is usually answered from one cache line without touching
+// the set. The filter is updated on Insert. It cannot forget values: after
+// enough removals (or a bulk change) it is marked stale and rebuilt by the
+// next lookup. If the rebuild cannot allocate, the filter stays stale and
+// lookups go straight to the set.
+template <typename Data, typename SetImpl, typename Hash = std::hash<Data>>
+class BloomSet : public virtual DictionaryContainer<Data>,
+                 public virtual TraversableContainer<Data>,
+                 public virtual ClearableContainer {
+  // Must extend DictionaryContainer<Data>,
+  //             TraversableContainer<Data>,
+  //             ClearableContainer
+
+private:
+
+  static constexpr unsigned long BitsPerValue = 16; // Filter size per value, at full load
+  static constexpr unsigned long StaleDivisor = 4;  // Rebuild once a quarter of the values went away
+
+  // Odd multipliers picking the bit of each word from the low half of the hash
+  static constexpr std::uint32_t Salt[8] = {0x47B6137BU, 0x44974D91U, 0x8824AD5BU, 0xA2B7289DU,
+                                            0x705495C7U, 0x2DF1424BU, 0x9EFC4947U, 0x5C6BFB31U};
+
+  struct alignas(64) Block {
+
+    std::uint64_t words[8]{};
+
+  };
+
+  SetImpl set;
+
+  mutable Block* blocks = nullptr;
+  mutable unsigned long blockCount = 0;
+  mutable unsigned long capacity = 0;    // Values the filter is sized for
+  mutable unsigned long removed = 0;     // Removals since the last rebuild
+  mutable bool stale = true;             // Until the first lookup builds it
+
+  [[no_unique_address]] Hash hasher{};
+
+protected:
+
+  using Container::size;
+
+public:
+
+  // Default constructor
+  BloomSet() = default;
+
+  /* ************************************************************************ */
+
+  // Specific constructors
+  BloomSet(const TraversableContainer<Data>&); // Copy from TraversableContainer
+  BloomSet(MappableContainer<Data>&&);         // Move from MappableContainer
+
+  /* ************************************************************************ */
+
+  // Copy constructor
+  BloomSet(const BloomSet&);
+
+  // Move constructor
+  BloomSet(BloomSet&&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Destructor
+  ~BloomSet();
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  BloomSet& operator=(const BloomSet&);
+
+  // Move assignment
+  BloomSet& operator=(BloomSet&&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Comparison operators
+  bool operator==(const BloomSet&) const noexcept;
+  bool operator!=(const BloomSet&) const noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from DictionaryContainer)
+
+  bool Insert(const Data&) override; // Copy
+  bool Insert(Data&&) override;      // Move
+  bool Remove(const Data&) override;
+
+  // Bulk changes go straight to the set's own bulk path; the filter is rebuilt lazily
+  bool InsertAll(const TraversableContainer<Data>&) override;
+  bool InsertAll(MappableContainer<Data>&&) override;
+
+  bool RemoveAll(const TraversableContainer<Data>&) override;
+
+  bool InsertSome(const TraversableContainer<Data>&) override;
+  bool InsertSome(MappableContainer<Data>&&) override;
+
+  bool RemoveSome(const TraversableContainer<Data>&) override;
+
+  using DictionaryContainer<Data>::InsertAll;
+  using DictionaryContainer<Data>::InsertSome;
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from TraversableContainer)
+
+  using typename TraversableContainer<Data>::TraverseFun;
+  void Traverse(TraverseFun) const override;
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from TestableContainer)
+
+  bool Exists(const Data&) const noexcept override;
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from ClearableContainer)
+
+  void Clear() override;
+
+  /* ************************************************************************ */
+
+  // Specific member functions
+
+  bool MayContain(const Data&) const noexcept;  // False means definitely absent
+  const SetImpl& Underlying() const noexcept { return set; } // Read-only, so the filter stays in sync
+  unsigned long FilterBytes() const noexcept { return blockCount * sizeof(Block); }
+
+protected:
+
+  // Auxiliary functions, if necessary!
+
+  std::uint64_t Mix(const Data&) const noexcept;
+  void Add(std::uint64_t) const noexcept;
+  bool Test(std::uint64_t) const noexcept;
+
+  bool Rebuild() const noexcept;                      // Sized for twice the current values, from a full traversal; false if out of memory
+  void Absorb(const TraversableContainer<Data>&);     // Before a bulk insertion: adds the values, or marks stale
+  void AfterRemovals(unsigned long) noexcept;
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "bloomset.cpp"
+
+#endif
@@ -0,0 +1,817 @@
+#include <algorithm>
+#include <utility>
+
+namespace lasd {
+
+/* ************************************************************************** */
+/* Constructors */
+
+template <typename Data>
+SetBTree<Data>::SetBTree(const TraversableContainer<Data>& container) {
+  InsertAll(container);
+}
+
+template <typename Data>
+SetBTree<Data>::SetBTree(MappableContainer<Data>&& container) {
+  InsertAll(std::move(container));
+}
+
+template <typename Data>
+template <ForeignInputRange<Data> Range>
+SetBTree<Data>::SetBTree(Range&& range) {
+  InsertAll(std::forward<Range>(range));
+}
+
+template <typename Data>
+SetBTree<Data>::SetBTree(const SetBTree& other) {
+  // Already sorted: bulk load straight from the leaves
+  Vector<Data> values(other.size);
+  unsigned long count = 0;
+  other.Traverse([&values, &count](const Data& dat) { values[count++] = dat; });
+  BulkLoad(values, count);
+}
+
+template <typename Data>
+SetBTree<Data>::SetBTree(SetBTree&& other) noexcept {
+  std::swap(root, other.root);
+  std::swap(first, other.first);
+  std::swap(last, other.last);
+  std::swap(levels, other.levels);
+  std::swap(size, other.size);
+}
+
+/* ************************************************************************** */
+/* Destructor */
+
+template <typename Data>
+SetBTree<Data>::~SetBTree() {
+  Release();
+}
+
+/* ************************************************************************** */
+/* Assignment operators */
+
+template <typename Data>
+SetBTree<Data>& SetBTree<Data>::operator=(const SetBTree& other) {
+  if (this != &other) {
+    SetBTree tmp(other);
+    std::swap(*this, tmp);
+  }
+  return *this;
+}
+
+template <typename Data>
+SetBTree<Data>& SetBTree<Data>::operator=(SetBTree&& other) noexcept {
+  std::swap(root, other.root);
+  std::swap(first, other.first);
+  std::swap(last, other.last);
+  std::swap(levels, other.levels);
+  std::swap(size, other.size);
+  return *this;
+}
+
+/* ************************************************************************** */
+/* Comparison operators */
+
+template <typename Data>
+bool SetBTree<Data>::operator==(const SetBTree& other) const {
+  if (size != other.size) return false;
+  return std::equal(begin(), end(), other.begin());
+}
+
+template <typename Data>
+bool SetBTree<Data>::operator!=(const SetBTree& other) const {
+  return !(*this == other);
+}
+
+/* ************************************************************************** */
+/* OrderedDictionary functions */
+
+template <typename Data>
+const Data& SetBTree<Data>::Min() const {
+  if (size == 0) throw std::length_error("Empty set");
+  return first->keys[0];
+}
+
+template <typename Data>
+Data SetBTree<Data>::MinNRemove() {
+  Data tmp = Min();
+  Remove(tmp);
+  return tmp;
+}
+
+template <typename Data>
+void SetBTree<Data>::RemoveMin() {
+  (void)MinNRemove();
+}
+
+template <typename Data>
+const Data& SetBTree<Data>::Max() const {
+  if (size == 0) throw std::length_error("Empty set");
+  return last->keys[last->n - 1];
+}
+
+template <typename Data>
+Data SetBTree<Data>::MaxNRemove() {
+  Data tmp = Max();
+  Remove(tmp);
+  return tmp;
+}
+
+template <typename Data>
+void SetBTree<Data>::RemoveMax() {
+  (void)MaxNRemove();
+}
+
+template <typename Data>
+const Data& SetBTree<Data>::Predecessor(const Data& dat) const {
+  const Data* found = FindPredecessor(dat);
+  if (found == nullptr) throw std::length_error("No predecessor");
+  return *found;
+}
+
+template <typename Data>
+Data SetBTree<Data>::PredecessorNRemove(const Data& dat) {
+  Data tmp = Predecessor(dat);
+  Remove(tmp);
+  return tmp;
+}
+
+template <typename Data>
+void SetBTree<Data>::RemovePredecessor(const Data& dat) {
+  (void)PredecessorNRemove(dat);
+}
+
+template <typename Data>
+const Data& SetBTree<Data>::Successor(const Data& dat) const {
+  const Data* found = FindUpper(dat);
+  if (found == nullptr) throw std::length_error("No successor");
+  return *found;
+}
+
+template <typename Data>
+Data SetBTree<Data>::SuccessorNRemove(const Data& dat) {
+  Data tmp = Successor(dat);
+  Remove(tmp);
+  return tmp;
+}
+
+template <typename Data>
+void SetBTree<Data>::RemoveSuccessor(const Data& dat) {
+  (void)SuccessorNRemove(dat);
+}
+
+/* ************************************************************************** */
+/* Range queries */
+
+template <typename Data>
+const Data& SetBTree<Data>::LowerBound(const Data& dat) const {
+  const Data* found = FindLower(dat);
+  if (found == nullptr) throw std::length_error("No lower bound");
+  return *found;
+}
+
+template <typename Data>
+const Data& SetBTree<Data>::UpperBound(const Data& dat) const {
+  const Data* found = FindUpper(dat);
+  if (found == nullptr) throw std::length_error("No upper bound");
+  return *found;
+}
+
+template <typename Data>
+void SetBTree<Data>::RangeTraverse(const Data& lo, const Data& hi, RangeFun fun) const {
+  if (size == 0 || !(lo < hi)) return;
+  const Leaf* leaf = FindLeaf(lo);
+  unsigned long pos = LowerIndex(leaf->keys, leaf->n, lo);
+  for (; leaf != nullptr; leaf = leaf->next, pos = 0) {
+    for (; pos < leaf->n; ++pos) {
+      if (!(leaf->keys[pos] < hi)) return;
+      fun(leaf->keys[pos]);
+    }
+  }
+}
+
+template <typename Data>
+unsigned long SetBTree<Data>::RangeCount(const Data& lo, const Data& hi) const {
+  if (!(lo < hi)) return 0;
+  return Rank(hi) - Rank(lo);
+}
+
+template <typename Data>
+unsigned long SetBTree<Data>::RangeRemove(const Data& lo, const Data& hi) {
+  unsigned long removed = 0;
+  for (const Data* found = FindLower(lo); found != nullptr && *found < hi; found = FindLower(lo)) {
+    Data victim = *found;
+    Remove(victim);
+    ++removed;
+  }
+  return removed;
+}
+
+/* ************************************************************************** */
+/* Dictionary functions */
+
+template <typename Data>
+bool SetBTree<Data>::Insert(const Data& dat) {
+  if (root == nullptr) root = first = last = new Leaf;
+  Split split;
+  if (!InsertInto(root, levels, dat, split)) return false;
+  ++size;
+  if (split.node != nullptr) GrowRoot(split);
+  return true;
+}
+
+template <typename Data>
+bool SetBTree<Data>::Insert(Data&& dat) {
+  if (root == nullptr) root = first = last = new Leaf;
+  Split split;
+  if (!InsertInto(root, levels, std::move(dat), split)) return false;
+  ++size;
+  if (split.node != nullptr) GrowRoot(split);
+  return true;
+}
+
+template <typename Data>
+bool SetBTree<Data>::Remove(const Data& dat) {
+  if (root == nullptr || !RemoveFrom(root, levels, dat)) return false;
+  --size;
+
+  if (levels > 0 && root->n == 1) {
+    // The root has a single child left: shrink the tree by one level
+    Inner* top = static_cast<Inner*>(root);
+    root = top->children[0];
+    delete top;
+    --levels;
+  } else if (levels == 0 && root->n == 0) {
+    Release();
+  }
+  return true;
+}
+
+template <typename Data>
+bool SetBTree<Data>::InsertAll(const TraversableContainer<Data>& container) {
+  Vector<Data> batch;
+  unsigned long count = 0;
+  container.Traverse([&batch, &count](const Data& dat) { PushBatch(batch, count, dat); });
+  return (InsertBatch(batch, count) == count);
+}
+
+template <typename Data>
+bool SetBTree<Data>::InsertAll(MappableContainer<Data>&& container) {
+  Vector<Data> batch;
+  unsigned long count = 0;
+  container.Map([&batch, &count](Data& dat) { PushBatch(batch, count, std::move(dat)); });
+  return (InsertBatch(batch, count) == count);
+}
+
+template <typename Data>
+bool SetBTree<Data>::InsertSome(const TraversableContainer<Data>& container) {
+  Vector<Data> batch;
+  unsigned long count = 0;
+  container.Traverse([&batch, &count](const Data& dat) { PushBatch(batch, count, dat); });
+  return (InsertBatch(batch, count) > 0);
+}
+
+template <typename Data>
+bool SetBTree<Data>::InsertSome(MappableContainer<Data>&& container) {
+  Vector<Data> batch;
+  unsigned long count = 0;
+  container.Map([&batch, &count](Data& dat) { PushBatch(batch, count, std::move(dat)); });
+  return (InsertBatch(batch, count) > 0);
+}
+
+template <typename Data>
+template <ForeignInputRange<Data> Range>
+bool SetBTree<Data>::InsertAll(Range&& range) {
+  Vector<Data> batch;
+  unsigned long count = 0;
+  for (auto&& dat : range) {
+    PushBatch(batch, count, std::forward<decltype(dat)>(dat));
+  }
+  return (InsertBatch(batch, count) == count);
+}
+
+template <typename Data>
+template <ForeignInputRange<Data> Range>
+bool SetBTree<Data>::InsertSome(Range&& range) {
+  Vector<Data> batch;
+  unsigned long count = 0;
+  for (auto&& dat : range) {
+    PushBatch(batch, count, std::forward<decltype(dat)>(dat));
+  }
+  return (InsertBatch(batch, count) > 0);
+}
+
+/* ************************************************************************** */
+/* LinearContainer functions */
+
+template <typename Data>
+const Data& SetBTree<Data>::operator[](unsigned long index) const {
+  if (index >= size) throw std::out_of_range("Index out of range");
+  const Node* node = root;
+  for (unsigned long level = levels; level > 0; --level) {
+    const Inner* inner = static_cast<const Inner*>(node);
+    unsigned long i = 0;
+    while (index >= inner->counts[i]) {
+      index -= inner->counts[i++];
+    }
+    node = inner->children[i];
+  }
+  return static_cast<const Leaf*>(node)->keys[index];
+}
+
+/* ************************************************************************** */
+/* TraversableContainer functions */
+
+template <typename Data>
+void SetBTree<Data>::Traverse(TraverseFun fun) const {
+  PreOrderTraverse(fun);
+}
+
+template <typename Data>
+void SetBTree<Data>::PreOrderTraverse(TraverseFun fun) const {
+  for (const Leaf* leaf = first; leaf != nullptr; leaf = leaf->next) {
+    for (unsigned long i = 0; i < leaf->n; ++i) {
+      fun(leaf->keys[i]);
+    }
+  }
+}
+
+template <typename Data>
+void SetBTree<Data>::PostOrderTraverse(TraverseFun fun) const {
+  for (const Leaf* leaf = last; leaf != nullptr; leaf = leaf->prev) {
+    for (unsigned long i = leaf->n; i > 0; --i) {
+      fun(leaf->keys[i - 1]);
+    }
+  }
+}
+
+/* ************************************************************************** */
+/* TestableContainer function */
+
+template <typename Data>
+bool SetBTree<Data>::Exists(const Data& dat) const noexcept {
+  if (root == nullptr) return false;
+  const Leaf* leaf = FindLeaf(dat);
+  unsigned long pos = LowerIndex(leaf->keys, leaf->n, dat);
+  return (pos < leaf->n && !(dat < leaf->keys[pos]));
+}
+
+/* ************************************************************************** */
+/* ClearableContainer / ResizableContainer functions */
+
+template <typename Data>
+void SetBTree<Data>::Clear() {
+  Release();
+}
+
+template <typename Data>
+void SetBTree<Data>::Resize(unsigned long newSize) {
+  if (newSize == 0) {
+    Clear();
+    return;
+  }
+  while (size > newSize) {
+    RemoveMax();
+  }
+}
+
+/* ************************************************************************** */
+
+// Auxiliary functions
+
+/* Batches */
+
+template <typename Data>
+template <typename Value>
+void SetBTree<Data>::PushBatch(Vector<Data>& batch, unsigned long& count, Value&& dat) {
+  if (count == batch.Size()) {
+    batch.Resize(count == 0 ? BulkThreshold : count * 2);
+  }
+  batch[count++] = std::forward<Value>(dat);
+}
+
+template <typename Data>
+unsigned long SetBTree<Data>::InsertBatch(Vector<Data>& batch, unsigned long count) {
+  unsigned long inserted = 0;
+
+  if (count < BulkThreshold) {
+    for (unsigned long j = 0; j < count; ++j) {
+      inserted += Insert(std::move(batch[j]));
+    }
+    return inserted;
+  }
+
+  Data* values = batch.begin();
+  std::sort(values, values + count);
+  unsigned long unique = std::unique(values, values + count) - values;
+
+  if (unique * 8 < size) {
+    // Small next to the tree: single descents are cheaper than a rebuild
+    for (unsigned long j = 0; j < unique; ++j) {
+      inserted += Insert(std::move(values[j]));
+    }
+    return inserted;
+  }
+
+  // Merge the leaves with the sorted batch, then bulk load the result
+  Vector<Data> merged(size + unique);
+  const Leaf* leaf = first;
+  unsigned long i = 0;
+  unsigned long j = 0;
+  unsigned long k = 0;
+  while (leaf != nullptr && j < unique) {
+    const Data& curr = leaf->keys[i];
+    if (values[j] < curr) {
+      merged[k++] = std::move(values[j++]);
+    } else {
+      if (!(curr < values[j])) ++j; // Already present: keep the stored one
+      merged[k++] = curr;
+      if (++i == leaf->n) {
+        leaf = leaf->next;
+        i = 0;
+      }
+    }
+  }
+  for (; leaf != nullptr; leaf = leaf->next, i = 0) {
+    for (; i < leaf->n; ++i) merged[k++] = leaf->keys[i];
+  }
+  while (j < unique) {
+    merged[k++] = std::move(values[j++]);
+  }
+
+  inserted = k - size;
+  Release();
+  BulkLoad(merged, k);
+  return inserted;
+}
+
+template <typename Data>
+void SetBTree<Data>::BulkLoad(Vector<Data>& values, unsigned long count) {
+  if (count == 0) return;
+
+  // Leaves first, filled evenly and linked in order
+  unsigned long nodes = (count + LeafCapacity - 1) / LeafCapacity;
+  Vector<Node*> level(nodes);
+  Vector<unsigned long> counts(nodes);
+  Vector<Data> mins(nodes);
+  Leaf* prev = nullptr;
+  unsigned long k = 0;
+  for (unsigned long i = 0; i < nodes; ++i) {
+    Leaf* leaf = new Leaf;
+    leaf->n = (count - k) / (nodes - i);
+    for (unsigned long j = 0; j < leaf->n; ++j) {
+      leaf->keys[j] = std::move(values[k++]);
+    }
+    leaf->prev = prev;
+    if (prev != nullptr) prev->next = leaf;
+    else first = leaf;
+    prev = leaf;
+    level[i] = leaf;
+    counts[i] = leaf->n;
+    mins[i] = leaf->keys[0];
+  }
+  last = prev;
+
+  // Then one inner level at a time, rewriting the arrays in place
+  levels = 0;
+  while (nodes > 1) {
+    unsigned long parents = (nodes + InnerCapacity - 1) / InnerCapacity;
+    unsigned long c = 0;
+    for (unsigned long p = 0; p < parents; ++p) {
+      Inner* inner = new Inner;
+      inner->n = (nodes - c) / (parents - p);
+      unsigned long total = 0;
+      Data min = std::move(mins[c]);
+      for (unsigned long j = 0; j < inner->n; ++j, ++c) {
+        if (j > 0) inner->keys[j - 1] = std::move(mins[c]);
+        inner->children[j] = level[c];
+        inner->counts[j] = counts[c];
+        total += counts[c];
+      }
+      level[p] = inner;
+      counts[p] = total;
+      mins[p] = std::move(min);
+    }
+    nodes = parents;
+    ++levels;
+  }
+  root = level[0];
+  size = count;
+}
+
+template <typename Data>
+void SetBTree<Data>::Destroy(Node* node, unsigned long level) noexcept {
+  if (level == 0) {
+    delete static_cast<Leaf*>(node);
+    return;
+  }
+  Inner* inner = static_cast<Inner*>(node);
+  for (unsigned long i = 0; i < inner->n; ++i) {
+    Destroy(inner->children[i], level - 1);
+  }
+  delete inner;
+}
+
+template <typename Data>
+void SetBTree<Data>::Release() noexcept {
+  if (root != nullptr) Destroy(root, levels);
+  root = nullptr;
+  first = last = nullptr;
+  levels = 0;
+  size = 0;
+}
+
+/* Insertion */
+
+template <typename Data>
+template <typename Value>
+bool SetBTree<Data>::InsertInto(Node* node, unsigned long level, Value&& dat, Split& split) {
+  if (level == 0) {
+    Leaf* leaf = static_cast<Leaf*>(node);
+    Data* pos = leaf->keys + LowerIndex(leaf->keys, leaf->n, dat);
+    if (pos != leaf->keys + leaf->n && !(dat < *pos)) return false;
+    std::move_backward(pos, leaf->keys + leaf->n, leaf->keys + leaf->n + 1);
+    *pos = std::forward<Value>(dat);
+    if (++leaf->n > LeafCapacity) SplitLeaf(leaf, split);
+    return true;
+  }
+
+  Inner* inner = static_cast<Inner*>(node);
+  unsigned long idx = UpperIndex(inner->keys, inner->n - 1, dat);
+  Split child;
+  if (!InsertInto(inner->children[idx], level - 1, std::forward<Value>(dat), child)) return false;
+  ++inner->counts[idx];
+
+  if (child.node != nullptr) {
+    std::move_backward(inner->keys + idx, inner->keys + inner->n - 1, inner->keys + inner->n);
+    std::move_backward(inner->children + idx + 1, inner->children + inner->n, inner->children + inner->n + 1);
+    std::move_backward(inner->counts + idx + 1, inner->counts + inner->n, inner->counts + inner->n + 1);
+    inner->keys[idx] = std::move(child.key);
+    inner->children[idx + 1] = child.node;
+    inner->counts[idx] -= child.count;
+    inner->counts[idx + 1] = child.count;
+    if (++inner->n > InnerCapacity) SplitInner(inner, split);
+  }
+  return true;
+}
+
+template <typename Data>
+void SetBTree<Data>::GrowRoot(Split& split) {
+  // The root split: the tree grows by one level
+  Inner* top = new Inner;
+  top->n = 2;
+  top->keys[0] = std::move(split.key);
+  top->children[0] = root;
+  top->children[1] = split.node;
+  top->counts[0] = size - split.count;
+  top->counts[1] = split.count;
+  root = top;
+  ++levels;
+}
+
+template <typename Data>
+void SetBTree<Data>::SplitLeaf(Leaf* leaf, Split& split) {
+  Leaf* right = new Leaf;
+  unsigned long keep = (leaf->n + 1) / 2;
+  right->n = leaf->n - keep;
+  std::move(leaf->keys + keep, leaf->keys + leaf->n, right->keys);
+  leaf->n = keep;
+
+  right->next = leaf->next;
+  right->prev = leaf;
+  if (leaf->next != nullptr) leaf->next->prev = right;
+  else last = right;
+  leaf->next = right;
+
+  split.node = right;
+  split.key = right->keys[0];
+  split.count = right->n;
+}
+
+template <typename Data>
+void SetBTree<Data>::SplitInner(Inner* inner, Split& split) {
+  Inner* right = new Inner;
+  unsigned long keep = (inner->n + 1) / 2;
+  right->n = inner->n - keep;
+  std::move(inner->keys + keep, inner->keys + inner->n - 1, right->keys);
+  std::copy(inner->children + keep, inner->children + inner->n, right->children);
+  std::copy(inner->counts + keep, inner->counts + inner->n, right->counts);
+  inner->n = keep;
+
+  split.node = right;
+  split.key = std::move(inner->keys[keep - 1]); // The middle separator moves up
+  split.count = 0;
+  for (unsigned long i = 0; i < right->n; ++i) {
+    split.count += right->counts[i];
+  }
+}
+
+/* Removal */
+
+template <typename Data>
+bool SetBTree<Data>::RemoveFrom(Node* node, unsigned long level, const Data& dat) {
+  if (level == 0) {
+    Leaf* leaf = static_cast<Leaf*>(node);
+    Data* pos = leaf->keys + LowerIndex(leaf->keys, leaf->n, dat);
+    if (pos == leaf->keys + leaf->n || dat < *pos) return false;
+    std::move(pos + 1, leaf->keys + leaf->n, pos);
+    --leaf->n;
+    return true;
+  }
+
+  Inner* inner = static_cast<Inner*>(node);
+  unsigned long idx = UpperIndex(inner->keys, inner->n - 1, dat);
+  if (!RemoveFrom(inner->children[idx], level - 1, dat)) return false;
+  --inner->counts[idx];
+  if (inner->children[idx]->n < (level == 1 ? LeafMin : InnerMin)) {
+    Refill(inner, idx, level - 1);
+  }
+  return true;
+}
+
+template <typename Data>
+void SetBTree<Data>::Refill(Inner* parent, unsigned long idx, unsigned long level) {
+  const unsigned long min = (level == 0) ? LeafMin : InnerMin;
+  if (idx > 0 && parent->children[idx - 1]->n > min) {
+    BorrowFromLeft(parent, idx, level);
+  } else if (idx + 1 < parent->n && parent->children[idx + 1]->n > min) {
+    BorrowFromRight(parent, idx, level);
+  } else if (idx > 0) {
+    MergeChildren(parent, idx - 1, level);
+  } else {
+    MergeChildren(parent, idx, level);
+  }
+}
+
+template <typename Data>
+void SetBTree<Data>::BorrowFromLeft(Inner* parent, unsigned long idx, unsigned long level) {
+  unsigned long moved = 1;
+  if (level == 0) {
+    Leaf* left = static_cast<Leaf*>(parent->children[idx - 1]);
+    Leaf* curr = static_cast<Leaf*>(parent->children[idx]);
+    std::move_backward(curr->keys, curr->keys + curr->n, curr->keys + curr->n + 1);
+    curr->keys[0] = std::move(left->keys[--left->n]);
+    ++curr->n;
+    parent->keys[idx - 1] = curr->keys[0];
+  } else {
+    Inner* left = static_cast<Inner*>(parent->children[idx - 1]);
+    Inner* curr = static_cast<Inner*>(parent->children[idx]);
+    std::move_backward(curr->keys, curr->keys + curr->n - 1, curr->keys + curr->n);
+    std::move_backward(curr->children, curr->children + curr->n, curr->children + curr->n + 1);
+    std::move_backward(curr->counts, curr->counts + curr->n, curr->counts + curr->n + 1);
+    --left->n;
+    curr->keys[0] = std::move(parent->keys[idx - 1]);
+    curr->children[0] = left->children[left->n];
+    curr->counts[0] = moved = left->counts[left->n];
+    parent->keys[idx - 1] = std::move(left->keys[left->n - 1]);
+    ++curr->n;
+  }
+  parent->counts[idx - 1] -= moved;
+  parent->counts[idx] += moved;
+}
+
+template <typename Data>
+void SetBTree<Data>::BorrowFromRight(Inner* parent, unsigned long idx, unsigned long level) {
+  unsigned long moved = 1;
+  if (level == 0) {
+    Leaf* curr = static_cast<Leaf*>(parent->children[idx]);
+    Leaf* right = static_cast<Leaf*>(parent->children[idx + 1]);
+    curr->keys[curr->n++] = std::move(right->keys[0]);
+    std::move(right->keys + 1, right->keys + right->n, right->keys);
+    --right->n;
+    parent->keys[idx] = right->keys[0];
+  } else {
+    Inner* curr = static_cast<Inner*>(parent->children[idx]);
+    Inner* right = static_cast<Inner*>(parent->children[idx + 1]);
+    curr->keys[curr->n - 1] = std::move(parent->keys[idx]);
+    curr->children[curr->n] = right->children[0];
+    curr->counts[curr->n] = moved = right->counts[0];
+    ++curr->n;
+    parent->keys[idx] = std::move(right->keys[0]);
+    std::move(right->keys + 1, right->keys + right->n - 1, right->keys);
+    std::copy(right->children + 1, right->children + right->n, right->children);
+    std::copy(right->counts + 1, right->counts + right->n, right->counts);
+    --right->n;
+  }
+  parent->counts[idx] += moved;
+  parent->counts[idx + 1] -= moved;
+}
+
+template <typename Data>
+void SetBTree<Data>::MergeChildren(Inner* parent, unsigned long idx, unsigned long level) {
+  if (level == 0) {
+    Leaf* left = static_cast<Leaf*>(parent->children[idx]);
+    Leaf* right = static_cast<Leaf*>(parent->children[idx + 1]);
+    std::move(right->keys, right->keys + right->n, left->keys + left->n);
+    left->n += right->n;
+    left->next = right->next;
+    if (right->next != nullptr) right->next->prev = left;
+    else last = left;
+    delete right;
+  } else {
+    Inner* left = static_cast<Inner*>(parent->children[idx]);
+    Inner* right = static_cast<Inner*>(parent->children[idx + 1]);
+    left->keys[left->n - 1] = std::move(parent->keys[idx]);
+    std::move(right->keys, right->keys + right->n - 1, left->keys + left->n);
+    std::copy(right->children, right->children + right->n, left->children + left->n);
+    std::copy(right->counts, right->counts + right->n, left->counts + left->n);
+    left->n += right->n;
+    delete right;
+  }
+
+  parent->counts[idx] += parent->counts[idx + 1];
+  std::move(parent->keys + idx + 1, parent->keys + parent->n - 1, parent->keys + idx);
+  std::copy(parent->children + idx + 2, parent->children + parent->n, parent->children + idx + 1);
+  std::copy(parent->counts + idx + 2, parent->counts + parent->n, parent->counts + idx + 1);
+  --parent->n;
+}
+
+/* Queries */
+
+template <typename Data>
+unsigned long SetBTree<Data>::LowerIndex(const Data* keys, unsigned long n, const Data& dat) noexcept {
+  // Fixed-length halving without an early exit: compiles to conditional moves
+  if (n == 0) return 0;
+  const Data* base = keys;
+  while (n > 1) {
+    unsigned long half = n / 2;
+    base = (base[half] < dat) ? base + half : base;
+    n -= half;
+  }
+  return (base - keys) + (*base < dat);
+}
+
+template <typename Data>
+unsigned long SetBTree<Data>::UpperIndex(const Data* keys, unsigned long n, const Data& dat) noexcept {
+  if (n == 0) return 0;
+  const Data* base = keys;
+  while (n > 1) {
+    unsigned long half = n / 2;
+    base = (dat < base[half]) ? base : base + half;
+    n -= half;
+  }
+  return (base - keys) + !(dat < *base);
+}
+
+template <typename Data>
+const typename SetBTree<Data>::Leaf* SetBTree<Data>::FindLeaf(const Data& dat) const noexcept {
+  const Node* node = root;
+  for (unsigned long level = levels; level > 0; --level) {
+    const Inner* inner = static_cast<const Inner*>(node);
+    node = inner->children[UpperIndex(inner->keys, inner->n - 1, dat)];
+#ifdef __GNUC__
+    // Request every line of the child at once: its search then waits for one miss, not one per probe
+    const char* bytes = reinterpret_cast<const char*>(node);
+    const unsigned long span = (level == 1) ? sizeof(Leaf) : sizeof(Inner);
+    for (unsigned long off = 0; off < span; off += 64) __builtin_prefetch(bytes + off);
+#endif
+  }
+  return static_cast<const Leaf*>(node);
+}
+
+template <typename Data>
+const Data* SetBTree<Data>::FindLower(const Data& dat) const {
+  if (root == nullptr) return nullptr;
+  const Leaf* leaf = FindLeaf(dat);
+  const Data* pos = leaf->keys + LowerIndex(leaf->keys, leaf->n, dat);
+  if (pos != leaf->keys + leaf->n) return pos;
+  return (leaf->next != nullptr) ? leaf->next->keys : nullptr;
+}
+
+template <typename Data>
+const Data* SetBTree<Data>::FindUpper(const Data& dat) const {
+  if (root == nullptr) return nullptr;
+  const Leaf* leaf = FindLeaf(dat);
+  const Data* pos = leaf->keys + UpperIndex(leaf->keys, leaf->n, dat);
+  if (pos != leaf->keys + leaf->n) return pos;
+  return (leaf->next != nullptr) ? leaf->next->keys : nullptr;
+}
+
+template <typename Data>
+const Data* SetBTree<Data>::FindPredecessor(const Data& dat) const {
+  if (root == nullptr) return nullptr;
+  const Leaf* leaf = FindLeaf(dat);
+  const Data* pos = leaf->keys + LowerIndex(leaf->keys, leaf->n, dat);
+  if (pos != leaf->keys) return pos - 1;
+  return (leaf->prev != nullptr) ? leaf->prev->keys + leaf->prev->n - 1 : nullptr;
+}
+
+template <typename Data>
+unsigned long SetBTree<Data>::Rank(const Data& dat) const {
+  if (root == nullptr) return 0;
+  unsigned long rank = 0;
+  const Node* node = root;
+  for (unsigned long level = levels; level > 0; --level) {
+    const Inner* inner = static_cast<const Inner*>(node);
+    unsigned long idx = UpperIndex(inner->keys, inner->n - 1, dat);
+    for (unsigned long i = 0; i < idx; ++i) rank += inner->counts[i];
+    node = inner->children[idx];
+  }
+  const Leaf* leaf = static_cast<const Leaf*>(node);
+  return rank + (LowerIndex(leaf->keys, leaf->n, dat));
+}
+
+/* ************************************************************************** */
+
+} // namespace lasd
@@ -0,0 +1,307 @@
+#ifndef SETBTREE_HPP
+#define SETBTREE_HPP
+
+/* ************************************************************************** */
+
+#include "../set.hpp"
+#include "../../vector/vector.hpp"
+#include <iterator>
+#include <stdexcept>
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+template <typename Data>
+class SetBTree : public virtual Set<Data>,
+                 public virtual ResizableContainer {
+  // Must extend Set<Data>,
+  //             ResizableContainer
+
+private:
+
+  // Nodes span a few cache lines; each keeps one spare slot so that it can
+  // overflow by one value before being split
+  static constexpr unsigned long NodeBytes = 512;
+  static constexpr unsigned long LeafSlots = (NodeBytes - 3 * sizeof(void*)) / sizeof(Data);
+  static constexpr unsigned long InnerSlots = (NodeBytes - 3 * sizeof(void*)) / (sizeof(Data) + sizeof(void*) + sizeof(unsigned long));
+  static constexpr unsigned long LeafCapacity = (LeafSlots > 4) ? LeafSlots - 1 : 4; // Values per leaf
+  static constexpr unsigned long InnerCapacity = (InnerSlots > 4) ? InnerSlots : 4;  // Children per inner node
+  static constexpr unsigned long LeafMin = LeafCapacity / 2;
+  static constexpr unsigned long InnerMin = InnerCapacity / 2;
+
+  struct Node {
+
+    unsigned long n = 0; // Values in a leaf, children in an inner node
+
+  };
+
+  struct alignas(64) Leaf : Node {
+
+    Leaf* prev = nullptr;
+    Leaf* next = nullptr;
+    Data keys[LeafCapacity + 1];
+
+  };
+
+  // Every value in children[i] is below keys[i], every value in children[i + 1] is not
+  struct alignas(64) Inner : Node {
+
+    Data keys[InnerCapacity];
+    Node* children[InnerCapacity + 1];
+    unsigned long counts[InnerCapacity + 1]; // Values in each subtree (for select and rank)
+
+  };
+
+  Node* root = nullptr;
+  Leaf* first = nullptr;
+  Leaf* last = nullptr;
+  unsigned long levels = 0; // Inner levels above the leaves
+
+  static constexpr unsigned long BulkThreshold = 16;
+
+  template <typename Value>
+  static void PushBatch(Vector<Data>&, unsigned long&, Value&&);
+  unsigned long InsertBatch(Vector<Data>&, unsigned long); // Returns how many values were new
+
+protected:
+
+  using Container::size;
+
+public:
+
+  // Bring base class methods into scope
+  using LinearContainer<Data>::operator==;
+  using LinearContainer<Data>::operator!=;
+
+  /* ************************************************************************ */
+
+  // Bidirectional iterator along the linked leaves (read-only: elements must stay ordered)
+  class ConstIterator {
+
+  private:
+
+    const SetBTree* set = nullptr;
+    const Leaf* leaf = nullptr; // nullptr at the end
+    unsigned long pos = 0;
+
+  public:
+
+    using iterator_concept = std::bidirectional_iterator_tag;
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = Data;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Data*;
+    using reference = const Data&;
+
+    ConstIterator() = default;
+    ConstIterator(const SetBTree* st, const Leaf* lf, unsigned long ps) noexcept : set(st), leaf(lf), pos(ps) {}
+
+    reference operator*() const noexcept { return leaf->keys[pos]; }
+    pointer operator->() const noexcept { return &leaf->keys[pos]; }
+
+    ConstIterator& operator++() noexcept {
+      if (++pos == leaf->n) {
+        leaf = leaf->next;
+        pos = 0;
+      }
+      return *this;
+    }
+    ConstIterator operator++(int) noexcept { ConstIterator tmp = *this; ++*this; return tmp; }
+
+    ConstIterator& operator--() noexcept {
+      if (leaf == nullptr || pos == 0) {
+        leaf = (leaf == nullptr) ? set->last : leaf->prev;
+        pos = leaf->n;
+      }
+      --pos;
+      return *this;
+    }
+    ConstIterator operator--(int) noexcept { ConstIterator tmp = *this; --*this; return tmp; }
+
+    friend bool operator==(const ConstIterator& it1, const ConstIterator& it2) noexcept {
+      return it1.leaf == it2.leaf && it1.pos == it2.pos;
+    }
+
+  };
+
+  using const_iterator = ConstIterator;
+  using iterator = ConstIterator;
+
+  /* ************************************************************************ */
+
+  // Default constructor
+  SetBTree() = default;
+
+  /* ************************************************************************ */
+
+  // Specific constructors (bulk loaded)
+  SetBTree(const TraversableContainer<Data>&); // Copy from TraversableContainer
+  SetBTree(MappableContainer<Data>&&);         // Move from MappableContainer
+
+  template <ForeignInputRange<Data> Range>
+  SetBTree(Range&&);                           // Copy (or move, for prvalue elements) from any input range
+
+  /* ************************************************************************ */
+
+  // Copy constructor
+  SetBTree(const SetBTree&);
+
+  // Move constructor
+  SetBTree(SetBTree&&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Destructor
+  ~SetBTree();
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  SetBTree& operator=(const SetBTree&);
+
+  // Move assignment
+  SetBTree& operator=(SetBTree&&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Comparison operators
+  bool operator==(const SetBTree&) const;
+  bool operator!=(const SetBTree&) const;
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from OrderedDictionaryContainer)
+
+  const Data& Min() const override;
+  Data MinNRemove() override;
+  void RemoveMin() override;
+
+  const Data& Max() const override;
+  Data MaxNRemove() override;
+  void RemoveMax() override;
+
+  const Data& Predecessor(const Data&) const override;
+  Data PredecessorNRemove(const Data&) override;
+  void RemovePredecessor(const Data&) override;
+
+  const Data& Successor(const Data&) const override;
+  Data SuccessorNRemove(const Data&) override;
+  void RemoveSuccessor(const Data&) override;
+
+  using typename OrderedDictionaryContainer<Data>::RangeFun;
+  const Data& LowerBound(const Data&) const override;
+  const Data& UpperBound(const Data&) const override;
+  void RangeTraverse(const Data&, const Data&, RangeFun) const override;
+  unsigned long RangeCount(const Data&, const Data&) const override;
+  unsigned long RangeRemove(const Data&, const Data&) override;
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from DictionaryContainer)
+
+  bool Insert(const Data&) override; // Copy
+  bool Insert(Data&&) override;      // Move
+  bool Remove(const Data&) override;
+
+  // Large batches are sorted and merged with the leaves, then bulk loaded
+  bool InsertAll(const TraversableContainer<Data>&) override;
+  bool InsertAll(MappableContainer<Data>&&) override;
+  bool InsertSome(const TraversableContainer<Data>&) override;
+  bool InsertSome(MappableContainer<Data>&&) override;
+
+  template <ForeignInputRange<Data> Range>
+  bool InsertAll(Range&&);
+  template <ForeignInputRange<Data> Range>
+  bool InsertSome(Range&&);
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from LinearContainer)
+
+  const Data& operator[](unsigned long) const override; // Select by rank, O(log n)
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from TraversableContainer)
+
+  using typename TraversableContainer<Data>::TraverseFun;
+  void Traverse(TraverseFun) const override;          // Leaf by leaf
+  void PreOrderTraverse(TraverseFun) const override;  // Ascending order
+  void PostOrderTraverse(TraverseFun) const override; // Descending order
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from TestableContainer)
+
+  bool Exists(const Data&) const noexcept override;
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from ClearableContainer)
+
+  void Clear() override;
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from ResizableContainer)
+
+  // Resize the container to the given size by removing the largest elements if the size is reduced.
+  void Resize(unsigned long) override;
+
+  /* ************************************************************************ */
+
+  // Iterators
+  const_iterator begin() const noexcept { return ConstIterator(this, first, 0); }
+  const_iterator end() const noexcept { return ConstIterator(this, nullptr, 0); }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
+
+protected:
+
+  // Auxiliary functions, if necessary!
+
+  struct Split {
+
+    Node* node = nullptr; // New right sibling, if any
+    Data key{};           // Its separator
+    unsigned long count = 0;
+
+  };
+
+  template <typename Value>
+  bool InsertInto(Node*, unsigned long, Value&&, Split&);
+  void GrowRoot(Split&);
+  void SplitLeaf(Leaf*, Split&);
+  void SplitInner(Inner*, Split&);
+
+  bool RemoveFrom(Node*, unsigned long, const Data&);
+  void Refill(Inner*, unsigned long, unsigned long); // Fixes an underfull child
+  void BorrowFromLeft(Inner*, unsigned long, unsigned long);
+  void BorrowFromRight(Inner*, unsigned long, unsigned long);
+  void MergeChildren(Inner*, unsigned long, unsigned long); // Merges children i and i + 1
+
+  void BulkLoad(Vector<Data>&, unsigned long); // Sorted, distinct values into an empty tree
+  static void Destroy(Node*, unsigned long) noexcept;
+  void Release() noexcept;
+
+  static unsigned long LowerIndex(const Data*, unsigned long, const Data&) noexcept; // First key not below the value
+  static unsigned long UpperIndex(const Data*, unsigned long, const Data&) noexcept; // First key above the value
+
+  const Leaf* FindLeaf(const Data&) const noexcept; // Leaf the value belongs to
+  const Data* FindLower(const Data&) const;         // First value not below the given one, or nullptr
+  const Data* FindUpper(const Data&) const;         // First value above the given one, or nullptr
+  const Data* FindPredecessor(const Data&) const;
+  unsigned long Rank(const Data&) const;            // Values below the given one
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "setbtree.cpp"
+
+#endif
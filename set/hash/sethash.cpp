@@ -0,0 +1,309 @@
+#include <algorithm>
+#include <bit>
+#include <ranges>
+#include <utility>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace lasd {
+
+/* ************************************************************************** */
+/* Constructors */
+
+template <typename Data, typename Hash>
+SetHash<Data, Hash>::SetHash(const Hash& hash) : hasher(hash) {}
+
+template <typename Data, typename Hash>
+SetHash<Data, Hash>::SetHash(const TraversableContainer<Data>& container) {
+  Reserve(container.Size());
+  container.Traverse([this](const Data& dat) {
+    InsertValue(dat);
+  });
+}
+
+template <typename Data, typename Hash>
+SetHash<Data, Hash>::SetHash(MappableContainer<Data>&& container) {
+  Reserve(container.Size());
+  container.Map([this](Data& dat) {
+    InsertValue(std::move(dat));
+  });
+}
+
+template <typename Data, typename Hash>
+template <ForeignInputRange<Data> Range>
+SetHash<Data, Hash>::SetHash(Range&& range) {
+  if constexpr (std::ranges::sized_range<Range>) {
+    Reserve(std::ranges::size(range));
+  }
+  for (auto&& dat : range) {
+    InsertValue(std::forward<decltype(dat)>(dat));
+  }
+}
+
+template <typename Data, typename Hash>
+SetHash<Data, Hash>::SetHash(const SetHash& other) : hasher(other.hasher) {
+  // Same capacity and hash: every value lands in the same slot
+  if (other.capacity > 0) {
+    control = new signed char[other.capacity + GroupWidth];
+    slots = new Data[other.capacity];
+    std::copy(other.control, other.control + other.capacity + GroupWidth, control);
+    for (unsigned long i = 0; i < other.capacity; ++i) {
+      if (control[i] != EmptySlot) slots[i] = other.slots[i];
+    }
+    capacity = other.capacity;
+    shift = other.shift;
+    size = other.size;
+  }
+}
+
+template <typename Data, typename Hash>
+SetHash<Data, Hash>::SetHash(SetHash&& other) noexcept : hasher(other.hasher) {
+  std::swap(control, other.control);
+  std::swap(slots, other.slots);
+  std::swap(capacity, other.capacity);
+  std::swap(shift, other.shift);
+  std::swap(size, other.size);
+}
+
+/* ************************************************************************** */
+/* Destructor */
+
+template <typename Data, typename Hash>
+SetHash<Data, Hash>::~SetHash() {
+  delete[] control;
+  delete[] slots;
+}
+
+/* ************************************************************************** */
+/* Assignment operators */
+
+template <typename Data, typename Hash>
+SetHash<Data, Hash>& SetHash<Data, Hash>::operator=(const SetHash& other) {
+  if (this != &other) {
+    SetHash tmp(other);
+    std::swap(*this, tmp);
+  }
+  return *this;
+}
+
+template <typename Data, typename Hash>
+SetHash<Data, Hash>& SetHash<Data, Hash>::operator=(SetHash&& other) noexcept {
+  std::swap(control, other.control);
+  std::swap(slots, other.slots);
+  std::swap(capacity, other.capacity);
+  std::swap(shift, other.shift);
+  std::swap(size, other.size);
+  std::swap(hasher, other.hasher);
+  return *this;
+}
+
+/* ************************************************************************** */
+/* Comparison operators */
+
+template <typename Data, typename Hash>
+bool SetHash<Data, Hash>::operator==(const SetHash& other) const noexcept {
+  if (size != other.size) return false;
+  for (unsigned long i = 0; i < capacity; ++i) {
+    if (control[i] != EmptySlot && !other.Exists(slots[i])) return false;
+  }
+  return true;
+}
+
+template <typename Data, typename Hash>
+bool SetHash<Data, Hash>::operator!=(const SetHash& other) const noexcept {
+  return !(*this == other);
+}
+
+/* ************************************************************************** */
+/* Dictionary functions */
+
+template <typename Data, typename Hash>
+bool SetHash<Data, Hash>::Insert(const Data& dat) {
+  return InsertValue(dat);
+}
+
+template <typename Data, typename Hash>
+bool SetHash<Data, Hash>::Insert(Data&& dat) {
+  return InsertValue(std::move(dat));
+}
+
+template <typename Data, typename Hash>
+bool SetHash<Data, Hash>::Remove(const Data& dat) {
+  if (size == 0) return false;
+  unsigned long hole = Find(dat, Mix(dat));
+  if (hole == capacity) return false;
+
+  // Backward shift: pull forward every later value of the run whose home
+  // is not between the hole and its current slot
+  const unsigned long mask = capacity - 1;
+  for (unsigned long next = (hole + 1) & mask; control[next] != EmptySlot; next = (next + 1) & mask) {
+    unsigned long home = Mix(slots[next]) >> shift;
+    if (((next - home) & mask) >= ((next - hole) & mask)) {
+      slots[hole] = std::move(slots[next]);
+      SetControl(hole, control[next]);
+      hole = next;
+    }
+  }
+  slots[hole] = Data();
+  SetControl(hole, EmptySlot);
+  --size;
+  return true;
+}
+
+/* ************************************************************************** */
+/* TraversableContainer function */
+
+template <typename Data, typename Hash>
+void SetHash<Data, Hash>::Traverse(TraverseFun fun) const {
+  for (unsigned long i = 0; i < capacity; ++i) {
+    if (control[i] != EmptySlot) fun(slots[i]);
+  }
+}
+
+/* ************************************************************************** */
+/* TestableContainer function */
+
+template <typename Data, typename Hash>
+bool SetHash<Data, Hash>::Exists(const Data& dat) const noexcept {
+  return size > 0 && Find(dat, Mix(dat)) != capacity;
+}
+
+/* ************************************************************************** */
+/* ClearableContainer function */
+
+template <typename Data, typename Hash>
+void SetHash<Data, Hash>::Clear() {
+  delete[] control;
+  delete[] slots;
+  control = nullptr;
+  slots = nullptr;
+  capacity = 0;
+  shift = 64;
+  size = 0;
+}
+
+/* ************************************************************************** */
+/* Specific member function */
+
+template <typename Data, typename Hash>
+void SetHash<Data, Hash>::Reserve(unsigned long count) {
+  if (count == 0) return;
+  unsigned long needed = std::bit_ceil((count * LoadDen + LoadNum - 1) / LoadNum + 1);
+  if (needed > capacity) Rehash(needed < MinCapacity ? MinCapacity : needed);
+}
+
+/* ************************************************************************** */
+
+// Auxiliary functions
+
+template <typename Data, typename Hash>
+std::size_t SetHash<Data, Hash>::Mix(const Data& dat) const noexcept {
+  // Fibonacci hashing spreads weak hashes (std::hash<int> is the identity) over the top bits
+  return static_cast<std::size_t>(hasher(dat)) * 0x9E3779B97F4A7C15ULL;
+}
+
+template <typename Data, typename Hash>
+signed char SetHash<Data, Hash>::Tag(std::size_t mix) const noexcept {
+  // The 7 bits just below the home slot: the low bits of a product depend
+  // only on the low bits of the hash, so keys 128 apart would share them
+  return static_cast<signed char>((mix >> (shift - 7)) & 0x7F);
+}
+
+template <typename Data, typename Hash>
+unsigned long SetHash<Data, Hash>::Find(const Data& dat, std::size_t mix) const noexcept {
+  const unsigned long mask = capacity - 1;
+  const signed char tag = Tag(mix);
+  for (unsigned long pos = mix >> shift; ; pos = (pos + GroupWidth) & mask) {
+    for (unsigned int match = MatchByte(control + pos, tag); match != 0; match &= match - 1) {
+      unsigned long slot = (pos + std::countr_zero(match)) & mask;
+      if (slots[slot] == dat) return slot;
+    }
+    // The run of a value has no free slot before it
+    if (MatchEmpty(control + pos) != 0) return capacity;
+  }
+}
+
+template <typename Data, typename Hash>
+unsigned long SetHash<Data, Hash>::FirstEmpty(std::size_t mix) const noexcept {
+  const unsigned long mask = capacity - 1;
+  for (unsigned long pos = mix >> shift; ; pos = (pos + GroupWidth) & mask) {
+    unsigned int empty = MatchEmpty(control + pos);
+    if (empty != 0) return (pos + std::countr_zero(empty)) & mask;
+  }
+}
+
+template <typename Data, typename Hash>
+void SetHash<Data, Hash>::SetControl(unsigned long slot, signed char value) noexcept {
+  control[slot] = value;
+  if (slot < GroupWidth) control[capacity + slot] = value;
+}
+
+template <typename Data, typename Hash>
+template <typename Value>
+bool SetHash<Data, Hash>::InsertValue(Value&& dat) {
+  std::size_t mix = Mix(dat);
+  if (size > 0 && Find(dat, mix) != capacity) return false;
+  if ((size + 1) * LoadDen > capacity * LoadNum) {
+    Rehash(capacity == 0 ? MinCapacity : capacity * 2);
+  }
+  unsigned long slot = FirstEmpty(mix);
+  slots[slot] = std::forward<Value>(dat);
+  SetControl(slot, Tag(mix));
+  ++size;
+  return true;
+}
+
+template <typename Data, typename Hash>
+void SetHash<Data, Hash>::Rehash(unsigned long newCapacity) {
+  signed char* oldControl = control;
+  Data* oldSlots = slots;
+  unsigned long oldCapacity = capacity;
+
+  control = new signed char[newCapacity + GroupWidth];
+  slots = new Data[newCapacity];
+  std::fill(control, control + newCapacity + GroupWidth, EmptySlot);
+  capacity = newCapacity;
+  shift = 64 - std::countr_zero(newCapacity);
+
+  for (unsigned long i = 0; i < oldCapacity; ++i) {
+    if (oldControl[i] != EmptySlot) {
+      // The tag moves with the home slot, so it is taken again at the new size
+      std::size_t mix = Mix(oldSlots[i]);
+      unsigned long slot = FirstEmpty(mix);
+      slots[slot] = std::move(oldSlots[i]);
+      SetControl(slot, Tag(mix));
+    }
+  }
+  delete[] oldControl;
+  delete[] oldSlots;
+}
+
+template <typename Data, typename Hash>
+unsigned int SetHash<Data, Hash>::MatchByte(const signed char* group, signed char value) noexcept {
+#ifdef __SSE2__
+  __m128i ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+  return static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(value))));
+#else
+  unsigned int mask = 0;
+  for (unsigned long i = 0; i < GroupWidth; ++i) {
+    mask |= static_cast<unsigned int>(group[i] == value) << i;
+  }
+  return mask;
+#endif
+}
+
+template <typename Data, typename Hash>
+unsigned int SetHash<Data, Hash>::MatchEmpty(const signed char* group) noexcept {
+#ifdef __SSE2__
+  // EmptySlot is the only control byte with the sign bit set
+  return static_cast<unsigned int>(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(group))));
+#else
+  return MatchByte(group, EmptySlot);
+#endif
+}
+
+/* ************************************************************************** */
+
+}
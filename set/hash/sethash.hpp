@@ -0,0 +1,199 @@
+#ifndef SETHASH_HPP
+#define SETHASH_HPP
+
+/* ************************************************************************** */
+
+#include "../../container/dictionary.hpp"
+#include "../../container/traversable.hpp"
+#include <functional>
+#include <iterator>
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Unordered set on an open-addressing table. Each slot has a control byte
+// (EmptySlot, or the 7 bits of the mixed hash below those of the home slot)
+// and lookups compare 16 control bytes at a time. Removals shift the rest of the probe run back, so the table never
+// holds tombstones.
+template <typename Data, typename Hash = std::hash<Data>>
+class SetHash : public virtual DictionaryContainer<Data>,
+                public virtual TraversableContainer<Data>,
+                public virtual ClearableContainer {
+  // Must extend DictionaryContainer<Data>,
+  //             TraversableContainer<Data>,
+  //             ClearableContainer
+
+private:
+
+  static constexpr unsigned long GroupWidth = 16;
+  static constexpr unsigned long MinCapacity = 16;
+  static constexpr signed char EmptySlot = -128; // Full slots hold values in [0, 127]
+
+  // Linear probe runs stay around one group long below 3/4 load
+  static constexpr unsigned long LoadNum = 3;
+  static constexpr unsigned long LoadDen = 4;
+
+  signed char* control = nullptr; // capacity + GroupWidth bytes: the first group is mirrored at the end
+  Data* slots = nullptr;
+  unsigned long capacity = 0;     // Zero or a power of two
+  unsigned int shift = 64;        // The home slot is the top bits of the mixed hash
+
+  [[no_unique_address]] Hash hasher{};
+
+protected:
+
+  using Container::size;
+
+public:
+
+  /* ************************************************************************ */
+
+  // Forward iterator over the occupied slots (read-only: values must keep their slot)
+  class ConstIterator {
+
+  private:
+
+    const SetHash* set = nullptr;
+    unsigned long index = 0;
+
+    void Skip() noexcept {
+      while (index < set->capacity && set->control[index] == EmptySlot) ++index;
+    }
+
+  public:
+
+    using iterator_concept = std::forward_iterator_tag;
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Data;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Data*;
+    using reference = const Data&;
+
+    ConstIterator() = default;
+    ConstIterator(const SetHash* st, unsigned long idx) noexcept : set(st), index(idx) { Skip(); }
+
+    reference operator*() const noexcept { return set->slots[index]; }
+    pointer operator->() const noexcept { return &set->slots[index]; }
+
+    ConstIterator& operator++() noexcept { ++index; Skip(); return *this; }
+    ConstIterator operator++(int) noexcept { ConstIterator tmp = *this; ++*this; return tmp; }
+
+    friend bool operator==(const ConstIterator& it1, const ConstIterator& it2) noexcept { return it1.index == it2.index; }
+
+  };
+
+  using const_iterator = ConstIterator;
+  using iterator = ConstIterator;
+
+  /* ************************************************************************ */
+
+  // Default constructor
+  SetHash() = default;
+
+  /* ************************************************************************ */
+
+  // Specific constructors
+  explicit SetHash(const Hash&);               // With a given hash object
+  SetHash(const TraversableContainer<Data>&);  // Copy from TraversableContainer
+  SetHash(MappableContainer<Data>&&);          // Move from MappableContainer
+
+  template <ForeignInputRange<Data> Range>
+  SetHash(Range&&);                            // Copy (or move, for prvalue elements) from any input range
+
+  /* ************************************************************************ */
+
+  // Copy constructor
+  SetHash(const SetHash&);
+
+  // Move constructor
+  SetHash(SetHash&&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Destructor
+  ~SetHash();
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  SetHash& operator=(const SetHash&);
+
+  // Move assignment
+  SetHash& operator=(SetHash&&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Comparison operators (same values, in any order)
+  bool operator==(const SetHash&) const noexcept;
+  bool operator!=(const SetHash&) const noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from DictionaryContainer)
+
+  bool Insert(const Data&) override; // Copy
+  bool Insert(Data&&) override;      // Move
+  bool Remove(const Data&) override;
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from TraversableContainer)
+
+  using typename TraversableContainer<Data>::TraverseFun;
+  void Traverse(TraverseFun) const override; // Slot order
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from TestableContainer)
+
+  bool Exists(const Data&) const noexcept override;
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from ClearableContainer)
+
+  void Clear() override;
+
+  /* ************************************************************************ */
+
+  // Specific member function
+
+  void Reserve(unsigned long); // Room for this many values without rehashing
+
+  /* ************************************************************************ */
+
+  // Iterators
+  const_iterator begin() const noexcept { return ConstIterator(this, 0); }
+  const_iterator end() const noexcept { return ConstIterator(this, capacity); }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
+
+protected:
+
+  // Auxiliary functions, if necessary!
+
+  std::size_t Mix(const Data&) const noexcept;
+  signed char Tag(std::size_t) const noexcept;               // Control byte of a full slot
+  unsigned long Find(const Data&, std::size_t) const noexcept; // Slot of the value, or capacity
+  unsigned long FirstEmpty(std::size_t) const noexcept;       // First free slot of the probe run
+  void SetControl(unsigned long, signed char) noexcept;      // Keeps the mirrored group in sync
+
+  template <typename Value>
+  bool InsertValue(Value&&);
+  void Rehash(unsigned long);
+
+  static unsigned int MatchByte(const signed char*, signed char) noexcept; // One bit per matching byte of the group
+  static unsigned int MatchEmpty(const signed char*) noexcept;
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "sethash.cpp"
+
+#endif
@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <utility>
+
 namespace lasd {
 
     /* ************************************************************************** */
@@ -17,11 +20,21 @@ namespace lasd {
       });
     }
     
+    template <typename Data>
+    template <ForeignInputRange<Data> Range>
+    SetLst<Data>::SetLst(Range&& range) {
+      for (auto&& dat : range) {
+        Insert(std::forward<decltype(dat)>(dat));
+      }
+    }
+    
     template <typename Data>
     SetLst<Data>::SetLst(const SetLst& other) : List<Data>(other) {}
     
     template <typename Data>
-    SetLst<Data>::SetLst(SetLst&& other) noexcept : List<Data>(std::move(other)) {}
+    SetLst<Data>::SetLst(SetLst&& other) noexcept : List<Data>(std::move(other)) {
+      other.ResetSkips();
+    }
     
     /* ************************************************************************** */
     /* Assignment operators */
@@ -29,12 +42,15 @@ namespace lasd {
     template <typename Data>
     SetLst<Data>& SetLst<Data>::operator=(const SetLst& other) {
       List<Data>::operator=(other);
+      ResetSkips();
       return *this;
     }
     
     template <typename Data>
     SetLst<Data>& SetLst<Data>::operator=(SetLst&& other) noexcept {
       List<Data>::operator=(std::move(other));
+      ResetSkips();
+      other.ResetSkips();
       return *this;
     }
     
@@ -57,11 +73,7 @@ namespace lasd {
     template <typename Data>
     const Data& SetLst<Data>::Min() const {
       if (this->Empty()) throw std::length_error("Set is empty");
-      const Data* minElem = &this->Front();
-      this->Traverse([&](const Data& dat) {
-        if (dat < *minElem) minElem = &dat;
-      });
-      return *minElem;
+      return this->head->element; // Sorted: the smallest is at the front
     }
     
     template <typename Data>
@@ -81,11 +93,7 @@ namespace lasd {
     template <typename Data>
     const Data& SetLst<Data>::Max() const {
       if (this->Empty()) throw std::length_error("Set is empty");
-      const Data* maxElem = &this->Front();
-      this->Traverse([&](const Data& dat) {
-        if (dat > *maxElem) maxElem = &dat;
-      });
-      return *maxElem;
+      return this->tail->element;
     }
     
     template <typename Data>
@@ -105,14 +113,11 @@ namespace lasd {
     template <typename Data>
     const Data& SetLst<Data>::Predecessor(const Data& dat) const {
       if (this->Empty()) throw std::length_error("Set is empty");
-      const Data* pred = nullptr;
-      this->PreOrderTraverse([&](const Data& curr) {
-        if (curr < dat && (pred == nullptr || curr > *pred)) {
-          pred = &curr;
-        }
-      });
-      if (pred == nullptr) throw std::length_error("No predecessor found");
-      return *pred;
+      Node* prev;
+      Node* curr;
+      Locate(dat, prev, curr);
+      if (prev == nullptr) throw std::length_error("No predecessor found");
+      return prev->element;
     }
     
     template <typename Data>
@@ -132,14 +137,12 @@ namespace lasd {
     template <typename Data>
     const Data& SetLst<Data>::Successor(const Data& dat) const {
       if (this->Empty()) throw std::length_error("Set is empty");
-      const Data* succ = nullptr;
-      this->PreOrderTraverse([&](const Data& curr) {
-        if (curr > dat && (succ == nullptr || curr < *succ)) {
-          succ = &curr;
-        }
-      });
-      if (succ == nullptr) throw std::length_error("No successor found");
-      return *succ;
+      Node* prev;
+      Node* curr;
+      Locate(dat, prev, curr);
+      if (curr != nullptr && !(dat < curr->element)) curr = curr->next; // Skip the value itself
+      if (curr == nullptr) throw std::length_error("No successor found");
+      return curr->element;
     }
     
     template <typename Data>
@@ -156,92 +159,153 @@ namespace lasd {
       Remove(succ);
     }
     
+    /* ************************************************************************** */
+    /* Range queries */
+
+    template <typename Data>
+    const Data& SetLst<Data>::LowerBound(const Data& dat) const {
+      Node* prev;
+      Node* curr;
+      Locate(dat, prev, curr);
+      if (curr == nullptr) throw std::length_error("No lower bound found");
+      return curr->element;
+    }
+
+    template <typename Data>
+    const Data& SetLst<Data>::UpperBound(const Data& dat) const {
+      Node* prev;
+      Node* curr;
+      Locate(dat, prev, curr);
+      if (curr != nullptr && !(dat < curr->element)) curr = curr->next;
+      if (curr == nullptr) throw std::length_error("No upper bound found");
+      return curr->element;
+    }
+
+    template <typename Data>
+    void SetLst<Data>::RangeTraverse(const Data& lo, const Data& hi, RangeFun fun) const {
+      Node* prev;
+      Node* curr;
+      Locate(lo, prev, curr);
+      for (; curr != nullptr && curr->element < hi; curr = curr->next) {
+        fun(curr->element);
+      }
+    }
+
+    template <typename Data>
+    unsigned long SetLst<Data>::RangeRemove(const Data& lo, const Data& hi) {
+      Node* prev;
+      Node* curr;
+      Locate(lo, prev, curr); // The finger stays on prev, outside the run
+
+      // Drop the index entries of the run while their values are still there
+      unsigned long first = SkipLowerBound(lo);
+      unsigned long last = SkipLowerBound(hi);
+      if (first < last) {
+        for (unsigned long i = last; i < skipCount; ++i) skips[first + i - last] = skips[i];
+        skipCount -= last - first;
+      }
+
+      // Unlink the whole run in the same forward pass
+      unsigned long removed = 0;
+      while (curr != nullptr && curr->element < hi) {
+        Node* next = curr->next;
+        delete curr;
+        curr = next;
+        ++removed;
+      }
+      if (removed == 0) return 0;
+
+      if (prev == nullptr) this->head = curr;
+      else prev->next = curr;
+      if (curr == nullptr) this->tail = prev;
+      this->size -= removed;
+      return removed;
+    }
+
     /* ************************************************************************** */
     /* Dictionary functions */
     
     template <typename Data>
     bool SetLst<Data>::Insert(const Data& dat) {
-      typename List<Data>::Node* prev = nullptr;
-      typename List<Data>::Node* curr = this->head;
-    
-      while (curr != nullptr && curr->element < dat) {
-        prev = curr;
-        curr = curr->next;
-      }
+      Node* prev;
+      Node* curr;
+      Locate(dat, prev, curr);
     
       if (curr != nullptr && curr->element == dat) return false;
     
-      typename List<Data>::Node* newNode = new typename List<Data>::Node(dat);
+      Node* newNode = new Node(dat);
 
       newNode->next = curr;
-    
-      if (prev == nullptr) {
-        this->head = newNode;
-        if (this->size == 0) this->tail = newNode;
-      } else {
-        prev->next = newNode;
-        if (curr == nullptr) this->tail = newNode;
-      }
+      if (prev == nullptr) this->head = newNode;
+      else prev->next = newNode;
+      if (curr == nullptr) this->tail = newNode;
     
       ++this->size;
+      finger = newNode; // The next value of an ascending run starts from here
       return true;
     }    
     
     template <typename Data>
     bool SetLst<Data>::Insert(Data&& dat) {
-      typename List<Data>::Node* prev = nullptr;
-      typename List<Data>::Node* curr = this->head;
-    
-      while (curr != nullptr && curr->element < dat) {
-        prev = curr;
-        curr = curr->next;
-      }
+      Node* prev;
+      Node* curr;
+      Locate(dat, prev, curr);
     
       if (curr != nullptr && curr->element == dat) return false;
     
-      typename List<Data>::Node* newNode = new typename List<Data>::Node(std::move(dat));
+      Node* newNode = new Node(std::move(dat));
 
       newNode->next = curr;
-    
-      if (prev == nullptr) {
-        this->head = newNode;
-        if (this->size == 0) this->tail = newNode;
-      } else {
-        prev->next = newNode;
-        if (curr == nullptr) this->tail = newNode;
-      }
+      if (prev == nullptr) this->head = newNode;
+      else prev->next = newNode;
+      if (curr == nullptr) this->tail = newNode;
     
       ++this->size;
+      finger = newNode;
       return true;
     }    
     
     template <typename Data>
     bool SetLst<Data>::Remove(const Data& dat) {
-      typename List<Data>::Node* prev = nullptr;
-      typename List<Data>::Node* curr = this->head;
+      Node* prev;
+      Node* curr;
+      Locate(dat, prev, curr); // The finger is left on prev, never on curr
     
-      while (curr != nullptr && curr->element < dat) {
-        prev = curr;
-        curr = curr->next;
-      }
-    
-      if (curr != nullptr && curr->element == dat) {
-        if (prev == nullptr) {
-          this->head = curr->next;
-          if (this->tail == curr) this->tail = nullptr;
-        } else {
-          prev->next = curr->next;
-          if (this->tail == curr) this->tail = prev;
-        }
-    
-        delete curr;
-        --this->size;
-        return true;
-      }
+      if (curr == nullptr || !(curr->element == dat)) return false;
+
+      DropSkip(curr);
+      if (prev == nullptr) this->head = curr->next;
+      else prev->next = curr->next;
+      if (this->tail == curr) this->tail = prev;
     
-      return false;
+      delete curr;
+      --this->size;
+      return true;
     }    
     
+    /* ************************************************************************** */
+    /* Set algebra */
+
+    template <typename Data>
+    SetLst<Data> SetLst<Data>::Union(const SetLst& other) const {
+      return Merge(other, true, true, true);
+    }
+
+    template <typename Data>
+    SetLst<Data> SetLst<Data>::Intersection(const SetLst& other) const {
+      return Merge(other, false, true, false);
+    }
+
+    template <typename Data>
+    SetLst<Data> SetLst<Data>::Difference(const SetLst& other) const {
+      return Merge(other, true, false, false);
+    }
+
+    template <typename Data>
+    SetLst<Data> SetLst<Data>::SymmetricDifference(const SetLst& other) const {
+      return Merge(other, true, false, true);
+    }
+
     /* ************************************************************************** */
     /* LinearContainer functions */
     
@@ -255,15 +319,43 @@ namespace lasd {
     
     template <typename Data>
     bool SetLst<Data>::Exists(const Data& dat) const noexcept {
-      typename List<Data>::Node* curr = this->head;
-    
-      // Fermati se superi il valore cercato
-      while (curr != nullptr && curr->element < dat) {
-        curr = curr->next;
-      }
-    
+      Node* prev;
+      Node* curr;
+      Locate(dat, prev, curr);
       return (curr != nullptr && curr->element == dat);
     }
+
+    /* ************************************************************************** */
+    /* Set function */
+
+    template <typename Data>
+    unsigned long SetLst<Data>::ExistsBatch(const TraversableContainer<Data>& probes, Vector<bool>& found) const {
+      const unsigned long count = probes.Size();
+      found.Resize(count);
+      Vector<std::pair<Data, unsigned long>> sorted(count); // Each probe with its position
+      unsigned long index = 0;
+      probes.Traverse([&sorted, &index](const Data& dat) {
+        sorted[index] = {dat, index};
+        ++index;
+      });
+      std::sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+      // The walk only goes forward; the index lets it skip runs holding no probe
+      if (this->size >= MinIndexed && this->size > 2 * skipsBuiltAt) BuildSkips();
+      Node* curr = this->head;
+      unsigned long skip = 0;
+      unsigned long hits = 0;
+      for (unsigned long i = 0; i < count; ++i) {
+        const Data& dat = sorted[i].first;
+        while (skip < skipCount && skips[skip]->element < dat) ++skip;
+        if (skip > 0 && curr != nullptr && curr->element < skips[skip - 1]->element) curr = skips[skip - 1];
+        while (curr != nullptr && curr->element < dat) curr = curr->next;
+        const bool hit = (curr != nullptr && curr->element == dat);
+        found[sorted[i].second] = hit;
+        hits += hit;
+      }
+      return hits;
+    }
     
     /* ************************************************************************** */
     /* ClearableContainer function */
@@ -271,6 +363,7 @@ namespace lasd {
     template <typename Data>
     void SetLst<Data>::Clear() {
       List<Data>::Clear();
+      ResetSkips();
     }
     
     /* ************************************************************************** */
@@ -281,10 +374,120 @@ namespace lasd {
       while (this->size > newSize) {
         this->RemoveFromBack();
       }
+      ResetSkips();
     }
 
     /* ************************************************************************** */
 
     // Auxiliary functions
+
+    template <typename Data>
+    SetLst<Data> SetLst<Data>::Merge(const SetLst& other, bool onlyHere, bool both, bool onlyOther) const {
+      SetLst result;
+      typename List<Data>::Node* mine = this->head;
+      typename List<Data>::Node* theirs = other.head;
+
+      // Both lists are sorted: the output comes out sorted too, appended at the back
+      while (mine != nullptr && theirs != nullptr) {
+        if (mine->element < theirs->element) {
+          if (onlyHere) result.InsertAtBack(mine->element);
+          mine = mine->next;
+        } else if (theirs->element < mine->element) {
+          if (onlyOther) result.InsertAtBack(theirs->element);
+          theirs = theirs->next;
+        } else {
+          if (both) result.InsertAtBack(mine->element);
+          mine = mine->next;
+          theirs = theirs->next;
+        }
+      }
+      for (; onlyHere && mine != nullptr; mine = mine->next) result.InsertAtBack(mine->element);
+      for (; onlyOther && theirs != nullptr; theirs = theirs->next) result.InsertAtBack(theirs->element);
+
+      return result;
+    }
+  
+    template <typename Data>
+    void SetLst<Data>::Locate(const Data& dat, Node*& prev, Node*& curr) const {
+      // Past the tail: appending in ascending order costs O(1)
+      if (this->tail != nullptr && this->tail->element < dat) {
+        prev = this->tail;
+        curr = nullptr;
+        finger = prev;
+        return;
+      }
+
+      // Start from the closer of the index entry and the finger below the value
+      prev = SkipBelow(dat);
+      if (finger != nullptr && finger->element < dat && (prev == nullptr || prev->element < finger->element)) {
+        prev = finger;
+      }
+      curr = (prev == nullptr) ? this->head : prev->next;
+      while (curr != nullptr && curr->element < dat) {
+        prev = curr;
+        curr = curr->next;
+      }
+      finger = prev;
+    }
+
+    template <typename Data>
+    typename SetLst<Data>::Node* SetLst<Data>::SkipBelow(const Data& dat) const {
+      // Rebuilding only on doubling keeps the cost amortized O(1) per insertion
+      if (this->size >= MinIndexed && this->size > 2 * skipsBuiltAt) BuildSkips();
+      unsigned long index = SkipLowerBound(dat);
+      return (index == 0) ? nullptr : skips[index - 1];
+    }
+
+    template <typename Data>
+    unsigned long SetLst<Data>::SkipLowerBound(const Data& dat) const noexcept {
+      unsigned long lo = 0;
+      unsigned long hi = skipCount;
+      while (lo < hi) {
+        unsigned long mid = lo + (hi - lo) / 2;
+        if (skips[mid]->element < dat) lo = mid + 1;
+        else hi = mid;
+      }
+      return lo;
+    }
+
+    template <typename Data>
+    void SetLst<Data>::BuildSkips() const noexcept {
+      unsigned long needed = this->size / SkipStride;
+      skipCount = 0;
+      if (skips.Size() < needed) {
+        try {
+          skips.Resize(needed);
+        } catch (...) {
+          skipsBuiltAt = this->size; // Walk the list until the next doubling tries again
+          return;
+        }
+      }
+      unsigned long position = 0;
+      for (Node* curr = this->head; curr != nullptr; curr = curr->next, ++position) {
+        if (position % SkipStride == SkipStride - 1) skips[skipCount++] = curr;
+      }
+      skipsBuiltAt = this->size;
+    }
+
+    template <typename Data>
+    void SetLst<Data>::DropSkip(Node* node) noexcept {
+      unsigned long index = SkipLowerBound(node->element);
+      if (index == skipCount || skips[index] != node) return;
+
+      // Hand the entry to the next node, unless that one is indexed already
+      Node* next = node->next;
+      if (next != nullptr && (index + 1 == skipCount || skips[index + 1] != next)) {
+        skips[index] = next;
+        return;
+      }
+      for (unsigned long i = index + 1; i < skipCount; ++i) skips[i - 1] = skips[i];
+      --skipCount;
+    }
+
+    template <typename Data>
+    void SetLst<Data>::ResetSkips() noexcept {
+      skipCount = 0;
+      skipsBuiltAt = 0;
+      finger = nullptr;
+    }
   }
-    
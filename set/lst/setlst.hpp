@@ -5,6 +5,7 @@
 
 #include "../set.hpp"
 #include "../../list/list.hpp"
+#include "../../vector/vector.hpp"
 
 /* ************************************************************************** */
 
@@ -12,6 +13,14 @@ namespace lasd {
 
 /* ************************************************************************** */
 
+// Sorted singly linked list. Searches do not always start from head: a
+// value past the tail is found in O(1), and otherwise the walk starts from
+// the closer of two nodes already known to be below the target. One is the
+// finger, the node where the previous search stopped. The other comes from a
+// sparse index of every SkipStride-th node, searched by bisection. The index
+// is rebuilt lazily once the list has doubled. Removals patch it in place.
+// Const queries move the finger and may rebuild the index, so concurrent
+// readers need external locking.
 template <typename Data>
 class SetLst : virtual public Set<Data>,
                virtual protected List<Data>,
@@ -21,7 +30,15 @@ class SetLst : virtual public Set<Data>,
 
 private:
 
-  // ...
+  using Node = typename List<Data>::Node;
+
+  static constexpr unsigned long SkipStride = 16;         // Nodes between two index entries after a rebuild
+  static constexpr unsigned long MinIndexed = 2 * SkipStride;
+
+  mutable Vector<Node*> skips;           // Sorted, distinct nodes of the list (the first skipCount slots)
+  mutable unsigned long skipCount = 0;
+  mutable unsigned long skipsBuiltAt = 0; // Size at the last rebuild, zero when reset
+  mutable Node* finger = nullptr;         // Last node found below a searched value
 
 protected:
 
@@ -35,6 +52,8 @@ public:
   using LinearContainer<Data>::Traverse;
   using LinearContainer<Data>::PreOrderTraverse;
   using LinearContainer<Data>::PostOrderTraverse;
+  using DictionaryContainer<Data>::InsertAll;
+  using DictionaryContainer<Data>::InsertSome;
 
   // Default constructor
   SetLst() = default;
@@ -45,6 +64,9 @@ public:
   SetLst(const TraversableContainer<Data>&); // Copy from TraversableContainer
   SetLst(MappableContainer<Data>&&);         // Move from MappableContainer
 
+  template <ForeignInputRange<Data> Range>
+  SetLst(Range&&);                           // Copy (or move, for prvalue elements) from any input range
+
   /* ************************************************************************ */
 
   // Copy constructor
@@ -92,6 +114,12 @@ public:
   Data SuccessorNRemove(const Data&) override;
   void RemoveSuccessor(const Data&) override;
 
+  using typename OrderedDictionaryContainer<Data>::RangeFun;
+  const Data& LowerBound(const Data&) const override;
+  const Data& UpperBound(const Data&) const override;
+  void RangeTraverse(const Data&, const Data&, RangeFun) const override;
+  unsigned long RangeRemove(const Data&, const Data&) override;
+
   /* ************************************************************************ */
 
   // Specific member functions (inherited from DictionaryContainer)
@@ -102,6 +130,15 @@ public:
 
   /* ************************************************************************ */
 
+  // Specific member functions (set algebra, single sorted merge)
+
+  SetLst Union(const SetLst&) const;
+  SetLst Intersection(const SetLst&) const;
+  SetLst Difference(const SetLst&) const;          // Values here but not in the other
+  SetLst SymmetricDifference(const SetLst&) const;
+
+  /* ************************************************************************ */
+
   // Specific member functions (inherited from LinearContainer)
 
   const Data& operator[](unsigned long) const override;
@@ -114,6 +151,13 @@ public:
 
   /* ************************************************************************ */
 
+  // Specific member function (inherited from Set)
+
+  // Sorts a copy of the probes, then answers them all in one walk of the list
+  unsigned long ExistsBatch(const TraversableContainer<Data>&, Vector<bool>&) const override;
+
+  /* ************************************************************************ */
+
   // Specific member function (inherited from ClearableContainer)
 
   void Clear() override;
@@ -125,10 +169,32 @@ public:
   // Resize the container to the given size by removing elements from the back if the size is reduced.
   void Resize(unsigned long) override;
 
+  /* ************************************************************************ */
+
+  // Iterators (read-only: elements must stay ordered)
+  using const_iterator = typename List<Data>::const_iterator;
+  using iterator = const_iterator;
+
+  const_iterator begin() const noexcept { return List<Data>::cbegin(); }
+  const_iterator end() const noexcept { return List<Data>::cend(); }
+  const_iterator cbegin() const noexcept { return List<Data>::cbegin(); }
+  const_iterator cend() const noexcept { return List<Data>::cend(); }
+
 protected:
 
   // Auxiliary functions, if necessary!
 
+  SetLst Merge(const SetLst&, bool, bool, bool) const; // Keeps values only here / in both / only in the other
+
+  // Last node below the value (nullptr if none) and the node after it
+  void Locate(const Data&, Node*&, Node*&) const;
+
+  Node* SkipBelow(const Data&) const;                      // Last index entry below the value, rebuilding if stale
+  unsigned long SkipLowerBound(const Data&) const noexcept; // First index slot not below the value
+  void BuildSkips() const noexcept;                         // Without memory for the index, searches walk the list
+  void DropSkip(Node*) noexcept;                           // Before unlinking a node: keeps the index valid
+  void ResetSkips() noexcept;                              // After changes the index cannot follow
+
 };
 
 /* ************************************************************************** */
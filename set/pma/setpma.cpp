@@ -0,0 +1,628 @@
+#include <algorithm>
+#include <bit>
+#include <utility>
+
+namespace lasd {
+
+/* ************************************************************************** */
+/* Constructors */
+
+template <typename Data>
+SetPMA<Data>::SetPMA(const TraversableContainer<Data>& container) {
+  Data* values = new Data[container.Size()];
+  unsigned long count = 0;
+  container.Traverse([values, &count](const Data& dat) { values[count++] = dat; });
+  Build(values, count);
+  delete[] values;
+}
+
+template <typename Data>
+SetPMA<Data>::SetPMA(MappableContainer<Data>&& container) {
+  Data* values = new Data[container.Size()];
+  unsigned long count = 0;
+  container.Map([values, &count](Data& dat) { values[count++] = std::move(dat); });
+  Build(values, count);
+  delete[] values;
+}
+
+template <typename Data>
+template <ForeignInputRange<Data> Range>
+SetPMA<Data>::SetPMA(Range&& range) {
+  // The length may be unknown: collect into a doubling buffer
+  Data* values = nullptr;
+  unsigned long count = 0;
+  unsigned long room = 0;
+  for (auto&& dat : range) {
+    if (count == room) {
+      room = (room == 0) ? MinCapacity : room * 2;
+      Data* larger = new Data[room];
+      std::move(values, values + count, larger);
+      delete[] values;
+      values = larger;
+    }
+    values[count++] = dat;
+  }
+  Build(values, count);
+  delete[] values;
+}
+
+template <typename Data>
+SetPMA<Data>::SetPMA(const SetPMA& other) {
+  if (other.size > 0) {
+    Allocate(other.capacity);
+    for (unsigned long seg = 0; seg < segments; ++seg) {
+      const Data* base = other.slots + seg * segmentSize;
+      std::copy(base, base + other.counts[seg], slots + seg * segmentSize);
+      counts[seg] = other.counts[seg];
+      heads[seg] = other.heads[seg];
+    }
+    size = other.size;
+  }
+}
+
+template <typename Data>
+SetPMA<Data>::SetPMA(SetPMA&& other) noexcept {
+  std::swap(slots, other.slots);
+  std::swap(counts, other.counts);
+  std::swap(heads, other.heads);
+  std::swap(capacity, other.capacity);
+  std::swap(segmentSize, other.segmentSize);
+  std::swap(segments, other.segments);
+  std::swap(height, other.height);
+  std::swap(size, other.size);
+}
+
+/* ************************************************************************** */
+/* Destructor */
+
+template <typename Data>
+SetPMA<Data>::~SetPMA() {
+  Release();
+}
+
+/* ************************************************************************** */
+/* Assignment operators */
+
+template <typename Data>
+SetPMA<Data>& SetPMA<Data>::operator=(const SetPMA& other) {
+  if (this != &other) {
+    SetPMA tmp(other);
+    std::swap(*this, tmp);
+  }
+  return *this;
+}
+
+template <typename Data>
+SetPMA<Data>& SetPMA<Data>::operator=(SetPMA&& other) noexcept {
+  std::swap(slots, other.slots);
+  std::swap(counts, other.counts);
+  std::swap(heads, other.heads);
+  std::swap(capacity, other.capacity);
+  std::swap(segmentSize, other.segmentSize);
+  std::swap(segments, other.segments);
+  std::swap(height, other.height);
+  std::swap(size, other.size);
+  return *this;
+}
+
+/* ************************************************************************** */
+/* Comparison operators */
+
+template <typename Data>
+bool SetPMA<Data>::operator==(const SetPMA& other) const noexcept {
+  if (size != other.size) return false;
+  // The gaps may fall differently: walk both in order
+  unsigned long seg = 0;
+  unsigned long off = 0;
+  for (unsigned long s = 0; s < segments; ++s) {
+    for (unsigned long i = 0; i < counts[s]; ++i) {
+      while (off == other.counts[seg]) {
+        ++seg;
+        off = 0;
+      }
+      const Data& theirs = other.slots[seg * other.segmentSize + off++];
+      const Data& mine = slots[s * segmentSize + i];
+      if (mine < theirs || theirs < mine) return false;
+    }
+  }
+  return true;
+}
+
+template <typename Data>
+bool SetPMA<Data>::operator!=(const SetPMA& other) const noexcept {
+  return !(*this == other);
+}
+
+/* ************************************************************************** */
+/* Min / Max */
+
+template <typename Data>
+const Data& SetPMA<Data>::Min() const {
+  if (size == 0) throw std::length_error("Empty set");
+  return slots[0];
+}
+
+template <typename Data>
+Data SetPMA<Data>::MinNRemove() {
+  Data value = Min();
+  Remove(value);
+  return value;
+}
+
+template <typename Data>
+void SetPMA<Data>::RemoveMin() {
+  (void)MinNRemove();
+}
+
+template <typename Data>
+const Data& SetPMA<Data>::Max() const {
+  if (size == 0) throw std::length_error("Empty set");
+  return slots[(segments - 1) * segmentSize + counts[segments - 1] - 1];
+}
+
+template <typename Data>
+Data SetPMA<Data>::MaxNRemove() {
+  Data value = Max();
+  Remove(value);
+  return value;
+}
+
+template <typename Data>
+void SetPMA<Data>::RemoveMax() {
+  (void)MaxNRemove();
+}
+
+/* ************************************************************************** */
+/* Predecessor / Successor */
+
+template <typename Data>
+const Data& SetPMA<Data>::Predecessor(const Data& dat) const {
+  const Data* found = Below(dat);
+  if (found == nullptr) throw std::length_error("No predecessor");
+  return *found;
+}
+
+template <typename Data>
+Data SetPMA<Data>::PredecessorNRemove(const Data& dat) {
+  Data value = Predecessor(dat);
+  Remove(value);
+  return value;
+}
+
+template <typename Data>
+void SetPMA<Data>::RemovePredecessor(const Data& dat) {
+  (void)PredecessorNRemove(dat);
+}
+
+template <typename Data>
+const Data& SetPMA<Data>::Successor(const Data& dat) const {
+  const Data* found = Above(dat);
+  if (found == nullptr) throw std::length_error("No successor");
+  return *found;
+}
+
+template <typename Data>
+Data SetPMA<Data>::SuccessorNRemove(const Data& dat) {
+  Data value = Successor(dat);
+  Remove(value);
+  return value;
+}
+
+template <typename Data>
+void SetPMA<Data>::RemoveSuccessor(const Data& dat) {
+  (void)SuccessorNRemove(dat);
+}
+
+/* ************************************************************************** */
+/* Bounds and ranges */
+
+template <typename Data>
+const Data& SetPMA<Data>::LowerBound(const Data& dat) const {
+  const Data* found = AtLeast(dat);
+  if (found == nullptr) throw std::length_error("No lower bound");
+  return *found;
+}
+
+template <typename Data>
+const Data& SetPMA<Data>::UpperBound(const Data& dat) const {
+  const Data* found = Above(dat);
+  if (found == nullptr) throw std::length_error("No upper bound");
+  return *found;
+}
+
+template <typename Data>
+void SetPMA<Data>::RangeTraverse(const Data& lo, const Data& hi, RangeFun fun) const {
+  if (!(lo < hi) || size == 0) return;
+  unsigned long seg = SegmentOf(lo);
+  unsigned long off = LowerOffset(seg, lo);
+  for (; seg < segments; ++seg, off = 0) {
+    for (; off < counts[seg]; ++off) {
+      const Data& dat = slots[seg * segmentSize + off];
+      if (!(dat < hi)) return;
+      fun(dat);
+    }
+  }
+}
+
+template <typename Data>
+unsigned long SetPMA<Data>::RangeCount(const Data& lo, const Data& hi) const {
+  if (!(lo < hi) || size == 0) return 0;
+  const unsigned long first = SegmentOf(lo);
+  const unsigned long last = SegmentOf(hi);
+  unsigned long count = 0;
+  for (unsigned long seg = first; seg < last; ++seg) count += counts[seg];
+  return count + LowerOffset(last, hi) - LowerOffset(first, lo);
+}
+
+template <typename Data>
+unsigned long SetPMA<Data>::RangeRemove(const Data& lo, const Data& hi) {
+  const unsigned long removed = RangeCount(lo, hi);
+  if (removed == 0) return 0;
+  if (removed == size) {
+    Clear();
+    return removed;
+  }
+  // Close the range segment by segment, then spread what is left over a fitting buffer
+  const unsigned long first = SegmentOf(lo);
+  const unsigned long last = SegmentOf(hi);
+  for (unsigned long seg = first; seg <= last; ++seg) {
+    Data* base = slots + seg * segmentSize;
+    const unsigned long from = (seg == first) ? LowerOffset(seg, lo) : 0;
+    const unsigned long to = (seg == last) ? LowerOffset(seg, hi) : counts[seg];
+    std::move(base + to, base + counts[seg], base + from);
+    counts[seg] -= to - from;
+  }
+  size -= removed;
+  Rebuild(CapacityFor(size));
+  return removed;
+}
+
+/* ************************************************************************** */
+/* Insert / Remove */
+
+template <typename Data>
+bool SetPMA<Data>::Insert(const Data& dat) {
+  return InsertValue(dat);
+}
+
+template <typename Data>
+bool SetPMA<Data>::Insert(Data&& dat) {
+  return InsertValue(std::move(dat));
+}
+
+template <typename Data>
+bool SetPMA<Data>::Remove(const Data& dat) {
+  if (size == 0) return false;
+  const unsigned long seg = SegmentOf(dat);
+  const unsigned long off = LowerOffset(seg, dat);
+  Data* base = slots + seg * segmentSize;
+  if (off == counts[seg] || dat < base[off]) return false;
+  std::move(base + off + 1, base + counts[seg], base + off);
+  if (--counts[seg] > 0 && off == 0) heads[seg] = base[0];
+  if (--size == 0) {
+    Release();
+  } else if (segments > 1 && double(counts[seg]) < LowerDensity(0) * double(segmentSize)) {
+    RefillWindow(seg);
+  }
+  return true;
+}
+
+/* ************************************************************************** */
+/* LinearContainer functions */
+
+template <typename Data>
+const Data& SetPMA<Data>::operator[](unsigned long index) const {
+  if (index >= size) throw std::out_of_range("Index out of range");
+  unsigned long seg = 0;
+  for (; index >= counts[seg]; ++seg) index -= counts[seg];
+  return slots[seg * segmentSize + index];
+}
+
+/* ************************************************************************** */
+/* TraversableContainer functions */
+
+template <typename Data>
+void SetPMA<Data>::Traverse(TraverseFun fun) const {
+  PreOrderTraverse(fun);
+}
+
+template <typename Data>
+void SetPMA<Data>::PreOrderTraverse(TraverseFun fun) const {
+  for (unsigned long seg = 0; seg < segments; ++seg) {
+    const Data* base = slots + seg * segmentSize;
+    for (unsigned long i = 0; i < counts[seg]; ++i) fun(base[i]);
+  }
+}
+
+template <typename Data>
+void SetPMA<Data>::PostOrderTraverse(TraverseFun fun) const {
+  for (unsigned long seg = segments; seg-- > 0;) {
+    const Data* base = slots + seg * segmentSize;
+    for (unsigned long i = counts[seg]; i-- > 0;) fun(base[i]);
+  }
+}
+
+/* ************************************************************************** */
+/* TestableContainer functions */
+
+template <typename Data>
+bool SetPMA<Data>::Exists(const Data& dat) const noexcept {
+  if (size == 0) return false;
+  const unsigned long seg = SegmentOf(dat);
+  const unsigned long off = LowerOffset(seg, dat);
+  return off < counts[seg] && !(dat < slots[seg * segmentSize + off]);
+}
+
+/* ************************************************************************** */
+/* Clear / Resize */
+
+template <typename Data>
+void SetPMA<Data>::Clear() {
+  Release();
+  size = 0;
+}
+
+template <typename Data>
+void SetPMA<Data>::Resize(unsigned long newSize) {
+  if (newSize == 0) {
+    Clear();
+  } else if (newSize < size) {
+    size = newSize;
+    Rebuild(CapacityFor(size));
+  }
+}
+
+/* ************************************************************************** */
+/* Specific functions */
+
+template <typename Data>
+unsigned long SetPMA<Data>::Capacity() const noexcept {
+  return capacity;
+}
+
+/* ************************************************************************** */
+/* Auxiliary functions: positions */
+
+template <typename Data>
+unsigned long SetPMA<Data>::SegmentOf(const Data& dat) const noexcept {
+  // Every segment holds a value, so the heads are sorted
+  if (segments <= 1) return 0;
+  return std::upper_bound(heads + 1, heads + segments, dat) - heads - 1;
+}
+
+template <typename Data>
+unsigned long SetPMA<Data>::LowerOffset(unsigned long seg, const Data& dat) const noexcept {
+  const Data* base = slots + seg * segmentSize;
+  return std::lower_bound(base, base + counts[seg], dat) - base;
+}
+
+template <typename Data>
+unsigned long SetPMA<Data>::UpperOffset(unsigned long seg, const Data& dat) const noexcept {
+  const Data* base = slots + seg * segmentSize;
+  return std::upper_bound(base, base + counts[seg], dat) - base;
+}
+
+template <typename Data>
+const Data* SetPMA<Data>::AtLeast(const Data& dat) const noexcept {
+  if (size == 0) return nullptr;
+  const unsigned long seg = SegmentOf(dat);
+  const unsigned long off = LowerOffset(seg, dat);
+  if (off < counts[seg]) return slots + seg * segmentSize + off;
+  return (seg + 1 < segments) ? slots + (seg + 1) * segmentSize : nullptr;
+}
+
+template <typename Data>
+const Data* SetPMA<Data>::Above(const Data& dat) const noexcept {
+  if (size == 0) return nullptr;
+  const unsigned long seg = SegmentOf(dat);
+  const unsigned long off = UpperOffset(seg, dat);
+  if (off < counts[seg]) return slots + seg * segmentSize + off;
+  return (seg + 1 < segments) ? slots + (seg + 1) * segmentSize : nullptr;
+}
+
+template <typename Data>
+const Data* SetPMA<Data>::Below(const Data& dat) const noexcept {
+  if (size == 0) return nullptr;
+  const unsigned long seg = SegmentOf(dat);
+  const unsigned long off = LowerOffset(seg, dat);
+  if (off > 0) return slots + seg * segmentSize + off - 1;
+  return (seg > 0) ? slots + (seg - 1) * segmentSize + counts[seg - 1] - 1 : nullptr;
+}
+
+/* ************************************************************************** */
+/* Auxiliary functions: updates */
+
+template <typename Data>
+template <typename Value>
+bool SetPMA<Data>::InsertValue(Value&& dat) {
+  if (capacity == 0) Allocate(MinCapacity);
+  const unsigned long seg = SegmentOf(dat);
+  const unsigned long off = LowerOffset(seg, dat);
+  Data* base = slots + seg * segmentSize;
+  if (off < counts[seg] && !(dat < base[off])) return false;
+  if (counts[seg] < segmentSize) {
+    std::move_backward(base + off, base + counts[seg], base + counts[seg] + 1);
+    base[off] = std::forward<Value>(dat);
+    if (off == 0) heads[seg] = base[0];
+    ++counts[seg];
+  } else {
+    InsertIntoWindow(seg, std::forward<Value>(dat));
+  }
+  ++size;
+  return true;
+}
+
+template <typename Data>
+template <typename Value>
+void SetPMA<Data>::InsertIntoWindow(unsigned long seg, Value&& dat) {
+  // Smallest window that stays within its upper threshold with the new value
+  unsigned long level = 0;
+  unsigned long width = 1;
+  unsigned long first = seg;
+  unsigned long total = counts[seg];
+  while (double(total + 1) > UpperDensity(level) * double(width * segmentSize)) {
+    if (width == segments) {
+      // Even the whole buffer is too dense: double it, then the segment has room
+      Rebuild(capacity * 2);
+      const unsigned long target = SegmentOf(dat);
+      const unsigned long off = LowerOffset(target, dat);
+      Data* base = slots + target * segmentSize;
+      std::move_backward(base + off, base + counts[target], base + counts[target] + 1);
+      base[off] = std::forward<Value>(dat);
+      if (off == 0) heads[target] = base[0];
+      ++counts[target];
+      return;
+    }
+    const unsigned long sibling = (first & width) ? first - width : first + width;
+    for (unsigned long s = sibling; s < sibling + width; ++s) total += counts[s];
+    first = std::min(first, sibling);
+    width *= 2;
+    ++level;
+  }
+  // Merge the value into the packed window, then spread it
+  Compact(first, width);
+  Data* base = slots + first * segmentSize;
+  Data* pos = std::lower_bound(base, base + total, dat);
+  std::move_backward(pos, base + total, base + total + 1);
+  *pos = std::forward<Value>(dat);
+  Spread(first, width, total + 1);
+}
+
+template <typename Data>
+void SetPMA<Data>::RefillWindow(unsigned long seg) {
+  // Smallest enclosing window that stays within its lower threshold
+  unsigned long level = 0;
+  unsigned long width = 1;
+  unsigned long first = seg;
+  unsigned long total = counts[seg];
+  do {
+    if (width == segments) {
+      // Even the whole buffer is too sparse: shrink it
+      Rebuild(CapacityFor(size));
+      return;
+    }
+    const unsigned long sibling = (first & width) ? first - width : first + width;
+    for (unsigned long s = sibling; s < sibling + width; ++s) total += counts[s];
+    first = std::min(first, sibling);
+    width *= 2;
+    ++level;
+  } while (double(total) < LowerDensity(level) * double(width * segmentSize));
+  Compact(first, width);
+  Spread(first, width, total);
+}
+
+/* ************************************************************************** */
+/* Auxiliary functions: densities */
+
+template <typename Data>
+double SetPMA<Data>::UpperDensity(unsigned long level) const noexcept {
+  if (height == 0) return RootUpper;
+  return SegmentUpper - (SegmentUpper - RootUpper) * double(level) / double(height);
+}
+
+template <typename Data>
+double SetPMA<Data>::LowerDensity(unsigned long level) const noexcept {
+  if (height == 0) return RootLower;
+  return SegmentLower + (RootLower - SegmentLower) * double(level) / double(height);
+}
+
+template <typename Data>
+unsigned long SetPMA<Data>::CapacityFor(unsigned long count) noexcept {
+  // Below 4 * count, so every segment gets a value when there are several
+  return std::max(MinCapacity, std::bit_ceil(2 * count));
+}
+
+template <typename Data>
+unsigned long SetPMA<Data>::SegmentFor(unsigned long slotCount) noexcept {
+  const unsigned long logarithm = std::countr_zero(slotCount);
+  return std::max(MinSegment, std::bit_ceil(logarithm));
+}
+
+/* ************************************************************************** */
+/* Auxiliary functions: layout */
+
+template <typename Data>
+void SetPMA<Data>::Compact(unsigned long first, unsigned long width) {
+  Data* target = slots + first * segmentSize;
+  for (unsigned long seg = first; seg < first + width; ++seg) {
+    Data* base = slots + seg * segmentSize;
+    if (base != target) std::move(base, base + counts[seg], target);
+    target += counts[seg];
+  }
+}
+
+template <typename Data>
+void SetPMA<Data>::Spread(unsigned long first, unsigned long width, unsigned long total) {
+  // Right to left, so every run moves toward higher slots past values already placed
+  Data* base = slots + first * segmentSize;
+  for (unsigned long j = width; j-- > 0;) {
+    const unsigned long from = total * j / width;
+    const unsigned long to = total * (j + 1) / width;
+    Data* target = base + j * segmentSize;
+    if (target != base + from) std::move_backward(base + from, base + to, target + (to - from));
+    counts[first + j] = to - from;
+    if (to > from) heads[first + j] = *target;
+  }
+}
+
+template <typename Data>
+void SetPMA<Data>::Rebuild(unsigned long newCapacity) {
+  Data* oldSlots = slots;
+  unsigned long* oldCounts = counts;
+  Data* oldHeads = heads;
+  const unsigned long oldSegmentSize = segmentSize;
+  Allocate(newCapacity);
+  unsigned long moved = 0;
+  for (unsigned long seg = 0; moved < size; ++seg) {
+    const unsigned long take = std::min(oldCounts[seg], size - moved);
+    Data* from = oldSlots + seg * oldSegmentSize;
+    std::move(from, from + take, slots + moved);
+    moved += take;
+  }
+  delete[] oldSlots;
+  delete[] oldCounts;
+  delete[] oldHeads;
+  Spread(0, segments, size);
+}
+
+template <typename Data>
+void SetPMA<Data>::Build(Data* values, unsigned long count) {
+  std::sort(values, values + count);
+  count = std::unique(values, values + count, [](const Data& a, const Data& b) {
+    return !(a < b) && !(b < a);
+  }) - values;
+  if (count == 0) return;
+  Allocate(CapacityFor(count));
+  std::move(values, values + count, slots);
+  size = count;
+  Spread(0, segments, size);
+}
+
+template <typename Data>
+void SetPMA<Data>::Allocate(unsigned long newCapacity) {
+  capacity = newCapacity;
+  segmentSize = SegmentFor(capacity);
+  segments = capacity / segmentSize;
+  height = std::countr_zero(segments);
+  slots = new Data[capacity];
+  counts = new unsigned long[segments]();
+  heads = new Data[segments];
+}
+
+template <typename Data>
+void SetPMA<Data>::Release() noexcept {
+  delete[] slots;
+  delete[] counts;
+  delete[] heads;
+  slots = nullptr;
+  counts = nullptr;
+  heads = nullptr;
+  capacity = 0;
+  segmentSize = 0;
+  segments = 0;
+  height = 0;
+}
+
+/* ************************************************************************** */
+
+}
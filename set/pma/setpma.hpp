@@ -0,0 +1,227 @@
+#ifndef SETPMA_HPP
+#define SETPMA_HPP
+
+/* ************************************************************************** */
+
+#include "../set.hpp"
+#include <stdexcept>
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Sorted set on a packed memory array: one contiguous buffer, kept in order,
+// with gaps spread through it so that an insertion only shifts a few slots.
+// The buffer (a power of two) is cut into segments of about log2(capacity)
+// slots; each segment keeps its values packed at its start, in order, and
+// every segment holds at least one value, so a search is a binary search over
+// the first value of each segment (copied to a small array of their own, which
+// stays in cache) followed by one inside a segment.
+//
+// Aligned runs of 1, 2, 4, ... segments form the windows of an implicit
+// binary tree. Each window must keep its density (values over slots) between
+// a lower and an upper threshold, loosest at the segments and tightest at the
+// whole buffer. An insertion into a full segment (or a removal that empties
+// one) climbs to the smallest enclosing window still within its thresholds
+// and spreads its values evenly; when even the whole buffer is outside them,
+// the capacity doubles or halves. This costs O(log^2 n) moves amortized per
+// update, while the values stay in ascending order in memory for Traverse.
+//
+// operator[] and the range functions find positions by adding up segment
+// counts, so they cost O(n / log n) in the worst case.
+template <typename Data>
+class SetPMA : public virtual Set<Data>,
+               public virtual ResizableContainer {
+  // Must extend Set<Data>,
+  //             ResizableContainer
+
+private:
+
+  static constexpr unsigned long MinSegment = 8;          // Slots of a segment, at least
+  static constexpr unsigned long MinCapacity = MinSegment; // A single segment
+
+  // Density thresholds, linear in the depth of the window
+  static constexpr double SegmentUpper = 1.0;
+  static constexpr double RootUpper = 0.75;
+  static constexpr double SegmentLower = 0.125;
+  static constexpr double RootLower = 0.25;
+
+  Data* slots = nullptr;
+  unsigned long* counts = nullptr; // Values packed at the start of each segment
+  Data* heads = nullptr;           // First value of each segment
+  unsigned long capacity = 0;      // Zero or a power of two
+  unsigned long segmentSize = 0;   // A power of two dividing capacity
+  unsigned long segments = 0;
+  unsigned long height = 0;        // log2(segments)
+
+protected:
+
+  using Container::size;
+
+public:
+
+  // Bring base class methods into scope
+  using LinearContainer<Data>::operator==;
+  using LinearContainer<Data>::operator!=;
+  using DictionaryContainer<Data>::InsertAll;
+  using DictionaryContainer<Data>::InsertSome;
+
+  /* ************************************************************************ */
+
+  // Default constructor
+  SetPMA() = default;
+
+  /* ************************************************************************ */
+
+  // Specific constructors (the values are sorted once and spread evenly)
+  SetPMA(const TraversableContainer<Data>&); // Copy from TraversableContainer
+  SetPMA(MappableContainer<Data>&&);         // Move from MappableContainer
+
+  template <ForeignInputRange<Data> Range>
+  SetPMA(Range&&);                           // Copy from any input range
+
+  /* ************************************************************************ */
+
+  // Copy constructor
+  SetPMA(const SetPMA&);
+
+  // Move constructor
+  SetPMA(SetPMA&&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Destructor
+  ~SetPMA();
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  SetPMA& operator=(const SetPMA&);
+
+  // Move assignment
+  SetPMA& operator=(SetPMA&&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Comparison operators
+  bool operator==(const SetPMA&) const noexcept;
+  bool operator!=(const SetPMA&) const noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from OrderedDictionaryContainer)
+
+  const Data& Min() const override;
+  Data MinNRemove() override;
+  void RemoveMin() override;
+
+  const Data& Max() const override;
+  Data MaxNRemove() override;
+  void RemoveMax() override;
+
+  const Data& Predecessor(const Data&) const override;
+  Data PredecessorNRemove(const Data&) override;
+  void RemovePredecessor(const Data&) override;
+
+  const Data& Successor(const Data&) const override;
+  Data SuccessorNRemove(const Data&) override;
+  void RemoveSuccessor(const Data&) override;
+
+  using typename OrderedDictionaryContainer<Data>::RangeFun;
+  const Data& LowerBound(const Data&) const override;
+  const Data& UpperBound(const Data&) const override;
+  void RangeTraverse(const Data&, const Data&, RangeFun) const override;
+  unsigned long RangeCount(const Data&, const Data&) const override;
+  unsigned long RangeRemove(const Data&, const Data&) override; // Rebuilds the buffer once
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from DictionaryContainer)
+
+  bool Insert(const Data&) override; // Copy
+  bool Insert(Data&&) override;      // Move
+  bool Remove(const Data&) override;
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from LinearContainer)
+
+  const Data& operator[](unsigned long) const override; // Adds up segment counts
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from TraversableContainer)
+
+  using typename TraversableContainer<Data>::TraverseFun;
+  void Traverse(TraverseFun) const override;
+  void PreOrderTraverse(TraverseFun) const override;  // Ascending order
+  void PostOrderTraverse(TraverseFun) const override; // Descending order
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from TestableContainer)
+
+  bool Exists(const Data&) const noexcept override;
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from ClearableContainer)
+
+  void Clear() override;
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from ResizableContainer)
+
+  // Resize the container to the given size by removing the largest elements if the size is reduced.
+  void Resize(unsigned long) override;
+
+  /* ************************************************************************ */
+
+  // Specific member function
+
+  unsigned long Capacity() const noexcept; // Slots in the buffer, gaps included
+
+protected:
+
+  // Auxiliary functions, if necessary!
+
+  // Positions: a segment and an offset inside its packed values
+  unsigned long SegmentOf(const Data&) const noexcept; // Last segment starting at or below, else the first
+  unsigned long LowerOffset(unsigned long, const Data&) const noexcept; // First value not below, in a segment
+  unsigned long UpperOffset(unsigned long, const Data&) const noexcept; // First value above, in a segment
+  const Data* AtLeast(const Data&) const noexcept;   // Smallest value not below, null if none
+  const Data* Above(const Data&) const noexcept;     // Smallest value above, null if none
+  const Data* Below(const Data&) const noexcept;     // Largest value below, null if none
+
+  template <typename Value>
+  bool InsertValue(Value&&);
+  template <typename Value>
+  void InsertIntoWindow(unsigned long, Value&&);     // The segment is full
+  void RefillWindow(unsigned long);                  // The segment went below its lower threshold
+
+  // Densities
+  double UpperDensity(unsigned long) const noexcept; // Of a window at that level (0 for a segment)
+  double LowerDensity(unsigned long) const noexcept;
+  static unsigned long CapacityFor(unsigned long) noexcept; // Density above RootLower, at most one half
+  static unsigned long SegmentFor(unsigned long) noexcept;
+
+  // Layout
+  void Spread(unsigned long, unsigned long, unsigned long); // Window first segment and width, with its values compacted
+  void Compact(unsigned long, unsigned long);               // Packs a window's values at its start
+  void Rebuild(unsigned long);                              // New capacity, keeping the first size values
+  void Build(Data*, unsigned long);                         // Sorts, drops duplicates and spreads the values
+  void Allocate(unsigned long);
+  void Release() noexcept;
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "setpma.cpp"
+
+#endif
@@ -0,0 +1,1163 @@
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <utility>
+
+namespace lasd {
+
+/* ************************************************************************** */
+/* Constructors */
+
+template <typename Data>
+SetRoaring<Data>::SetRoaring(const TraversableContainer<Data>& container) {
+  container.Traverse([this](const Data& dat) { InsertCode(Encode(dat)); });
+  Optimize();
+}
+
+template <typename Data>
+SetRoaring<Data>::SetRoaring(MappableContainer<Data>&& container) {
+  container.Map([this](Data& dat) { InsertCode(Encode(dat)); });
+  Optimize();
+}
+
+template <typename Data>
+template <ForeignInputRange<Data> Range>
+SetRoaring<Data>::SetRoaring(Range&& range) {
+  for (auto&& dat : range) InsertCode(Encode(dat));
+  Optimize();
+}
+
+template <typename Data>
+SetRoaring<Data>::SetRoaring(const SetRoaring& other) {
+  if (other.chunkCount > 0) {
+    chunks = new Chunk[other.chunkCount];
+    chunkCapacity = other.chunkCount;
+    for (; chunkCount < other.chunkCount; ++chunkCount) {
+      CopyChunk(chunks[chunkCount], other.chunks[chunkCount]);
+    }
+  }
+  size = other.size;
+  min = other.min;
+  max = other.max;
+}
+
+template <typename Data>
+SetRoaring<Data>::SetRoaring(SetRoaring&& other) noexcept {
+  std::swap(chunks, other.chunks);
+  std::swap(chunkCount, other.chunkCount);
+  std::swap(chunkCapacity, other.chunkCapacity);
+  std::swap(size, other.size);
+  std::swap(min, other.min);
+  std::swap(max, other.max);
+}
+
+/* ************************************************************************** */
+/* Destructor */
+
+template <typename Data>
+SetRoaring<Data>::~SetRoaring() {
+  Clear();
+}
+
+/* ************************************************************************** */
+/* Assignment operators */
+
+template <typename Data>
+SetRoaring<Data>& SetRoaring<Data>::operator=(const SetRoaring& other) {
+  if (this != &other) {
+    SetRoaring tmp(other);
+    std::swap(*this, tmp);
+  }
+  return *this;
+}
+
+template <typename Data>
+SetRoaring<Data>& SetRoaring<Data>::operator=(SetRoaring&& other) noexcept {
+  std::swap(chunks, other.chunks);
+  std::swap(chunkCount, other.chunkCount);
+  std::swap(chunkCapacity, other.chunkCapacity);
+  std::swap(size, other.size);
+  std::swap(min, other.min);
+  std::swap(max, other.max);
+  return *this;
+}
+
+/* ************************************************************************** */
+/* Comparison operators */
+
+template <typename Data>
+bool SetRoaring<Data>::operator==(const SetRoaring& other) const noexcept {
+  if (size != other.size || chunkCount != other.chunkCount) return false;
+  std::uint64_t mine[Words];
+  std::uint64_t theirs[Words];
+  for (unsigned long i = 0; i < chunkCount; ++i) {
+    const Chunk& a = chunks[i];
+    const Chunk& b = other.chunks[i];
+    if (a.key != b.key || a.count != b.count) return false;
+    if (a.kind == Kind::Array && b.kind == Kind::Array) {
+      if (!std::equal(a.items, a.items + a.length, b.items)) return false;
+    } else {
+      // The same values may sit in different forms
+      Expand(a, mine);
+      Expand(b, theirs);
+      if (std::memcmp(mine, theirs, sizeof(mine)) != 0) return false;
+    }
+  }
+  return true;
+}
+
+template <typename Data>
+bool SetRoaring<Data>::operator!=(const SetRoaring& other) const noexcept {
+  return !(*this == other);
+}
+
+/* ************************************************************************** */
+/* Min / Max */
+
+template <typename Data>
+const Data& SetRoaring<Data>::Min() const {
+  if (size == 0) throw std::length_error("Empty set");
+  return min;
+}
+
+template <typename Data>
+Data SetRoaring<Data>::MinNRemove() {
+  if (size == 0) throw std::length_error("Empty set");
+  const std::uint32_t code = (std::uint32_t(chunks[0].key) << 16) | First(chunks[0]);
+  RemoveCode(code);
+  return Decode(code);
+}
+
+template <typename Data>
+void SetRoaring<Data>::RemoveMin() {
+  (void)MinNRemove();
+}
+
+template <typename Data>
+const Data& SetRoaring<Data>::Max() const {
+  if (size == 0) throw std::length_error("Empty set");
+  return max;
+}
+
+template <typename Data>
+Data SetRoaring<Data>::MaxNRemove() {
+  if (size == 0) throw std::length_error("Empty set");
+  const Chunk& last = chunks[chunkCount - 1];
+  const std::uint32_t code = (std::uint32_t(last.key) << 16) | Last(last);
+  RemoveCode(code);
+  return Decode(code);
+}
+
+template <typename Data>
+void SetRoaring<Data>::RemoveMax() {
+  (void)MaxNRemove();
+}
+
+/* ************************************************************************** */
+/* Predecessor / Successor */
+
+template <typename Data>
+const Data& SetRoaring<Data>::Predecessor(const Data& dat) const {
+  predecessor = PredecessorValue(dat);
+  return predecessor;
+}
+
+template <typename Data>
+Data SetRoaring<Data>::PredecessorValue(const Data& dat) const {
+  std::uint32_t code;
+  if (!CodeAtMost(std::int64_t(Encode(dat)) - 1, code)) throw std::length_error("No predecessor");
+  return Decode(code);
+}
+
+template <typename Data>
+Data SetRoaring<Data>::PredecessorNRemove(const Data& dat) {
+  std::uint32_t code;
+  if (!CodeAtMost(std::int64_t(Encode(dat)) - 1, code)) throw std::length_error("No predecessor");
+  RemoveCode(code);
+  return Decode(code);
+}
+
+template <typename Data>
+void SetRoaring<Data>::RemovePredecessor(const Data& dat) {
+  (void)PredecessorNRemove(dat);
+}
+
+template <typename Data>
+const Data& SetRoaring<Data>::Successor(const Data& dat) const {
+  successor = SuccessorValue(dat);
+  return successor;
+}
+
+template <typename Data>
+Data SetRoaring<Data>::SuccessorValue(const Data& dat) const {
+  std::uint32_t code;
+  if (!CodeAtLeast(std::uint64_t(Encode(dat)) + 1, code)) throw std::length_error("No successor");
+  return Decode(code);
+}
+
+template <typename Data>
+Data SetRoaring<Data>::SuccessorNRemove(const Data& dat) {
+  std::uint32_t code;
+  if (!CodeAtLeast(std::uint64_t(Encode(dat)) + 1, code)) throw std::length_error("No successor");
+  RemoveCode(code);
+  return Decode(code);
+}
+
+template <typename Data>
+void SetRoaring<Data>::RemoveSuccessor(const Data& dat) {
+  (void)SuccessorNRemove(dat);
+}
+
+/* ************************************************************************** */
+/* Range queries */
+
+template <typename Data>
+const Data& SetRoaring<Data>::LowerBound(const Data& dat) const {
+  lowerBound = LowerBoundValue(dat);
+  return lowerBound;
+}
+
+template <typename Data>
+Data SetRoaring<Data>::LowerBoundValue(const Data& dat) const {
+  std::uint32_t code;
+  if (!CodeAtLeast(Encode(dat), code)) throw std::length_error("No lower bound");
+  return Decode(code);
+}
+
+template <typename Data>
+const Data& SetRoaring<Data>::UpperBound(const Data& dat) const {
+  upperBound = UpperBoundValue(dat);
+  return upperBound;
+}
+
+template <typename Data>
+Data SetRoaring<Data>::UpperBoundValue(const Data& dat) const {
+  std::uint32_t code;
+  if (!CodeAtLeast(std::uint64_t(Encode(dat)) + 1, code)) throw std::length_error("No upper bound");
+  return Decode(code);
+}
+
+template <typename Data>
+void SetRoaring<Data>::RangeTraverse(const Data& lo, const Data& hi, RangeFun fun) const {
+  if (!(lo < hi)) return;
+  const std::uint32_t first = Encode(lo);
+  const std::uint32_t last = Encode(hi) - 1;
+  for (unsigned long i = ChunkIndex(first >> 16); i < chunkCount && chunks[i].key <= (last >> 16); ++i) {
+    const std::uint32_t base = std::uint32_t(chunks[i].key) << 16;
+    const std::uint16_t from = (chunks[i].key == (first >> 16)) ? (first & 0xFFFF) : 0;
+    const std::uint16_t to = (chunks[i].key == (last >> 16)) ? (last & 0xFFFF) : 0xFFFF;
+    Ascending(chunks[i], [&fun, base, from, to](std::uint16_t low) {
+      if (low >= from && low <= to) {
+        const Data dat = Decode(base | low);
+        fun(dat);
+      }
+    });
+  }
+}
+
+template <typename Data>
+unsigned long SetRoaring<Data>::RangeCount(const Data& lo, const Data& hi) const {
+  if (!(lo < hi)) return 0;
+  return CodeRank(Encode(hi)) - CodeRank(Encode(lo));
+}
+
+template <typename Data>
+unsigned long SetRoaring<Data>::RangeRemove(const Data& lo, const Data& hi) {
+  if (!(lo < hi)) return 0;
+  return RemoveCodes(Encode(lo), Encode(hi));
+}
+
+/* ************************************************************************** */
+/* Insert / Remove */
+
+template <typename Data>
+bool SetRoaring<Data>::Insert(const Data& dat) {
+  return InsertCode(Encode(dat));
+}
+
+template <typename Data>
+bool SetRoaring<Data>::Insert(Data&& dat) {
+  return InsertCode(Encode(dat));
+}
+
+template <typename Data>
+bool SetRoaring<Data>::Remove(const Data& dat) {
+  return RemoveCode(Encode(dat));
+}
+
+/* ************************************************************************** */
+/* Set algebra */
+
+template <typename Data>
+SetRoaring<Data> SetRoaring<Data>::Union(const SetRoaring& other) const {
+  return Combine(other, true, true, [](std::uint64_t a, std::uint64_t b) { return a | b; });
+}
+
+template <typename Data>
+SetRoaring<Data> SetRoaring<Data>::Intersection(const SetRoaring& other) const {
+  return Combine(other, false, false, [](std::uint64_t a, std::uint64_t b) { return a & b; });
+}
+
+template <typename Data>
+SetRoaring<Data> SetRoaring<Data>::Difference(const SetRoaring& other) const {
+  return Combine(other, true, false, [](std::uint64_t a, std::uint64_t b) { return a & ~b; });
+}
+
+template <typename Data>
+SetRoaring<Data> SetRoaring<Data>::SymmetricDifference(const SetRoaring& other) const {
+  return Combine(other, true, true, [](std::uint64_t a, std::uint64_t b) { return a ^ b; });
+}
+
+/* ************************************************************************** */
+/* LinearContainer function */
+
+template <typename Data>
+const Data& SetRoaring<Data>::operator[](unsigned long index) const {
+  element = At(index);
+  return element;
+}
+
+template <typename Data>
+Data SetRoaring<Data>::At(unsigned long index) const {
+  if (index >= size) throw std::out_of_range("Index out of range");
+  return Decode(CodeSelect(index));
+}
+
+template <typename Data>
+const Data& SetRoaring<Data>::Front() const {
+  if (size == 0) throw std::length_error("Access to front of an empty container");
+  return min;
+}
+
+template <typename Data>
+const Data& SetRoaring<Data>::Back() const {
+  if (size == 0) throw std::length_error("Access to back of an empty container");
+  return max;
+}
+
+/* ************************************************************************** */
+/* TraversableContainer functions */
+
+template <typename Data>
+void SetRoaring<Data>::Traverse(TraverseFun fun) const {
+  PreOrderTraverse(fun);
+}
+
+template <typename Data>
+void SetRoaring<Data>::PreOrderTraverse(TraverseFun fun) const {
+  for (unsigned long i = 0; i < chunkCount; ++i) {
+    const std::uint32_t base = std::uint32_t(chunks[i].key) << 16;
+    Ascending(chunks[i], [&fun, base](std::uint16_t low) {
+      const Data dat = Decode(base | low);
+      fun(dat);
+    });
+  }
+}
+
+template <typename Data>
+void SetRoaring<Data>::PostOrderTraverse(TraverseFun fun) const {
+  for (unsigned long i = chunkCount; i > 0; --i) {
+    const std::uint32_t base = std::uint32_t(chunks[i - 1].key) << 16;
+    Descending(chunks[i - 1], [&fun, base](std::uint16_t low) {
+      const Data dat = Decode(base | low);
+      fun(dat);
+    });
+  }
+}
+
+/* ************************************************************************** */
+/* TestableContainer function */
+
+template <typename Data>
+bool SetRoaring<Data>::Exists(const Data& dat) const noexcept {
+  const std::uint32_t code = Encode(dat);
+  const unsigned long index = ChunkIndex(code >> 16);
+  return index < chunkCount && chunks[index].key == (code >> 16) && Contains(chunks[index], code & 0xFFFF);
+}
+
+/* ************************************************************************** */
+/* Clear / Resize */
+
+template <typename Data>
+void SetRoaring<Data>::Clear() {
+  for (unsigned long i = 0; i < chunkCount; ++i) Release(chunks[i]);
+  delete[] chunks;
+  chunks = nullptr;
+  chunkCount = 0;
+  chunkCapacity = 0;
+  size = 0;
+}
+
+template <typename Data>
+void SetRoaring<Data>::Resize(unsigned long newSize) {
+  if (newSize == 0) {
+    Clear();
+  } else if (newSize < size) {
+    RemoveCodes(CodeSelect(newSize), std::uint64_t(1) << 32);
+  }
+}
+
+/* ************************************************************************** */
+/* Specific functions */
+
+template <typename Data>
+void SetRoaring<Data>::Optimize() {
+  std::uint64_t words[Words];
+  for (unsigned long i = 0; i < chunkCount; ++i) {
+    Expand(chunks[i], words);
+    Settle(chunks[i], words, chunks[i].count);
+  }
+}
+
+template <typename Data>
+unsigned long SetRoaring<Data>::MemoryBytes() const noexcept {
+  unsigned long bytes = chunkCapacity * sizeof(Chunk);
+  for (unsigned long i = 0; i < chunkCount; ++i) {
+    switch (chunks[i].kind) {
+      case Kind::Array: bytes += chunks[i].capacity * sizeof(std::uint16_t); break;
+      case Kind::Run: bytes += chunks[i].capacity * 2 * sizeof(std::uint16_t); break;
+      case Kind::Bitmap: bytes += Words * sizeof(std::uint64_t); break;
+    }
+  }
+  return bytes;
+}
+
+/* ************************************************************************** */
+
+// Auxiliary functions: encoding
+
+template <typename Data>
+std::uint32_t SetRoaring<Data>::Encode(const Data& dat) noexcept {
+  if constexpr (std::is_signed_v<Data>) {
+    return static_cast<std::uint32_t>(static_cast<std::int32_t>(dat)) ^ 0x80000000U; // The sign bit flipped keeps the order
+  } else {
+    return static_cast<std::uint32_t>(dat);
+  }
+}
+
+template <typename Data>
+Data SetRoaring<Data>::Decode(std::uint32_t code) noexcept {
+  if constexpr (std::is_signed_v<Data>) {
+    return static_cast<Data>(static_cast<std::int32_t>(code ^ 0x80000000U));
+  } else {
+    return static_cast<Data>(code);
+  }
+}
+
+template <typename Data>
+void SetRoaring<Data>::UpdateBounds() noexcept {
+  if (chunkCount == 0) return;
+  const Chunk& last = chunks[chunkCount - 1];
+  min = Decode((std::uint32_t(chunks[0].key) << 16) | First(chunks[0]));
+  max = Decode((std::uint32_t(last.key) << 16) | Last(last));
+}
+
+/* ************************************************************************** */
+
+// Auxiliary functions: whole set
+
+template <typename Data>
+bool SetRoaring<Data>::InsertCode(std::uint32_t code) {
+  const std::uint16_t key = code >> 16;
+  unsigned long index = ChunkIndex(key);
+  if (index == chunkCount || chunks[index].key != key) AddChunk(index, key);
+  if (!Add(chunks[index], code & 0xFFFF)) return false;
+  if (size == 0 || code < Encode(min)) min = Decode(code);
+  if (size == 0 || code > Encode(max)) max = Decode(code);
+  ++size;
+  return true;
+}
+
+template <typename Data>
+bool SetRoaring<Data>::RemoveCode(std::uint32_t code) {
+  const std::uint16_t key = code >> 16;
+  const unsigned long index = ChunkIndex(key);
+  if (index == chunkCount || chunks[index].key != key) return false;
+  if (!Erase(chunks[index], code & 0xFFFF)) return false;
+  if (chunks[index].count == 0) DropChunk(index);
+  --size;
+  if (code == Encode(min) || code == Encode(max)) UpdateBounds();
+  return true;
+}
+
+template <typename Data>
+bool SetRoaring<Data>::CodeAtLeast(std::uint64_t code, std::uint32_t& found) const noexcept {
+  if (code >> 32) return false;
+  const std::uint16_t key = code >> 16;
+  unsigned long index = ChunkIndex(key);
+  if (index < chunkCount && chunks[index].key == key) {
+    std::uint16_t low;
+    if (AtLeast(chunks[index], code & 0xFFFF, low)) {
+      found = (std::uint32_t(key) << 16) | low;
+      return true;
+    }
+    ++index;
+  }
+  if (index == chunkCount) return false;
+  found = (std::uint32_t(chunks[index].key) << 16) | First(chunks[index]);
+  return true;
+}
+
+template <typename Data>
+bool SetRoaring<Data>::CodeAtMost(std::int64_t code, std::uint32_t& found) const noexcept {
+  if (code < 0) return false;
+  const std::uint16_t key = code >> 16;
+  const unsigned long index = ChunkIndex(key);
+  if (index < chunkCount && chunks[index].key == key) {
+    std::uint16_t low;
+    if (AtMost(chunks[index], code & 0xFFFF, low)) {
+      found = (std::uint32_t(key) << 16) | low;
+      return true;
+    }
+  }
+  if (index == 0) return false;
+  found = (std::uint32_t(chunks[index - 1].key) << 16) | Last(chunks[index - 1]);
+  return true;
+}
+
+template <typename Data>
+unsigned long SetRoaring<Data>::CodeRank(std::uint64_t code) const noexcept {
+  if (code >> 32) return size;
+  const std::uint16_t key = code >> 16;
+  unsigned long rank = 0;
+  unsigned long index = 0;
+  for (; index < chunkCount && chunks[index].key < key; ++index) rank += chunks[index].count;
+  if (index < chunkCount && chunks[index].key == key) rank += Rank(chunks[index], code & 0xFFFF);
+  return rank;
+}
+
+template <typename Data>
+std::uint32_t SetRoaring<Data>::CodeSelect(unsigned long index) const noexcept {
+  unsigned long chunk = 0;
+  while (index >= chunks[chunk].count) index -= chunks[chunk++].count;
+  return (std::uint32_t(chunks[chunk].key) << 16) | Select(chunks[chunk], index);
+}
+
+template <typename Data>
+unsigned long SetRoaring<Data>::RemoveCodes(std::uint64_t first, std::uint64_t end) {
+  if (first >= end) return 0;
+  const std::uint32_t last = end - 1;
+  const unsigned long before = size;
+  std::uint64_t words[Words];
+  unsigned long index = ChunkIndex(first >> 16);
+  while (index < chunkCount && chunks[index].key <= (last >> 16)) {
+    Chunk& chunk = chunks[index];
+    const std::uint32_t from = (chunk.key == (first >> 16)) ? (first & 0xFFFF) : 0;
+    const std::uint32_t to = (chunk.key == (last >> 16)) ? (last & 0xFFFF) : 0xFFFF;
+    if (from == 0 && to == 0xFFFF) {
+      size -= chunk.count;
+      DropChunk(index);
+      continue;
+    }
+
+    // Partial chunk: clear the bits of the range, then store what is left in its smallest form
+    Expand(chunk, words);
+    std::uint32_t removed = 0;
+    for (std::uint32_t w = from >> 6; w <= (to >> 6); ++w) {
+      std::uint64_t mask = ~std::uint64_t(0);
+      if (w == (from >> 6)) mask &= ~std::uint64_t(0) << (from & 63);
+      if (w == (to >> 6)) mask &= ~std::uint64_t(0) >> (63 - (to & 63));
+      removed += std::popcount(words[w] & mask);
+      words[w] &= ~mask;
+    }
+    if (removed == chunk.count) {
+      size -= removed;
+      DropChunk(index);
+      continue;
+    }
+    if (removed > 0) {
+      size -= removed;
+      Settle(chunk, words, chunk.count - removed);
+    }
+    ++index;
+  }
+  if (size != before) UpdateBounds();
+  return before - size;
+}
+
+template <typename Data>
+template <typename Op>
+SetRoaring<Data> SetRoaring<Data>::Combine(const SetRoaring& other, bool onlyHere, bool onlyOther, Op op) const {
+  SetRoaring result;
+  std::uint64_t mine[Words];
+  std::uint64_t theirs[Words];
+  unsigned long i = 0;
+  unsigned long j = 0;
+  while (i < chunkCount || j < other.chunkCount) {
+    if (j == other.chunkCount || (i < chunkCount && chunks[i].key < other.chunks[j].key)) {
+      if (onlyHere) {
+        CopyChunk(result.AddChunk(result.chunkCount, chunks[i].key), chunks[i]);
+        result.size += chunks[i].count;
+      }
+      ++i;
+    } else if (i == chunkCount || other.chunks[j].key < chunks[i].key) {
+      if (onlyOther) {
+        CopyChunk(result.AddChunk(result.chunkCount, other.chunks[j].key), other.chunks[j]);
+        result.size += other.chunks[j].count;
+      }
+      ++j;
+    } else {
+      // Same key: combine word by word
+      Expand(chunks[i], mine);
+      Expand(other.chunks[j], theirs);
+      std::uint32_t count = 0;
+      for (std::uint32_t w = 0; w < Words; ++w) {
+        mine[w] = op(mine[w], theirs[w]);
+        count += std::popcount(mine[w]);
+      }
+      if (count > 0) {
+        Settle(result.AddChunk(result.chunkCount, chunks[i].key), mine, count);
+        result.size += count;
+      }
+      ++i;
+      ++j;
+    }
+  }
+  result.UpdateBounds();
+  return result;
+}
+
+/* ************************************************************************** */
+
+// Auxiliary functions: chunk directory
+
+template <typename Data>
+unsigned long SetRoaring<Data>::ChunkIndex(std::uint16_t key) const noexcept {
+  // Ascending insertions land in the last chunk: check it first
+  if (chunkCount == 0 || chunks[chunkCount - 1].key < key) return chunkCount;
+  if (chunks[chunkCount - 1].key == key) return chunkCount - 1;
+  unsigned long lo = 0;
+  unsigned long hi = chunkCount - 1;
+  while (lo < hi) {
+    const unsigned long mid = lo + (hi - lo) / 2;
+    if (chunks[mid].key < key) lo = mid + 1;
+    else hi = mid;
+  }
+  return lo;
+}
+
+template <typename Data>
+typename SetRoaring<Data>::Chunk& SetRoaring<Data>::AddChunk(unsigned long index, std::uint16_t key) {
+  if (chunkCount == chunkCapacity) {
+    const unsigned long newCapacity = (chunkCapacity == 0) ? 4 : 2 * chunkCapacity;
+    Chunk* moved = new Chunk[newCapacity];
+    std::copy(chunks, chunks + chunkCount, moved); // Plain copies: the buffers change owner
+    delete[] chunks;
+    chunks = moved;
+    chunkCapacity = newCapacity;
+  }
+  std::copy_backward(chunks + index, chunks + chunkCount, chunks + chunkCount + 1);
+  chunks[index] = Chunk();
+  chunks[index].key = key;
+  ++chunkCount;
+  return chunks[index];
+}
+
+template <typename Data>
+void SetRoaring<Data>::DropChunk(unsigned long index) noexcept {
+  Release(chunks[index]);
+  std::copy(chunks + index + 1, chunks + chunkCount, chunks + index);
+  --chunkCount;
+  chunks[chunkCount] = Chunk();
+}
+
+template <typename Data>
+void SetRoaring<Data>::Release(Chunk& chunk) noexcept {
+  delete[] chunk.items;
+  delete[] chunk.bits;
+  chunk.items = nullptr;
+  chunk.bits = nullptr;
+  chunk.length = 0;
+  chunk.capacity = 0;
+}
+
+template <typename Data>
+void SetRoaring<Data>::CopyChunk(Chunk& copy, const Chunk& chunk) {
+  copy = chunk;
+  copy.items = nullptr;
+  copy.bits = nullptr;
+  if (chunk.kind == Kind::Bitmap) {
+    copy.bits = new std::uint64_t[Words];
+    std::copy(chunk.bits, chunk.bits + Words, copy.bits);
+  } else {
+    // Trimmed to the values in use
+    const std::uint32_t slots = (chunk.kind == Kind::Run) ? 2 * chunk.length : chunk.length;
+    copy.capacity = chunk.length;
+    copy.items = new std::uint16_t[slots];
+    std::copy(chunk.items, chunk.items + slots, copy.items);
+  }
+}
+
+/* ************************************************************************** */
+
+// Auxiliary functions: one chunk
+
+template <typename Data>
+bool SetRoaring<Data>::Contains(const Chunk& chunk, std::uint16_t low) noexcept {
+  switch (chunk.kind) {
+    case Kind::Array:
+      return std::binary_search(chunk.items, chunk.items + chunk.length, low);
+    case Kind::Bitmap:
+      return (chunk.bits[low >> 6] >> (low & 63)) & 1;
+    case Kind::Run: {
+      std::uint16_t found;
+      return AtLeast(chunk, low, found) && found == low;
+    }
+  }
+  return false;
+}
+
+template <typename Data>
+bool SetRoaring<Data>::Add(Chunk& chunk, std::uint16_t low) {
+  switch (chunk.kind) {
+    case Kind::Array: {
+      std::uint16_t* pos = std::lower_bound(chunk.items, chunk.items + chunk.length, low);
+      if (pos != chunk.items + chunk.length && *pos == low) return false;
+      if (chunk.length == ArrayMax) {
+        ToBitmap(chunk);
+        return Add(chunk, low);
+      }
+      const std::uint32_t index = pos - chunk.items;
+      Reserve(chunk, chunk.length + 1);
+      std::copy_backward(chunk.items + index, chunk.items + chunk.length, chunk.items + chunk.length + 1);
+      chunk.items[index] = low;
+      ++chunk.length;
+      break;
+    }
+    case Kind::Bitmap: {
+      std::uint64_t& word = chunk.bits[low >> 6];
+      const std::uint64_t bit = std::uint64_t(1) << (low & 63);
+      if (word & bit) return false;
+      word |= bit;
+      break;
+    }
+    case Kind::Run: {
+      // First run ending at or after the value
+      std::uint32_t run = 0;
+      std::uint32_t hi = chunk.length;
+      while (run < hi) {
+        const std::uint32_t mid = run + (hi - run) / 2;
+        if (chunk.items[2 * mid + 1] < low) run = mid + 1;
+        else hi = mid;
+      }
+      if (run < chunk.length && chunk.items[2 * run] <= low) return false;
+      const bool joinsLeft = run > 0 && std::uint32_t(chunk.items[2 * run - 1]) + 1 == low;
+      const bool joinsRight = run < chunk.length && std::uint32_t(low) + 1 == chunk.items[2 * run];
+      if (joinsLeft && joinsRight) {
+        chunk.items[2 * run - 1] = chunk.items[2 * run + 1];
+        std::copy(chunk.items + 2 * run + 2, chunk.items + 2 * chunk.length, chunk.items + 2 * run);
+        --chunk.length;
+      } else if (joinsLeft) {
+        chunk.items[2 * run - 1] = low;
+      } else if (joinsRight) {
+        chunk.items[2 * run] = low;
+      } else {
+        InsertRun(chunk, run, low, low);
+      }
+      break;
+    }
+  }
+  ++chunk.count;
+
+  // Too many runs for their values: back to an array or a bitmap
+  if (chunk.kind == Kind::Run && 4 * chunk.length > std::min(2 * chunk.count, 8 * Words)) {
+    std::uint64_t words[Words];
+    Expand(chunk, words);
+    Settle(chunk, words, chunk.count);
+  }
+  return true;
+}
+
+template <typename Data>
+bool SetRoaring<Data>::Erase(Chunk& chunk, std::uint16_t low) {
+  switch (chunk.kind) {
+    case Kind::Array: {
+      std::uint16_t* pos = std::lower_bound(chunk.items, chunk.items + chunk.length, low);
+      if (pos == chunk.items + chunk.length || *pos != low) return false;
+      std::copy(pos + 1, chunk.items + chunk.length, pos);
+      --chunk.length;
+      --chunk.count;
+      if (chunk.capacity > 16 && chunk.length < chunk.capacity / 4) {
+        // Give back memory, as SetVec does
+        std::uint16_t* items = new std::uint16_t[chunk.capacity / 2];
+        std::copy(chunk.items, chunk.items + chunk.length, items);
+        delete[] chunk.items;
+        chunk.items = items;
+        chunk.capacity /= 2;
+      }
+      return true;
+    }
+    case Kind::Bitmap: {
+      std::uint64_t& word = chunk.bits[low >> 6];
+      const std::uint64_t bit = std::uint64_t(1) << (low & 63);
+      if (!(word & bit)) return false;
+      word &= ~bit;
+      if (--chunk.count < ArrayMin) {
+        std::uint64_t words[Words];
+        std::copy(chunk.bits, chunk.bits + Words, words);
+        Settle(chunk, words, chunk.count);
+      }
+      return true;
+    }
+    case Kind::Run: {
+      std::uint32_t run = 0;
+      std::uint32_t hi = chunk.length;
+      while (run < hi) {
+        const std::uint32_t mid = run + (hi - run) / 2;
+        if (chunk.items[2 * mid + 1] < low) run = mid + 1;
+        else hi = mid;
+      }
+      if (run == chunk.length || chunk.items[2 * run] > low) return false;
+      const std::uint16_t start = chunk.items[2 * run];
+      const std::uint16_t last = chunk.items[2 * run + 1];
+      if (start == last) {
+        std::copy(chunk.items + 2 * run + 2, chunk.items + 2 * chunk.length, chunk.items + 2 * run);
+        --chunk.length;
+      } else if (low == start) {
+        ++chunk.items[2 * run];
+      } else if (low == last) {
+        --chunk.items[2 * run + 1];
+      } else {
+        chunk.items[2 * run + 1] = low - 1;
+        InsertRun(chunk, run + 1, low + 1, last);
+      }
+      --chunk.count;
+      if (chunk.count > 0 && 4 * chunk.length > std::min(2 * chunk.count, 8 * Words)) {
+        std::uint64_t words[Words];
+        Expand(chunk, words);
+        Settle(chunk, words, chunk.count);
+      }
+      return true;
+    }
+  }
+  return false;
+}
+
+template <typename Data>
+std::uint16_t SetRoaring<Data>::First(const Chunk& chunk) noexcept {
+  switch (chunk.kind) {
+    case Kind::Array: return chunk.items[0];
+    case Kind::Bitmap: return NextSet(chunk.bits, 0);
+    case Kind::Run: return chunk.items[0];
+  }
+  return 0;
+}
+
+template <typename Data>
+std::uint16_t SetRoaring<Data>::Last(const Chunk& chunk) noexcept {
+  switch (chunk.kind) {
+    case Kind::Array: return chunk.items[chunk.length - 1];
+    case Kind::Bitmap: return PreviousSet(chunk.bits, ChunkValues - 1);
+    case Kind::Run: return chunk.items[2 * chunk.length - 1];
+  }
+  return 0;
+}
+
+template <typename Data>
+bool SetRoaring<Data>::AtLeast(const Chunk& chunk, std::uint16_t low, std::uint16_t& found) noexcept {
+  switch (chunk.kind) {
+    case Kind::Array: {
+      const std::uint16_t* pos = std::lower_bound(chunk.items, chunk.items + chunk.length, low);
+      if (pos == chunk.items + chunk.length) return false;
+      found = *pos;
+      return true;
+    }
+    case Kind::Bitmap: {
+      const std::uint32_t next = NextSet(chunk.bits, low);
+      if (next == ChunkValues) return false;
+      found = next;
+      return true;
+    }
+    case Kind::Run: {
+      std::uint32_t run = 0;
+      std::uint32_t hi = chunk.length;
+      while (run < hi) {
+        const std::uint32_t mid = run + (hi - run) / 2;
+        if (chunk.items[2 * mid + 1] < low) run = mid + 1;
+        else hi = mid;
+      }
+      if (run == chunk.length) return false;
+      found = std::max(chunk.items[2 * run], low);
+      return true;
+    }
+  }
+  return false;
+}
+
+template <typename Data>
+bool SetRoaring<Data>::AtMost(const Chunk& chunk, std::uint16_t low, std::uint16_t& found) noexcept {
+  switch (chunk.kind) {
+    case Kind::Array: {
+      const std::uint16_t* pos = std::upper_bound(chunk.items, chunk.items + chunk.length, low);
+      if (pos == chunk.items) return false;
+      found = *(pos - 1);
+      return true;
+    }
+    case Kind::Bitmap: {
+      const std::int32_t previous = PreviousSet(chunk.bits, low);
+      if (previous < 0) return false;
+      found = previous;
+      return true;
+    }
+    case Kind::Run: {
+      // Runs starting at or before the value
+      std::uint32_t runs = 0;
+      std::uint32_t hi = chunk.length;
+      while (runs < hi) {
+        const std::uint32_t mid = runs + (hi - runs) / 2;
+        if (chunk.items[2 * mid] <= low) runs = mid + 1;
+        else hi = mid;
+      }
+      if (runs == 0) return false;
+      found = std::min(chunk.items[2 * runs - 1], low);
+      return true;
+    }
+  }
+  return false;
+}
+
+template <typename Data>
+std::uint32_t SetRoaring<Data>::Rank(const Chunk& chunk, std::uint32_t low) noexcept {
+  switch (chunk.kind) {
+    case Kind::Array:
+      return std::lower_bound(chunk.items, chunk.items + chunk.length, low) - chunk.items;
+    case Kind::Bitmap: {
+      std::uint32_t rank = 0;
+      for (std::uint32_t w = 0; w < (low >> 6); ++w) rank += std::popcount(chunk.bits[w]);
+      if (low < ChunkValues && (low & 63) != 0) {
+        rank += std::popcount(chunk.bits[low >> 6] & ((std::uint64_t(1) << (low & 63)) - 1));
+      }
+      return rank;
+    }
+    case Kind::Run: {
+      std::uint32_t rank = 0;
+      for (std::uint32_t run = 0; run < chunk.length && chunk.items[2 * run] < low; ++run) {
+        rank += std::min<std::uint32_t>(chunk.items[2 * run + 1] + 1, low) - chunk.items[2 * run];
+      }
+      return rank;
+    }
+  }
+  return 0;
+}
+
+template <typename Data>
+std::uint16_t SetRoaring<Data>::Select(const Chunk& chunk, std::uint32_t index) noexcept {
+  switch (chunk.kind) {
+    case Kind::Array:
+      return chunk.items[index];
+    case Kind::Bitmap: {
+      std::uint32_t w = 0;
+      for (std::uint32_t bits = std::popcount(chunk.bits[0]); index >= bits; bits = std::popcount(chunk.bits[++w])) {
+        index -= bits;
+      }
+      std::uint64_t word = chunk.bits[w];
+      for (; index > 0; --index) word &= word - 1;
+      return 64 * w + std::countr_zero(word);
+    }
+    case Kind::Run: {
+      std::uint32_t run = 0;
+      while (index > std::uint32_t(chunk.items[2 * run + 1] - chunk.items[2 * run])) {
+        index -= chunk.items[2 * run + 1] - chunk.items[2 * run] + 1;
+        ++run;
+      }
+      return chunk.items[2 * run] + index;
+    }
+  }
+  return 0;
+}
+
+template <typename Data>
+template <typename Fun>
+void SetRoaring<Data>::Ascending(const Chunk& chunk, Fun&& fun) {
+  switch (chunk.kind) {
+    case Kind::Array:
+      for (std::uint32_t i = 0; i < chunk.length; ++i) fun(chunk.items[i]);
+      break;
+    case Kind::Bitmap:
+      for (std::uint32_t w = 0; w < Words; ++w) {
+        for (std::uint64_t word = chunk.bits[w]; word != 0; word &= word - 1) {
+          fun(static_cast<std::uint16_t>(64 * w + std::countr_zero(word)));
+        }
+      }
+      break;
+    case Kind::Run:
+      for (std::uint32_t run = 0; run < chunk.length; ++run) {
+        for (std::uint32_t low = chunk.items[2 * run]; low <= chunk.items[2 * run + 1]; ++low) {
+          fun(static_cast<std::uint16_t>(low));
+        }
+      }
+      break;
+  }
+}
+
+template <typename Data>
+template <typename Fun>
+void SetRoaring<Data>::Descending(const Chunk& chunk, Fun&& fun) {
+  switch (chunk.kind) {
+    case Kind::Array:
+      for (std::uint32_t i = chunk.length; i > 0; --i) fun(chunk.items[i - 1]);
+      break;
+    case Kind::Bitmap:
+      for (std::uint32_t w = Words; w > 0; --w) {
+        for (std::uint64_t word = chunk.bits[w - 1]; word != 0; ) {
+          const std::uint32_t bit = 63 - std::countl_zero(word);
+          fun(static_cast<std::uint16_t>(64 * (w - 1) + bit));
+          word &= ~(std::uint64_t(1) << bit);
+        }
+      }
+      break;
+    case Kind::Run:
+      for (std::uint32_t run = chunk.length; run > 0; --run) {
+        for (std::uint32_t low = chunk.items[2 * run - 1] + 1; low > chunk.items[2 * run - 2]; --low) {
+          fun(static_cast<std::uint16_t>(low - 1));
+        }
+      }
+      break;
+  }
+}
+
+/* ************************************************************************** */
+
+// Auxiliary functions: representations
+
+template <typename Data>
+void SetRoaring<Data>::Reserve(Chunk& chunk, std::uint32_t needed) {
+  if (needed <= chunk.capacity) return;
+  const std::uint32_t limit = (chunk.kind == Kind::Run) ? ChunkValues / 2 : ArrayMax;
+  const std::uint32_t capacity = std::min(std::max(needed, chunk.capacity == 0 ? 4U : 2 * chunk.capacity), limit);
+  const std::uint32_t slots = (chunk.kind == Kind::Run) ? 2 : 1;
+  std::uint16_t* items = new std::uint16_t[slots * capacity];
+  std::copy(chunk.items, chunk.items + slots * chunk.length, items);
+  delete[] chunk.items;
+  chunk.items = items;
+  chunk.capacity = capacity;
+}
+
+template <typename Data>
+void SetRoaring<Data>::InsertRun(Chunk& chunk, std::uint32_t run, std::uint16_t start, std::uint16_t last) {
+  Reserve(chunk, chunk.length + 1);
+  std::copy_backward(chunk.items + 2 * run, chunk.items + 2 * chunk.length, chunk.items + 2 * chunk.length + 2);
+  chunk.items[2 * run] = start;
+  chunk.items[2 * run + 1] = last;
+  ++chunk.length;
+}
+
+template <typename Data>
+void SetRoaring<Data>::ToBitmap(Chunk& chunk) {
+  std::uint64_t* bits = new std::uint64_t[Words];
+  Expand(chunk, bits);
+  Release(chunk);
+  chunk.bits = bits;
+  chunk.kind = Kind::Bitmap;
+}
+
+template <typename Data>
+void SetRoaring<Data>::Expand(const Chunk& chunk, std::uint64_t* words) noexcept {
+  if (chunk.kind == Kind::Bitmap) {
+    std::copy(chunk.bits, chunk.bits + Words, words);
+    return;
+  }
+  std::fill(words, words + Words, 0);
+  if (chunk.kind == Kind::Array) {
+    for (std::uint32_t i = 0; i < chunk.length; ++i) {
+      words[chunk.items[i] >> 6] |= std::uint64_t(1) << (chunk.items[i] & 63);
+    }
+    return;
+  }
+  for (std::uint32_t run = 0; run < chunk.length; ++run) {
+    // Whole words at once inside the run
+    const std::uint32_t start = chunk.items[2 * run];
+    const std::uint32_t last = chunk.items[2 * run + 1];
+    for (std::uint32_t w = start >> 6; w <= (last >> 6); ++w) {
+      std::uint64_t mask = ~std::uint64_t(0);
+      if (w == (start >> 6)) mask &= ~std::uint64_t(0) << (start & 63);
+      if (w == (last >> 6)) mask &= ~std::uint64_t(0) >> (63 - (last & 63));
+      words[w] |= mask;
+    }
+  }
+}
+
+template <typename Data>
+void SetRoaring<Data>::Settle(Chunk& chunk, const std::uint64_t* words, std::uint32_t count) {
+  Release(chunk);
+  chunk.count = count;
+  const std::uint32_t runs = CountRuns(words);
+  const std::uint32_t runBytes = 4 * runs;
+  const std::uint32_t arrayBytes = (count <= ArrayMax) ? 2 * count : ~0U;
+  const std::uint32_t bitmapBytes = 8 * Words;
+
+  if (runBytes < arrayBytes && runBytes < bitmapBytes) {
+    chunk.kind = Kind::Run;
+    chunk.items = new std::uint16_t[2 * runs];
+    chunk.capacity = runs;
+    for (std::uint32_t start = NextSet(words, 0); start < ChunkValues; ) {
+      const std::uint32_t end = NextClear(words, start);
+      chunk.items[2 * chunk.length] = start;
+      chunk.items[2 * chunk.length + 1] = end - 1;
+      ++chunk.length;
+      start = (end < ChunkValues) ? NextSet(words, end) : ChunkValues;
+    }
+  } else if (arrayBytes <= bitmapBytes) {
+    chunk.kind = Kind::Array;
+    chunk.items = new std::uint16_t[count];
+    chunk.capacity = count;
+    for (std::uint32_t w = 0; w < Words; ++w) {
+      for (std::uint64_t word = words[w]; word != 0; word &= word - 1) {
+        chunk.items[chunk.length++] = 64 * w + std::countr_zero(word);
+      }
+    }
+  } else {
+    chunk.kind = Kind::Bitmap;
+    chunk.bits = new std::uint64_t[Words];
+    std::copy(words, words + Words, chunk.bits);
+  }
+}
+
+template <typename Data>
+std::uint32_t SetRoaring<Data>::CountRuns(const std::uint64_t* words) noexcept {
+  // A run starts at each set bit whose lower neighbour is clear
+  std::uint32_t runs = 0;
+  std::uint64_t carry = 0;
+  for (std::uint32_t w = 0; w < Words; ++w) {
+    runs += std::popcount(words[w] & ~((words[w] << 1) | carry));
+    carry = words[w] >> 63;
+  }
+  return runs;
+}
+
+template <typename Data>
+std::uint32_t SetRoaring<Data>::NextSet(const std::uint64_t* words, std::uint32_t from) noexcept {
+  std::uint32_t w = from >> 6;
+  std::uint64_t word = words[w] & (~std::uint64_t(0) << (from & 63));
+  while (word == 0) {
+    if (++w == Words) return ChunkValues;
+    word = words[w];
+  }
+  return 64 * w + std::countr_zero(word);
+}
+
+template <typename Data>
+std::uint32_t SetRoaring<Data>::NextClear(const std::uint64_t* words, std::uint32_t from) noexcept {
+  std::uint32_t w = from >> 6;
+  std::uint64_t word = ~words[w] & (~std::uint64_t(0) << (from & 63));
+  while (word == 0) {
+    if (++w == Words) return ChunkValues;
+    word = ~words[w];
+  }
+  return 64 * w + std::countr_zero(word);
+}
+
+template <typename Data>
+std::int32_t SetRoaring<Data>::PreviousSet(const std::uint64_t* words, std::uint32_t from) noexcept {
+  std::uint32_t w = from >> 6;
+  std::uint64_t word = words[w] & (~std::uint64_t(0) >> (63 - (from & 63)));
+  while (word == 0) {
+    if (w == 0) return -1;
+    word = words[--w];
+  }
+  return 64 * w + 63 - std::countl_zero(word);
+}
+
+/* ************************************************************************** */
+
+}
@@ -0,0 +1,288 @@
+#ifndef SETROARING_HPP
+#define SETROARING_HPP
+
+/* ************************************************************************** */
+
+#include "../set.hpp"
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Compressed set of integers of up to 32 bits, split as in Roaring bitmaps.
+// The high 16 bits of a value pick its chunk. The chunk stores the low 16
+// bits in the smallest of three forms: a sorted array (2 bytes per value,
+// up to ArrayMax values), a 2^16-bit bitmap (8 KiB), or a sorted list of runs
+// (4 bytes per run). Single insertions and removals switch a chunk between
+// array and bitmap as it grows and shrinks. Runs come from the bulk paths
+// (the constructors, Optimize, RangeRemove and the set algebra), which choose
+// the smallest form. A run chunk that breaks into too many runs is converted
+// back.
+//
+// The values are not stored as Data. Min, Max, Front and Back return members
+// kept up to date by every update. Predecessor, Successor, LowerBound,
+// UpperBound and operator[] each return a member of their own, holding the
+// answer until the next call to the same function: s[0] == s[2] compares that
+// member with itself. The ...Value functions and At return copies instead,
+// and none of these queries is safe for concurrent readers.
+template <typename Data>
+class SetRoaring : public virtual Set<Data>,
+                   public virtual ResizableContainer {
+  // Must extend Set<Data>,
+  //             ResizableContainer
+
+  static_assert(std::is_integral_v<Data> && sizeof(Data) <= 4, "SetRoaring holds integers of at most 32 bits");
+
+private:
+
+  static constexpr std::uint32_t ChunkValues = 1U << 16;
+  static constexpr std::uint32_t Words = ChunkValues / 64; // 64-bit words of a bitmap chunk
+  static constexpr std::uint32_t ArrayMax = 4096;          // Above this an array is larger than a bitmap
+  static constexpr std::uint32_t ArrayMin = ArrayMax / 2;  // A bitmap going below this becomes an array again
+
+  enum class Kind : std::uint8_t { Array, Bitmap, Run };
+
+  struct Chunk {
+
+    std::uint16_t key = 0;          // High 16 bits of its values
+    Kind kind = Kind::Array;
+    std::uint32_t count = 0;        // Values, from 1 to ChunkValues
+    std::uint32_t length = 0;       // Array: values stored; run: runs stored
+    std::uint32_t capacity = 0;     // Array: slots; run: pairs of slots
+    std::uint16_t* items = nullptr; // Array: sorted low halves; run: first and last value of each run
+    std::uint64_t* bits = nullptr;  // Bitmap: Words words
+
+  };
+
+  Chunk* chunks = nullptr; // Sorted by key
+  unsigned long chunkCount = 0;
+  unsigned long chunkCapacity = 0;
+
+  Data min{}; // Valid while size > 0
+  Data max{};
+
+  // One answer per query returning a reference, overwritten by its next call
+  mutable Data predecessor{};
+  mutable Data successor{};
+  mutable Data lowerBound{};
+  mutable Data upperBound{};
+  mutable Data element{};
+
+protected:
+
+  using Container::size;
+
+public:
+
+  // Bring base class methods into scope
+  using LinearContainer<Data>::operator==;
+  using LinearContainer<Data>::operator!=;
+  using DictionaryContainer<Data>::InsertAll;
+  using DictionaryContainer<Data>::InsertSome;
+
+  /* ************************************************************************ */
+
+  // Default constructor
+  SetRoaring() = default;
+
+  /* ************************************************************************ */
+
+  // Specific constructors (the chunks are optimized once filled)
+  SetRoaring(const TraversableContainer<Data>&); // Copy from TraversableContainer
+  SetRoaring(MappableContainer<Data>&&);         // Move from MappableContainer
+
+  template <ForeignInputRange<Data> Range>
+  SetRoaring(Range&&);                           // Copy from any input range
+
+  /* ************************************************************************ */
+
+  // Copy constructor
+  SetRoaring(const SetRoaring&);
+
+  // Move constructor
+  SetRoaring(SetRoaring&&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Destructor
+  ~SetRoaring();
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  SetRoaring& operator=(const SetRoaring&);
+
+  // Move assignment
+  SetRoaring& operator=(SetRoaring&&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Comparison operators
+  bool operator==(const SetRoaring&) const noexcept;
+  bool operator!=(const SetRoaring&) const noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from OrderedDictionaryContainer)
+
+  const Data& Min() const override;
+  Data MinNRemove() override;
+  void RemoveMin() override;
+
+  const Data& Max() const override;
+  Data MaxNRemove() override;
+  void RemoveMax() override;
+
+  const Data& Predecessor(const Data&) const override; // Aliases the previous Predecessor answer
+  Data PredecessorNRemove(const Data&) override;
+  void RemovePredecessor(const Data&) override;
+
+  const Data& Successor(const Data&) const override; // Aliases the previous Successor answer
+  Data SuccessorNRemove(const Data&) override;
+  void RemoveSuccessor(const Data&) override;
+
+  using typename OrderedDictionaryContainer<Data>::RangeFun;
+  const Data& LowerBound(const Data&) const override; // Aliases the previous LowerBound answer
+  const Data& UpperBound(const Data&) const override; // Aliases the previous UpperBound answer
+  void RangeTraverse(const Data&, const Data&, RangeFun) const override;
+  unsigned long RangeCount(const Data&, const Data&) const override; // By rank, without visiting the values
+  unsigned long RangeRemove(const Data&, const Data&) override;      // Drops whole chunks, rebuilds the partial ones
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from DictionaryContainer)
+
+  bool Insert(const Data&) override; // Copy
+  bool Insert(Data&&) override;      // Move
+  bool Remove(const Data&) override;
+
+  /* ************************************************************************ */
+
+  // Specific member functions (set algebra, chunk by chunk)
+
+  SetRoaring Union(const SetRoaring&) const;
+  SetRoaring Intersection(const SetRoaring&) const;
+  SetRoaring Difference(const SetRoaring&) const;          // Values here but not in the other
+  SetRoaring SymmetricDifference(const SetRoaring&) const;
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from LinearContainer)
+
+  const Data& operator[](unsigned long) const override; // Select by rank, O(chunks); aliases the previous answer
+  const Data& Front() const override; // The minimum, not an operator[] answer
+  const Data& Back() const override;  // The maximum, not an operator[] answer
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from TraversableContainer)
+
+  using typename TraversableContainer<Data>::TraverseFun;
+  void Traverse(TraverseFun) const override;
+  void PreOrderTraverse(TraverseFun) const override;  // Ascending order
+  void PostOrderTraverse(TraverseFun) const override; // Descending order
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from TestableContainer)
+
+  bool Exists(const Data&) const noexcept override;
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from ClearableContainer)
+
+  void Clear() override;
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from ResizableContainer)
+
+  // Resize the container to the given size by removing the largest elements if the size is reduced.
+  void Resize(unsigned long) override;
+
+  /* ************************************************************************ */
+
+  // Specific member functions (the queries above, by value)
+
+  Data At(unsigned long) const; // (must throw std::out_of_range when out of range)
+  Data PredecessorValue(const Data&) const; // (must throw std::length_error when not found)
+  Data SuccessorValue(const Data&) const;   // (must throw std::length_error when not found)
+  Data LowerBoundValue(const Data&) const;  // (must throw std::length_error when not found)
+  Data UpperBoundValue(const Data&) const;  // (must throw std::length_error when not found)
+
+  /* ************************************************************************ */
+
+  // Specific member functions
+
+  void Optimize();                             // Every chunk in its smallest form (runs included)
+  unsigned long MemoryBytes() const noexcept;  // Heap bytes held by the chunks and their directory
+
+protected:
+
+  // Auxiliary functions, if necessary!
+
+  // Order-preserving image of a value in [0, 2^32), and back
+  static std::uint32_t Encode(const Data&) noexcept;
+  static Data Decode(std::uint32_t) noexcept;
+  void UpdateBounds() noexcept; // Min and max from the first and last chunk
+
+  // Whole set, on encoded values
+  bool InsertCode(std::uint32_t);
+  bool RemoveCode(std::uint32_t);
+  bool CodeAtLeast(std::uint64_t, std::uint32_t&) const noexcept; // Smallest value not below
+  bool CodeAtMost(std::int64_t, std::uint32_t&) const noexcept;   // Largest value not above
+  unsigned long CodeRank(std::uint64_t) const noexcept;           // Values below
+  std::uint32_t CodeSelect(unsigned long) const noexcept;
+  unsigned long RemoveCodes(std::uint64_t, std::uint64_t);        // Values in [first, end)
+
+  // Chunk directory
+  unsigned long ChunkIndex(std::uint16_t) const noexcept; // First chunk whose key is not below
+  Chunk& AddChunk(unsigned long, std::uint16_t);
+  void DropChunk(unsigned long) noexcept;
+  static void Release(Chunk&) noexcept;
+  static void CopyChunk(Chunk&, const Chunk&);
+
+  // One chunk, on low halves
+  static bool Contains(const Chunk&, std::uint16_t) noexcept;
+  static bool Add(Chunk&, std::uint16_t);
+  static bool Erase(Chunk&, std::uint16_t);
+  static std::uint16_t First(const Chunk&) noexcept;
+  static std::uint16_t Last(const Chunk&) noexcept;
+  static bool AtLeast(const Chunk&, std::uint16_t, std::uint16_t&) noexcept;
+  static bool AtMost(const Chunk&, std::uint16_t, std::uint16_t&) noexcept;
+  static std::uint32_t Rank(const Chunk&, std::uint32_t) noexcept; // Values below, for up to ChunkValues
+  static std::uint16_t Select(const Chunk&, std::uint32_t) noexcept;
+  template <typename Fun>
+  static void Ascending(const Chunk&, Fun&&);
+  template <typename Fun>
+  static void Descending(const Chunk&, Fun&&);
+
+  // Representations
+  static void Reserve(Chunk&, std::uint32_t);                        // Room for that many array values or runs
+  static void InsertRun(Chunk&, std::uint32_t, std::uint16_t, std::uint16_t);
+  static void ToBitmap(Chunk&);
+  static void Expand(const Chunk&, std::uint64_t*) noexcept;         // As a bitmap
+  static void Settle(Chunk&, const std::uint64_t*, std::uint32_t);   // Smallest form of the bitmap with that count
+  static std::uint32_t CountRuns(const std::uint64_t*) noexcept;
+  static std::uint32_t NextSet(const std::uint64_t*, std::uint32_t) noexcept;   // ChunkValues if none
+  static std::uint32_t NextClear(const std::uint64_t*, std::uint32_t) noexcept; // ChunkValues if none
+  static std::int32_t PreviousSet(const std::uint64_t*, std::uint32_t) noexcept; // -1 if none
+
+  template <typename Op>
+  SetRoaring Combine(const SetRoaring&, bool, bool, Op) const; // Keeps the chunks only here / only in the other
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "setroaring.cpp"
+
+#endif
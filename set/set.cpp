@@ -0,0 +1,20 @@
+namespace lasd {
+
+/* ************************************************************************** */
+
+template <typename Data>
+unsigned long Set<Data>::ExistsBatch(const TraversableContainer<Data>& probes, Vector<bool>& found) const {
+  found.Resize(probes.Size());
+  unsigned long index = 0;
+  unsigned long hits = 0;
+  probes.Traverse([this, &found, &index, &hits](const Data& dat) {
+    const bool hit = this->Exists(dat);
+    found[index++] = hit;
+    hits += hit;
+  });
+  return hits;
+}
+
+/* ************************************************************************** */
+
+}
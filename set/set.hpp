@@ -6,7 +6,7 @@
 #include "../container/dictionary.hpp"
 #include "../container/traversable.hpp"
 #include "../container/linear.hpp"
-
+#include "../vector/vector.hpp"
 
 /* ************************************************************************** */
 
@@ -40,10 +40,21 @@ public:
   // Move assignment
   Set& operator=(Set&&) noexcept = delete; // Move assignment of abstract types is not possible.
 
+  /* ************************************************************************ */
+
+  // Specific member function
+
+  // Looks up every value of the container: the output gets one flag per
+  // value, in traversal order. Returns how many were found. By default it
+  // calls Exists once per value.
+  virtual unsigned long ExistsBatch(const TraversableContainer<Data>&, Vector<bool>&) const;
+
 };
 
 /* ************************************************************************** */
 
 }
 
+#include "set.cpp"
+
 #endif
@@ -0,0 +1,665 @@
+#include <algorithm>
+#include <bit>
+#include <utility>
+
+namespace lasd {
+
+/* ************************************************************************** */
+/* Constructors */
+
+inline SetVEB::SetVEB(const TraversableContainer<unsigned int>& container) {
+  container.Traverse([this](const unsigned int& dat) { Insert(dat); });
+}
+
+inline SetVEB::SetVEB(MappableContainer<unsigned int>&& container) {
+  container.Map([this](unsigned int& dat) { Insert(dat); });
+}
+
+inline SetVEB::SetVEB(const SetVEB& other) {
+  // Ascending order: each value becomes the new maximum
+  other.Traverse([this](const unsigned int& dat) { InsertValue(dat); });
+}
+
+inline SetVEB::SetVEB(SetVEB&& other) noexcept {
+  std::swap(min, other.min);
+  std::swap(max, other.max);
+  std::swap(summary, other.summary);
+  std::swap(slots, other.slots);
+  std::swap(capacity, other.capacity);
+  std::swap(clusters, other.clusters);
+  std::swap(shift, other.shift);
+  std::swap(size, other.size);
+}
+
+/* ************************************************************************** */
+/* Destructor */
+
+inline SetVEB::~SetVEB() {
+  Clear();
+}
+
+/* ************************************************************************** */
+/* Assignment operators */
+
+inline SetVEB& SetVEB::operator=(const SetVEB& other) {
+  if (this != &other) {
+    SetVEB tmp(other);
+    std::swap(*this, tmp);
+  }
+  return *this;
+}
+
+inline SetVEB& SetVEB::operator=(SetVEB&& other) noexcept {
+  std::swap(min, other.min);
+  std::swap(max, other.max);
+  std::swap(summary, other.summary);
+  std::swap(slots, other.slots);
+  std::swap(capacity, other.capacity);
+  std::swap(clusters, other.clusters);
+  std::swap(shift, other.shift);
+  std::swap(size, other.size);
+  return *this;
+}
+
+/* ************************************************************************** */
+/* Comparison operators */
+
+inline bool SetVEB::operator==(const SetVEB& other) const noexcept {
+  if (size != other.size) return false;
+  bool equal = true;
+  Traverse([&other, &equal](const unsigned int& dat) { equal = equal && other.Exists(dat); });
+  return equal;
+}
+
+inline bool SetVEB::operator!=(const SetVEB& other) const noexcept {
+  return !(*this == other);
+}
+
+/* ************************************************************************** */
+/* Min / Max */
+
+inline const unsigned int& SetVEB::Min() const {
+  if (size == 0) throw std::length_error("Empty set");
+  return min;
+}
+
+inline unsigned int SetVEB::MinNRemove() {
+  if (size == 0) throw std::length_error("Empty set");
+  const unsigned int value = min;
+  RemoveValue(value);
+  return value;
+}
+
+inline void SetVEB::RemoveMin() {
+  (void)MinNRemove();
+}
+
+inline const unsigned int& SetVEB::Max() const {
+  if (size == 0) throw std::length_error("Empty set");
+  return max;
+}
+
+inline unsigned int SetVEB::MaxNRemove() {
+  if (size == 0) throw std::length_error("Empty set");
+  const unsigned int value = max;
+  RemoveValue(value);
+  return value;
+}
+
+inline void SetVEB::RemoveMax() {
+  (void)MaxNRemove();
+}
+
+/* ************************************************************************** */
+/* Predecessor / Successor */
+
+inline const unsigned int& SetVEB::Predecessor(const unsigned int& dat) const {
+  predecessor = PredecessorValue(dat);
+  return predecessor;
+}
+
+inline unsigned int SetVEB::PredecessorValue(const unsigned int& dat) const {
+  unsigned int value;
+  if (!Previous(dat, value)) throw std::length_error("No predecessor");
+  return value;
+}
+
+inline unsigned int SetVEB::PredecessorNRemove(const unsigned int& dat) {
+  unsigned int value;
+  if (!Previous(dat, value)) throw std::length_error("No predecessor");
+  RemoveValue(value);
+  return value;
+}
+
+inline void SetVEB::RemovePredecessor(const unsigned int& dat) {
+  (void)PredecessorNRemove(dat);
+}
+
+inline const unsigned int& SetVEB::Successor(const unsigned int& dat) const {
+  successor = SuccessorValue(dat);
+  return successor;
+}
+
+inline unsigned int SetVEB::SuccessorValue(const unsigned int& dat) const {
+  unsigned int value;
+  if (!Next(dat, value)) throw std::length_error("No successor");
+  return value;
+}
+
+inline unsigned int SetVEB::SuccessorNRemove(const unsigned int& dat) {
+  unsigned int value;
+  if (!Next(dat, value)) throw std::length_error("No successor");
+  RemoveValue(value);
+  return value;
+}
+
+inline void SetVEB::RemoveSuccessor(const unsigned int& dat) {
+  (void)SuccessorNRemove(dat);
+}
+
+/* ************************************************************************** */
+/* Range queries */
+
+inline const unsigned int& SetVEB::LowerBound(const unsigned int& dat) const {
+  lowerBound = LowerBoundValue(dat);
+  return lowerBound;
+}
+
+inline unsigned int SetVEB::LowerBoundValue(const unsigned int& dat) const {
+  if (Exists(dat)) return dat;
+  unsigned int value;
+  if (!Next(dat, value)) throw std::length_error("No lower bound");
+  return value;
+}
+
+inline const unsigned int& SetVEB::UpperBound(const unsigned int& dat) const {
+  upperBound = UpperBoundValue(dat);
+  return upperBound;
+}
+
+inline unsigned int SetVEB::UpperBoundValue(const unsigned int& dat) const {
+  unsigned int value;
+  if (!Next(dat, value)) throw std::length_error("No upper bound");
+  return value;
+}
+
+inline void SetVEB::RangeTraverse(const unsigned int& lo, const unsigned int& hi, RangeFun fun) const {
+  if (!(lo < hi)) return;
+  unsigned int value = lo;
+  if (!Exists(value) && !Next(value, value)) return;
+  while (value < hi) {
+    fun(value);
+    if (!Next(value, value)) return;
+  }
+}
+
+inline unsigned long SetVEB::RangeCount(const unsigned int& lo, const unsigned int& hi) const {
+  if (!(lo < hi) || size == 0) return 0;
+  unsigned long count = (lo <= min && min < hi) ? 1 : 0;
+
+  // Every cluster met between the two ends, counting its bits below each end
+  const std::uint16_t first = lo >> 16;
+  const std::uint16_t last = (hi - 1) >> 16;
+  std::uint16_t key = first;
+  if (!Contains(summary, key) && !Next(summary, key, key)) return count;
+  while (key <= last) {
+    const Cluster& cluster = *Find(key);
+    const std::uint32_t from = (key == first) ? (lo & 0xFFFF) : 0;
+    const std::uint32_t to = (key == last) ? ((hi - 1) & 0xFFFF) + 1 : 1U << 16;
+    count += Rank(cluster, to) - Rank(cluster, from);
+    if (!Next(summary, key, key)) break;
+  }
+  return count;
+}
+
+inline unsigned long SetVEB::RangeRemove(const unsigned int& lo, const unsigned int& hi) {
+  if (!(lo < hi)) return 0;
+  unsigned long removed = 0;
+  unsigned int value = lo;
+  if (!Exists(value) && !Next(value, value)) return 0;
+  while (value < hi) {
+    RemoveValue(value);
+    ++removed;
+    if (!Next(value, value)) break; // Still defined for the removed value
+  }
+  return removed;
+}
+
+/* ************************************************************************** */
+/* Insert / Remove */
+
+inline bool SetVEB::Insert(const unsigned int& dat) {
+  if (Exists(dat)) return false;
+  InsertValue(dat);
+  return true;
+}
+
+inline bool SetVEB::Insert(unsigned int&& dat) {
+  return Insert(static_cast<const unsigned int&>(dat));
+}
+
+inline bool SetVEB::Remove(const unsigned int& dat) {
+  if (!Exists(dat)) return false;
+  RemoveValue(dat);
+  return true;
+}
+
+/* ************************************************************************** */
+/* Traverse / Exists / Clear */
+
+inline void SetVEB::Traverse(TraverseFun fun) const {
+  if (size == 0) return;
+  fun(min);
+  Ascending(summary, [this, &fun](std::uint16_t key) {
+    const std::uint32_t high = std::uint32_t(key) << 16;
+    Ascending(*Find(key), [&fun, high](std::uint16_t low) {
+      const unsigned int value = high | low;
+      fun(value);
+    });
+  });
+}
+
+inline bool SetVEB::Exists(const unsigned int& dat) const noexcept {
+  if (size == 0) return false;
+  if (dat == min || dat == max) return true;
+  const Cluster* cluster = Find(dat >> 16);
+  return cluster != nullptr && Contains(*cluster, dat & 0xFFFF);
+}
+
+inline void SetVEB::Clear() {
+  for (unsigned long i = 0; i < capacity; ++i) {
+    if (slots[i].key != FreeSlot) Release(slots[i].cluster);
+  }
+  delete[] slots;
+  slots = nullptr;
+  capacity = 0;
+  clusters = 0;
+  shift = 64;
+  Release(summary);
+  summary = Cluster();
+  size = 0;
+}
+
+/* ************************************************************************** */
+/* Specific member function */
+
+inline unsigned long SetVEB::MemoryBytes() const noexcept {
+  unsigned long bytes = capacity * sizeof(Slot) + Bytes(summary);
+  for (unsigned long i = 0; i < capacity; ++i) {
+    if (slots[i].key != FreeSlot) bytes += Bytes(slots[i].cluster);
+  }
+  return bytes;
+}
+
+/* ************************************************************************** */
+
+// Auxiliary functions: top level
+
+inline void SetVEB::InsertValue(unsigned int value) {
+  if (size == 0) {
+    min = max = value;
+    ++size;
+    return;
+  }
+  if (value < min) std::swap(value, min); // The old minimum goes down instead
+  if (value > max) max = value;
+  const std::uint16_t key = value >> 16;
+  Cluster* cluster = Find(key);
+  if (cluster == nullptr) {
+    // New cluster: recording its key is the only step that recurses
+    Add(summary, key);
+    Cluster& added = AddCluster(key);
+    added.min = added.max = value & 0xFFFF;
+    added.count = 1;
+  } else {
+    Add(*cluster, value & 0xFFFF);
+  }
+  ++size;
+}
+
+inline void SetVEB::RemoveValue(unsigned int value) {
+  if (size == 1) {
+    Clear(); // The table and the summary are already empty: give back their memory
+    return;
+  }
+  if (value == min) {
+    // The smallest stored value becomes the minimum and leaves its cluster
+    const std::uint16_t key = summary.min;
+    value = (std::uint32_t(key) << 16) | Find(key)->min;
+    min = value;
+  }
+  const std::uint16_t key = value >> 16;
+  Cluster& cluster = *Find(key);
+  Erase(cluster, value & 0xFFFF);
+  if (cluster.count == 0) {
+    DropCluster(key);
+    Erase(summary, key);
+  }
+  if (value == max) {
+    if (summary.count == 0) {
+      max = min;
+    } else {
+      max = (std::uint32_t(summary.max) << 16) | Find(summary.max)->max;
+    }
+  }
+  --size;
+}
+
+inline bool SetVEB::Next(unsigned int value, unsigned int& found) const noexcept {
+  if (size == 0 || value >= max) return false;
+  if (value < min) {
+    found = min;
+    return true;
+  }
+  const std::uint16_t key = value >> 16;
+  const Cluster* cluster = Find(key);
+  std::uint16_t low = 0;
+  if (cluster != nullptr && (value & 0xFFFF) < cluster->max && Next(*cluster, value & 0xFFFF, low)) {
+    found = (std::uint32_t(key) << 16) | low;
+    return true;
+  }
+  std::uint16_t next;
+  if (!Next(summary, key, next)) return false;
+  found = (std::uint32_t(next) << 16) | Find(next)->min;
+  return true;
+}
+
+inline bool SetVEB::Previous(unsigned int value, unsigned int& found) const noexcept {
+  if (size == 0 || value <= min) return false;
+  if (value > max) {
+    found = max;
+    return true;
+  }
+  const std::uint16_t key = value >> 16;
+  const Cluster* cluster = Find(key);
+  std::uint16_t low = 0;
+  if (cluster != nullptr && (value & 0xFFFF) > cluster->min && Previous(*cluster, value & 0xFFFF, low)) {
+    found = (std::uint32_t(key) << 16) | low;
+    return true;
+  }
+  std::uint16_t previous;
+  if (Previous(summary, key, previous)) {
+    found = (std::uint32_t(previous) << 16) | Find(previous)->max;
+  } else {
+    found = min;
+  }
+  return true;
+}
+
+/* ************************************************************************** */
+
+// Auxiliary functions: cluster table
+
+inline unsigned long SetVEB::Home(std::uint32_t key) const noexcept {
+  return (key * 0x9E3779B97F4A7C15ULL) >> shift;
+}
+
+inline const SetVEB::Cluster* SetVEB::Find(std::uint32_t key) const noexcept {
+  if (capacity == 0) return nullptr;
+  for (unsigned long i = Home(key); slots[i].key != FreeSlot; i = (i + 1) & (capacity - 1)) {
+    if (slots[i].key == key) return &slots[i].cluster;
+  }
+  return nullptr;
+}
+
+inline SetVEB::Cluster* SetVEB::Find(std::uint32_t key) noexcept {
+  return const_cast<Cluster*>(static_cast<const SetVEB*>(this)->Find(key));
+}
+
+inline SetVEB::Cluster& SetVEB::AddCluster(std::uint32_t key) {
+  if (LoadDen * (clusters + 1) > LoadNum * capacity) Rehash(std::max(MinCapacity, 2 * capacity));
+  unsigned long i = Home(key);
+  while (slots[i].key != FreeSlot) i = (i + 1) & (capacity - 1);
+  slots[i].key = key;
+  slots[i].cluster = Cluster();
+  ++clusters;
+  return slots[i].cluster;
+}
+
+inline void SetVEB::DropCluster(std::uint32_t key) {
+  unsigned long hole = Home(key);
+  while (slots[hole].key != key) hole = (hole + 1) & (capacity - 1);
+  Release(slots[hole].cluster);
+
+  // Backward shift: pull later entries of the probe run into the hole
+  for (unsigned long next = (hole + 1) & (capacity - 1); slots[next].key != FreeSlot; next = (next + 1) & (capacity - 1)) {
+    const unsigned long home = Home(slots[next].key);
+    const bool stays = (hole <= next) ? (hole < home && home <= next) : (hole < home || home <= next);
+    if (!stays) {
+      slots[hole] = slots[next];
+      hole = next;
+    }
+  }
+  slots[hole].key = FreeSlot;
+  slots[hole].cluster = Cluster();
+  --clusters;
+
+  if (capacity > MinCapacity && 8 * clusters < capacity) Rehash(capacity / 2);
+}
+
+inline void SetVEB::Rehash(unsigned long newCapacity) {
+  Slot* old = slots;
+  const unsigned long oldCapacity = capacity;
+  slots = new Slot[newCapacity];
+  capacity = newCapacity;
+  shift = 64 - std::countr_zero(newCapacity);
+  for (unsigned long j = 0; j < oldCapacity; ++j) {
+    if (old[j].key == FreeSlot) continue;
+    unsigned long i = Home(old[j].key);
+    while (slots[i].key != FreeSlot) i = (i + 1) & (capacity - 1);
+    slots[i] = old[j]; // The bodies change owner
+  }
+  delete[] old;
+}
+
+/* ************************************************************************** */
+
+// Auxiliary functions: one cluster
+
+inline bool SetVEB::Contains(const Cluster& cluster, std::uint16_t low) noexcept {
+  if (cluster.count == 0) return false;
+  if (low == cluster.min || low == cluster.max) return true;
+  if (cluster.body == nullptr) return false;
+  const Body& body = *cluster.body;
+  const std::uint32_t key = low >> LeafBits;
+  return TestBit(body.summary, key) && ((body.leaves[CountBelow(body.summary, key)] >> (low & 63)) & 1);
+}
+
+inline void SetVEB::Add(Cluster& cluster, std::uint16_t low) {
+  if (cluster.count == 0) {
+    cluster.min = cluster.max = low;
+    cluster.count = 1;
+    return;
+  }
+  if (low < cluster.min) std::swap(low, cluster.min);
+  if (low > cluster.max) cluster.max = low;
+  if (cluster.body == nullptr) cluster.body = new Body;
+  Body& body = *cluster.body;
+  const std::uint32_t key = low >> LeafBits;
+  const std::uint32_t index = CountBelow(body.summary, key);
+  if (!TestBit(body.summary, key)) {
+    // New leaf, packed in key order
+    if (body.length == body.capacity) {
+      const std::uint32_t newCapacity = std::min(Leaves, body.capacity == 0 ? 1U : 2 * body.capacity);
+      std::uint64_t* moved = new std::uint64_t[newCapacity];
+      std::copy(body.leaves, body.leaves + body.length, moved);
+      delete[] body.leaves;
+      body.leaves = moved;
+      body.capacity = newCapacity;
+    }
+    std::copy_backward(body.leaves + index, body.leaves + body.length, body.leaves + body.length + 1);
+    body.leaves[index] = 0;
+    ++body.length;
+    body.summary[key >> 6] |= std::uint64_t(1) << (key & 63);
+  }
+  body.leaves[index] |= std::uint64_t(1) << (low & 63);
+  ++cluster.count;
+}
+
+inline void SetVEB::Erase(Cluster& cluster, std::uint16_t low) {
+  if (cluster.count == 1) {
+    cluster.count = 0;
+    return;
+  }
+  Body& body = *cluster.body;
+  if (low == cluster.min) {
+    const std::uint32_t first = NextBit(body.summary, 0);
+    low = (first << LeafBits) | std::countr_zero(body.leaves[0]);
+    cluster.min = low;
+  }
+  const std::uint32_t key = low >> LeafBits;
+  const std::uint32_t index = CountBelow(body.summary, key);
+  body.leaves[index] &= ~(std::uint64_t(1) << (low & 63));
+  if (body.leaves[index] == 0) {
+    std::copy(body.leaves + index + 1, body.leaves + body.length, body.leaves + index);
+    --body.length;
+    body.summary[key >> 6] &= ~(std::uint64_t(1) << (key & 63));
+    if (body.length > 0 && 4 * body.length < body.capacity) {
+      std::uint64_t* moved = new std::uint64_t[body.capacity / 2];
+      std::copy(body.leaves, body.leaves + body.length, moved);
+      delete[] body.leaves;
+      body.leaves = moved;
+      body.capacity /= 2;
+    }
+  }
+  if (--cluster.count == 1) {
+    // Only the minimum is left
+    Release(cluster);
+    cluster.max = cluster.min;
+  } else if (low == cluster.max) {
+    const int last = PreviousBit(body.summary, Leaves - 1);
+    cluster.max = (std::uint32_t(last) << LeafBits) | (63 - std::countl_zero(body.leaves[body.length - 1]));
+  }
+}
+
+inline bool SetVEB::Next(const Cluster& cluster, std::uint16_t low, std::uint16_t& found) noexcept {
+  if (cluster.count == 0 || low >= cluster.max) return false;
+  if (low < cluster.min) {
+    found = cluster.min;
+    return true;
+  }
+  // Here the maximum is in a leaf
+  const Body& body = *cluster.body;
+  const std::uint32_t key = low >> LeafBits;
+  std::uint32_t index = CountBelow(body.summary, key);
+  if (TestBit(body.summary, key)) {
+    const std::uint64_t above = body.leaves[index] & ~((std::uint64_t(2) << (low & 63)) - 1);
+    if (above != 0) {
+      found = (key << LeafBits) | std::countr_zero(above);
+      return true;
+    }
+    ++index;
+  }
+  const int next = NextBit(body.summary, key + 1);
+  found = (std::uint32_t(next) << LeafBits) | std::countr_zero(body.leaves[index]);
+  return true;
+}
+
+inline bool SetVEB::Previous(const Cluster& cluster, std::uint16_t low, std::uint16_t& found) noexcept {
+  if (cluster.count == 0 || low <= cluster.min) return false;
+  if (low > cluster.max) {
+    found = cluster.max;
+    return true;
+  }
+  const Body& body = *cluster.body;
+  const std::uint32_t key = low >> LeafBits;
+  const std::uint32_t index = CountBelow(body.summary, key);
+  if (TestBit(body.summary, key)) {
+    const std::uint64_t below = body.leaves[index] & ((std::uint64_t(1) << (low & 63)) - 1);
+    if (below != 0) {
+      found = (key << LeafBits) | (63 - std::countl_zero(below));
+      return true;
+    }
+  }
+  const int previous = PreviousBit(body.summary, int(key) - 1);
+  if (previous < 0) {
+    found = cluster.min;
+  } else {
+    found = (std::uint32_t(previous) << LeafBits) | (63 - std::countl_zero(body.leaves[index - 1]));
+  }
+  return true;
+}
+
+inline std::uint32_t SetVEB::Rank(const Cluster& cluster, std::uint32_t low) noexcept {
+  if (cluster.count == 0) return 0;
+  std::uint32_t rank = (cluster.min < low) ? 1 : 0;
+  if (cluster.body == nullptr) return rank;
+  const Body& body = *cluster.body;
+  const std::uint32_t key = low >> LeafBits;
+  const std::uint32_t index = CountBelow(body.summary, key);
+  for (std::uint32_t i = 0; i < index; ++i) rank += std::popcount(body.leaves[i]);
+  if (key < Leaves && TestBit(body.summary, key)) {
+    rank += std::popcount(body.leaves[index] & ((std::uint64_t(1) << (low & 63)) - 1));
+  }
+  return rank;
+}
+
+template <typename Fun>
+void SetVEB::Ascending(const Cluster& cluster, Fun&& fun) {
+  if (cluster.count == 0) return;
+  fun(cluster.min);
+  if (cluster.body == nullptr) return;
+  const Body& body = *cluster.body;
+  std::uint32_t index = 0;
+  for (std::uint32_t w = 0; w < SummaryWords; ++w) {
+    for (std::uint64_t keys = body.summary[w]; keys != 0; keys &= keys - 1) {
+      const std::uint32_t high = (64 * w + std::countr_zero(keys)) << LeafBits;
+      for (std::uint64_t bits = body.leaves[index++]; bits != 0; bits &= bits - 1) {
+        fun(static_cast<std::uint16_t>(high | std::countr_zero(bits)));
+      }
+    }
+  }
+}
+
+inline void SetVEB::Release(Cluster& cluster) noexcept {
+  if (cluster.body != nullptr) {
+    delete[] cluster.body->leaves;
+    delete cluster.body;
+    cluster.body = nullptr;
+  }
+}
+
+inline unsigned long SetVEB::Bytes(const Cluster& cluster) noexcept {
+  return (cluster.body == nullptr) ? 0 : sizeof(Body) + cluster.body->capacity * sizeof(std::uint64_t);
+}
+
+/* ************************************************************************** */
+
+// Auxiliary functions: cluster summaries
+
+inline bool SetVEB::TestBit(const std::uint64_t* words, std::uint32_t bit) noexcept {
+  return (words[bit >> 6] >> (bit & 63)) & 1;
+}
+
+inline std::uint32_t SetVEB::CountBelow(const std::uint64_t* words, std::uint32_t bit) noexcept {
+  std::uint32_t count = 0;
+  for (std::uint32_t w = 0; w < (bit >> 6); ++w) count += std::popcount(words[w]);
+  if ((bit & 63) != 0) count += std::popcount(words[bit >> 6] & ((std::uint64_t(1) << (bit & 63)) - 1));
+  return count;
+}
+
+inline int SetVEB::NextBit(const std::uint64_t* words, int from) noexcept {
+  if (from >= int(Leaves)) return -1;
+  int w = from >> 6;
+  std::uint64_t word = words[w] & (~std::uint64_t(0) << (from & 63));
+  while (word == 0) {
+    if (++w == int(SummaryWords)) return -1;
+    word = words[w];
+  }
+  return 64 * w + std::countr_zero(word);
+}
+
+inline int SetVEB::PreviousBit(const std::uint64_t* words, int from) noexcept {
+  if (from < 0) return -1;
+  int w = from >> 6;
+  std::uint64_t word = words[w] & (~std::uint64_t(0) >> (63 - (from & 63)));
+  while (word == 0) {
+    if (w-- == 0) return -1;
+    word = words[w];
+  }
+  return 64 * w + 63 - std::countl_zero(word);
+}
+
+/* ************************************************************************** */
+
+}
@@ -0,0 +1,255 @@
+#ifndef SETVEB_HPP
+#define SETVEB_HPP
+
+/* ************************************************************************** */
+
+#include "../../container/container.hpp"
+#include "../../container/dictionary.hpp"
+#include "../../container/traversable.hpp"
+#include <cstdint>
+#include <stdexcept>
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Van Emde Boas set over the 2^32 unsigned int values. As in the textbook
+// structure, every level keeps its minimum outside its children, so creating
+// a child or emptying one costs O(1) and each query descends a single path:
+//   - the top level splits a value into 16 + 16 bits; its clusters live in a
+//     hash table keyed by the high half, and a summary records which exist;
+//   - a cluster (universe 2^16) splits its values into 10 + 6 bits; its
+//     leaves are single 64-bit words, packed in key order and found by
+//     counting the bits below in its 1024-bit summary. A cluster holding one
+//     value is just its minimum: leaves and summary come with the second;
+//   - the recursion stops at the leaves, whose queries are word operations.
+// Only non-empty clusters and leaves are allocated, so the space is linear in
+// the number of values instead of proportional to the universe. The constant
+// is large on sparse keys, though: a cluster holding a few scattered values
+// spends a 64-bit leaf on each of them plus a 1024-bit summary, so 4M uniform
+// random keys take about 14 bytes per value (57 MB) against the 4 of SetVec.
+// Only dense key ranges bring it below a sorted array.
+//
+// Predecessor, Successor, LowerBound and UpperBound each keep their answer in
+// a member of their own, valid until the next call to the same function:
+// s.Predecessor(a) == s.Predecessor(b) compares that member with itself. The
+// ...Value functions return copies instead.
+class SetVEB : public virtual OrderedDictionaryContainer<unsigned int>,
+               public virtual TraversableContainer<unsigned int>,
+               public virtual ClearableContainer {
+  // Must extend OrderedDictionaryContainer<unsigned int>,
+  //             TraversableContainer<unsigned int>,
+  //             ClearableContainer
+
+private:
+
+  static constexpr std::uint32_t FreeSlot = ~0U; // Cluster keys are below 2^16
+  static constexpr unsigned long MinCapacity = 16;
+  static constexpr unsigned long LoadNum = 3; // The table is at most 3/4 full
+  static constexpr unsigned long LoadDen = 4;
+
+  // A cluster splits a low half into LeafBits for the word inside a leaf and the rest for the leaf
+  static constexpr std::uint32_t LeafBits = 6;
+  static constexpr std::uint32_t Leaves = 1U << (16 - LeafBits);
+  static constexpr std::uint32_t SummaryWords = Leaves / 64;
+
+  // Leaves and their index, allocated once a cluster holds two values
+  struct Body {
+
+    std::uint64_t summary[SummaryWords] = {}; // Bit i set when leaf i exists
+    std::uint64_t* leaves = nullptr;          // Only the existing leaves, in key order
+    std::uint32_t length = 0;
+    std::uint32_t capacity = 0;
+
+  };
+
+  // Universe 2^16: the minimum stays out of the leaves
+  struct Cluster {
+
+    std::uint16_t min = 0;
+    std::uint16_t max = 0;
+    std::uint32_t count = 0;
+    Body* body = nullptr; // Null while count < 2
+
+  };
+
+  struct Slot {
+
+    std::uint32_t key = FreeSlot;
+    Cluster cluster;
+
+  };
+
+  unsigned int min = 0; // Not stored in any cluster
+  unsigned int max = 0;
+  Cluster summary;      // High halves of the values in the clusters
+
+  Slot* slots = nullptr; // Open addressing with linear probing
+  unsigned long capacity = 0;
+  unsigned long clusters = 0;
+  unsigned int shift = 64;
+
+  // One answer per query returning a reference, overwritten by its next call
+  mutable unsigned int predecessor = 0;
+  mutable unsigned int successor = 0;
+  mutable unsigned int lowerBound = 0;
+  mutable unsigned int upperBound = 0;
+
+protected:
+
+  using Container::size;
+
+public:
+
+  // Default constructor
+  SetVEB() = default;
+
+  /* ************************************************************************ */
+
+  // Specific constructors
+  SetVEB(const TraversableContainer<unsigned int>&); // Copy from TraversableContainer
+  SetVEB(MappableContainer<unsigned int>&&);         // Move from MappableContainer
+
+  /* ************************************************************************ */
+
+  // Copy constructor
+  SetVEB(const SetVEB&);
+
+  // Move constructor
+  SetVEB(SetVEB&&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Destructor
+  ~SetVEB();
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  SetVEB& operator=(const SetVEB&);
+
+  // Move assignment
+  SetVEB& operator=(SetVEB&&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Comparison operators
+  bool operator==(const SetVEB&) const noexcept;
+  bool operator!=(const SetVEB&) const noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from OrderedDictionaryContainer)
+
+  const unsigned int& Min() const override;
+  unsigned int MinNRemove() override;
+  void RemoveMin() override;
+
+  const unsigned int& Max() const override;
+  unsigned int MaxNRemove() override;
+  void RemoveMax() override;
+
+  const unsigned int& Predecessor(const unsigned int&) const override; // Aliases the previous Predecessor answer
+  unsigned int PredecessorNRemove(const unsigned int&) override;
+  void RemovePredecessor(const unsigned int&) override;
+
+  const unsigned int& Successor(const unsigned int&) const override; // Aliases the previous Successor answer
+  unsigned int SuccessorNRemove(const unsigned int&) override;
+  void RemoveSuccessor(const unsigned int&) override;
+
+  using typename OrderedDictionaryContainer<unsigned int>::RangeFun;
+  const unsigned int& LowerBound(const unsigned int&) const override; // Aliases the previous LowerBound answer
+  const unsigned int& UpperBound(const unsigned int&) const override; // Aliases the previous UpperBound answer
+  void RangeTraverse(const unsigned int&, const unsigned int&, RangeFun) const override;
+  unsigned long RangeCount(const unsigned int&, const unsigned int&) const override; // Counts bits, cluster by cluster
+  unsigned long RangeRemove(const unsigned int&, const unsigned int&) override;
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from DictionaryContainer)
+
+  bool Insert(const unsigned int&) override; // Copy
+  bool Insert(unsigned int&&) override;      // Move
+  bool Remove(const unsigned int&) override;
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from TraversableContainer)
+
+  using typename TraversableContainer<unsigned int>::TraverseFun;
+  void Traverse(TraverseFun) const override; // Ascending order
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from TestableContainer)
+
+  bool Exists(const unsigned int&) const noexcept override;
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from ClearableContainer)
+
+  void Clear() override;
+
+  /* ************************************************************************ */
+
+  // Specific member functions (the queries above, by value)
+
+  unsigned int PredecessorValue(const unsigned int&) const; // (must throw std::length_error when not found)
+  unsigned int SuccessorValue(const unsigned int&) const;   // (must throw std::length_error when not found)
+  unsigned int LowerBoundValue(const unsigned int&) const;  // (must throw std::length_error when not found)
+  unsigned int UpperBoundValue(const unsigned int&) const;  // (must throw std::length_error when not found)
+
+  /* ************************************************************************ */
+
+  // Specific member function
+
+  unsigned long MemoryBytes() const noexcept; // Heap bytes held by the table and the leaves
+
+protected:
+
+  // Auxiliary functions, if necessary!
+
+  // Top level
+  void InsertValue(unsigned int);                           // The value must be missing
+  void RemoveValue(unsigned int);                           // The value must be present
+  bool Next(unsigned int, unsigned int&) const noexcept;     // Smallest value above
+  bool Previous(unsigned int, unsigned int&) const noexcept; // Largest value below
+
+  // Cluster table
+  unsigned long Home(std::uint32_t) const noexcept;
+  const Cluster* Find(std::uint32_t) const noexcept;
+  Cluster* Find(std::uint32_t) noexcept;
+  Cluster& AddCluster(std::uint32_t);
+  void DropCluster(std::uint32_t);
+  void Rehash(unsigned long);
+
+  // One cluster, on low halves
+  static bool Contains(const Cluster&, std::uint16_t) noexcept;
+  static void Add(Cluster&, std::uint16_t);   // The value must be missing
+  static void Erase(Cluster&, std::uint16_t); // The value must be present
+  static bool Next(const Cluster&, std::uint16_t, std::uint16_t&) noexcept;
+  static bool Previous(const Cluster&, std::uint16_t, std::uint16_t&) noexcept;
+  static std::uint32_t Rank(const Cluster&, std::uint32_t) noexcept; // Values below, for up to 2^16
+  template <typename Fun>
+  static void Ascending(const Cluster&, Fun&&);
+  static void Release(Cluster&) noexcept;
+  static unsigned long Bytes(const Cluster&) noexcept;
+
+  // Cluster summaries
+  static bool TestBit(const std::uint64_t*, std::uint32_t) noexcept;
+  static std::uint32_t CountBelow(const std::uint64_t*, std::uint32_t) noexcept;
+  static int NextBit(const std::uint64_t*, int) noexcept;     // First set bit from the given one, -1 if none
+  static int PreviousBit(const std::uint64_t*, int) noexcept; // Last set bit up to the given one, -1 if none
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "setveb.cpp"
+
+#endif
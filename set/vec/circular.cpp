@@ -0,0 +1,92 @@
+#include <algorithm>
+#include <utility>
+
+namespace lasd {
+
+/* ************************************************************************** */
+/* Index arithmetic */
+
+inline unsigned long CircularSlot(unsigned long head, unsigned long index, unsigned long capacity) noexcept {
+  return (head + index) & (capacity - 1);
+}
+
+inline unsigned long CircularFirstSegment(unsigned long head, unsigned long size, unsigned long capacity) noexcept {
+  return (capacity - head < size) ? capacity - head : size;
+}
+
+/* ************************************************************************** */
+/* Search */
+
+template <typename Data>
+unsigned long CircularLowerIndex(const Data* array, unsigned long head, unsigned long size, unsigned long capacity, const Data& dat) {
+  if (size == 0) return 0;
+  // Search only the run that can hold the value, as a plain contiguous array
+  const unsigned long first = CircularFirstSegment(head, size, capacity);
+  if (first < size && array[head + first - 1] < dat) {
+    return first + (std::lower_bound(array, array + (size - first), dat) - array);
+  }
+  return std::lower_bound(array + head, array + head + first, dat) - (array + head);
+}
+
+template <typename Data>
+unsigned long CircularUpperIndex(const Data* array, unsigned long head, unsigned long size, unsigned long capacity, const Data& dat) {
+  if (size == 0) return 0;
+  const unsigned long first = CircularFirstSegment(head, size, capacity);
+  if (first < size && !(dat < array[head + first - 1])) {
+    return first + (std::upper_bound(array, array + (size - first), dat) - array);
+  }
+  return std::upper_bound(array + head, array + head + first, dat) - (array + head);
+}
+
+/* ************************************************************************** */
+/* Shifts */
+
+template <typename Elem>
+void CircularShiftTowardHead(Elem* array, unsigned long head, unsigned long capacity, unsigned long first, unsigned long last) {
+  while (first < last) {
+    const unsigned long to = CircularSlot(head, first, capacity);
+    const unsigned long from = CircularSlot(head, first + 1, capacity);
+    const unsigned long run = std::min({last - first, capacity - to, capacity - from});
+    std::move(array + from, array + from + run, array + to);
+    first += run;
+  }
+}
+
+template <typename Elem>
+void CircularShiftTowardTail(Elem* array, unsigned long head, unsigned long capacity, unsigned long first, unsigned long last) {
+  while (first < last) {
+    const unsigned long to = CircularSlot(head, last, capacity); // Where the value at last - 1 goes
+    const unsigned long from = CircularSlot(head, last - 1, capacity);
+    const unsigned long run = std::min({last - first, to + 1, from + 1});
+    std::move_backward(array + from + 1 - run, array + from + 1, array + to + 1);
+    last -= run;
+  }
+}
+
+template <typename... Elems>
+bool CircularOpenGap(unsigned long& head, unsigned long size, unsigned long capacity, unsigned long index, Elems*... arrays) {
+  if (index < size / 2) {
+    // Closer to the head: step head back and shift the prefix left
+    head = (head - 1) & (capacity - 1);
+    (CircularShiftTowardHead(arrays, head, capacity, 0, index), ...);
+    return true;
+  }
+  (CircularShiftTowardTail(arrays, head, capacity, index, size), ...);
+  return false;
+}
+
+template <typename... Elems>
+bool CircularRemoveAt(unsigned long& head, unsigned long size, unsigned long capacity, unsigned long index, Elems*... arrays) {
+  if (index < size / 2) {
+    // Closer to the head: shift the prefix right and advance head (O(1) for the minimum)
+    (CircularShiftTowardTail(arrays, head, capacity, 0, index), ...);
+    head = (head + 1) & (capacity - 1);
+    return true;
+  }
+  (CircularShiftTowardHead(arrays, head, capacity, index, size - 1), ...);
+  return false;
+}
+
+/* ************************************************************************** */
+
+}
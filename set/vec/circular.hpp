@@ -0,0 +1,45 @@
+#ifndef CIRCULAR_HPP
+#define CIRCULAR_HPP
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Index arithmetic and shifts on a circular buffer whose capacity is zero or
+// a power of two, shared by SetVec and OrderedMap. Indices are logical (0 is
+// the slot at head). The owner keeps the arrays, the head and the size, and
+// grows a full buffer before opening a gap in it. Shifts move contiguous
+// runs, split only where the buffer wraps.
+
+inline unsigned long CircularSlot(unsigned long head, unsigned long index, unsigned long capacity) noexcept;
+inline unsigned long CircularFirstSegment(unsigned long head, unsigned long size, unsigned long capacity) noexcept; // Length of the run from head to the end of the buffer
+
+// Sorted buffers: a binary search over the only run that can hold the value
+template <typename Data>
+unsigned long CircularLowerIndex(const Data*, unsigned long head, unsigned long size, unsigned long capacity, const Data&); // First index whose value is not below the given one
+template <typename Data>
+unsigned long CircularUpperIndex(const Data*, unsigned long head, unsigned long size, unsigned long capacity, const Data&); // First index whose value is above the given one
+
+template <typename Elem>
+void CircularShiftTowardHead(Elem*, unsigned long head, unsigned long capacity, unsigned long first, unsigned long last); // Indices [first + 1, last + 1) move back by one
+template <typename Elem>
+void CircularShiftTowardTail(Elem*, unsigned long head, unsigned long capacity, unsigned long first, unsigned long last); // Indices [first, last) move forward by one
+
+// Both shift the shorter side of every array alike, moving head when that is
+// the prefix, and leave the size to the caller. They return true if the
+// prefix moved: indices [0, index] after a gap, [0, index) after a removal.
+// Otherwise [index, size] or [index, size - 1) did.
+template <typename... Elems>
+bool CircularOpenGap(unsigned long& head, unsigned long size, unsigned long capacity, unsigned long index, Elems*...); // Needs size < capacity
+template <typename... Elems>
+bool CircularRemoveAt(unsigned long& head, unsigned long size, unsigned long capacity, unsigned long index, Elems*...);
+
+/* ************************************************************************** */
+
+}
+
+#include "circular.cpp"
+
+#endif
@@ -1,3 +1,11 @@
+#include <algorithm>
+#include <bit>
+#include <type_traits>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 namespace lasd {
 
 /* ************************************************************************** */
@@ -5,23 +13,33 @@ namespace lasd {
 
 template <typename Data>
 SetVec<Data>::SetVec(const TraversableContainer<Data>& container) {
-  container.Traverse([this](const Data& dat) {
-    Insert(dat);
-  });
+  InsertAll(container);
 }
 
 template <typename Data>
 SetVec<Data>::SetVec(MappableContainer<Data>&& container) {
-  container.Map([this](Data& dat) {
-    Insert(std::move(dat));
-  });
+  InsertAll(std::move(container));
+}
+
+template <typename Data>
+template <ForeignInputRange<Data> Range>
+SetVec<Data>::SetVec(Range&& range) {
+  InsertAll(std::forward<Range>(range));
 }
 
 template <typename Data>
 SetVec<Data>::SetVec(const SetVec& other) {
-  for (unsigned long i = 0; i < other.size; ++i) {
-    Insert(other[i]); 
+  // Already sorted: copy straight into a buffer starting at 0
+  if (other.size > 0) {
+    capacity = std::bit_ceil(other.size);
+    elements = new Data[capacity];
+    for (unsigned long i = 0; i < other.size; ++i) {
+      elements[i] = other.elements[other.CircularIndex(i)];
+    }
+    size = other.size;
+    tail = size & (capacity - 1);
   }
+  indexEnabled = other.indexEnabled;
 }
 
 template <typename Data>
@@ -31,6 +49,11 @@ SetVec<Data>::SetVec(SetVec&& other) noexcept {
   std::swap(tail, other.tail);
   std::swap(size, other.size);
   std::swap(capacity, other.capacity);
+  std::swap(indexEnabled, other.indexEnabled);
+  std::swap(indexValid, other.indexValid);
+  std::swap(indexKeys, other.indexKeys);
+  std::swap(indexRanks, other.indexRanks);
+  std::swap(snapshots, other.snapshots);
 }
 
 /* ************************************************************************** */
@@ -42,6 +65,8 @@ SetVec<Data>::~SetVec() {
     delete[] elements;
     elements = nullptr;
   }
+  ReleaseIndex();
+  delete snapshots;
 }
 
 /* ************************************************************************** */
@@ -63,6 +88,11 @@ SetVec<Data>& SetVec<Data>::operator=(SetVec&& other) noexcept {
   std::swap(tail, other.tail);
   std::swap(size, other.size);
   std::swap(capacity, other.capacity);
+  std::swap(indexEnabled, other.indexEnabled);
+  std::swap(indexValid, other.indexValid);
+  std::swap(indexKeys, other.indexKeys);
+  std::swap(indexRanks, other.indexRanks);
+  std::swap(snapshots, other.snapshots);
   return *this;
 }
 
@@ -72,8 +102,12 @@ SetVec<Data>& SetVec<Data>::operator=(SetVec&& other) noexcept {
 template <typename Data>
 bool SetVec<Data>::operator==(const SetVec& other) const {
   if (size != other.size) return false;
+  const Data* mine = elements + head;
+  const Data* theirs = other.elements + other.head;
   for (unsigned long i = 0; i < size; ++i) {
-    if ((*this)[i] != other[i]) return false;
+    if (*mine != *theirs) return false;
+    if (++mine == elements + capacity) mine = elements;
+    if (++theirs == other.elements + other.capacity) theirs = other.elements;
   }
   return true;
 }
@@ -88,7 +122,7 @@ bool SetVec<Data>::operator!=(const SetVec& other) const {
 
 template <typename Data>
 unsigned long SetVec<Data>::CircularIndex(unsigned long index) const {
-  return (head + index) % capacity;
+  return CircularSlot(head, index, capacity); // Capacity is always a power of two
 }
 
 template <typename Data>
@@ -104,11 +138,16 @@ template <typename Data>
 void SetVec<Data>::Resize(unsigned long newCap) {
   if (newCap < size)
     throw std::length_error("Resize too small");
+  if (newCap == 0) {
+    Clear();
+    return;
+  }
 
+  newCap = std::bit_ceil(newCap);
   Data* newElems = new Data[newCap];
 
   for (unsigned long i = 0; i < size; ++i)
-    newElems[i] = std::move((*this)[i]);
+    newElems[i] = std::move(elements[CircularIndex(i)]);
 
   if (elements != nullptr) {
     delete[] elements;
@@ -117,45 +156,50 @@ void SetVec<Data>::Resize(unsigned long newCap) {
   elements = newElems;
   capacity = newCap;
   head = 0;
-  tail = size % capacity;
+  tail = size & (capacity - 1);
+  if (snapshots != nullptr) snapshots->Forget();
 }
 
 /* ************************************************************************** */
 /* Insert & Remove helpers */
 
 template <typename Data>
-void SetVec<Data>::InsertAt(unsigned long index, const Data& dat) {
+void SetVec<Data>::OpenGap(unsigned long index) {
+  indexValid = false;
   if (size == capacity) {
     Resize(capacity == 0 ? 1 : capacity * 2);
   }
-  for (unsigned long i = size; i > index; --i) {
-    elements[CircularIndex(i)] = std::move(elements[CircularIndex(i - 1)]);
+  if (CircularOpenGap(head, size, capacity, index, elements)) {
+    Touch(0, index + 1); // With the gap, which the caller fills
+  } else {
+    Touch(index, size + 1);
   }
-  elements[CircularIndex(index)] = dat;
   ++size;
-  tail = (head + size) % capacity;
+  tail = (head + size) & (capacity - 1);
+}
+
+template <typename Data>
+void SetVec<Data>::InsertAt(unsigned long index, const Data& dat) {
+  OpenGap(index);
+  elements[CircularIndex(index)] = dat;
 }
 
 template <typename Data>
 void SetVec<Data>::InsertAt(unsigned long index, Data&& dat) {
-  if (size == capacity) {
-    Resize(capacity == 0 ? 1 : capacity * 2);
-  }
-  for (unsigned long i = size; i > index; --i) {
-    elements[CircularIndex(i)] = std::move(elements[CircularIndex(i - 1)]);
-  }
+  OpenGap(index);
   elements[CircularIndex(index)] = std::move(dat);
-  ++size;
-  tail = (head + size) % capacity;
 }
 
 template <typename Data>
 void SetVec<Data>::RemoveAt(unsigned long index) {
-  for (unsigned long i = index; i < size - 1; ++i) {
-    elements[CircularIndex(i)] = std::move(elements[CircularIndex(i + 1)]);
+  indexValid = false;
+  if (CircularRemoveAt(head, size, capacity, index, elements)) {
+    Touch(0, index);
+  } else {
+    Touch(index, size - 1);
   }
   --size;
-  tail = (head + size) % capacity;
+  tail = (head + size) & (capacity - 1);
 }
 
 /* ************************************************************************** */
@@ -163,12 +207,14 @@ void SetVec<Data>::RemoveAt(unsigned long index) {
 
 template <typename Data>
 void SetVec<Data>::Clear() {
+  indexValid = false;
   delete[] elements;
   elements = nullptr;
   size = 0;
   capacity = 0;
   head = 0;
   tail = 0;
+  if (snapshots != nullptr) snapshots->Forget();
 }
 
 /* ************************************************************************** */
@@ -176,70 +222,70 @@ void SetVec<Data>::Clear() {
 
 template <typename Data>
 bool SetVec<Data>::Exists(const Data& dat) const noexcept {
-  return BinarySearch(dat) != -1;
+  if (EnsureIndex()) {
+    unsigned long node = IndexLowerNode(dat);
+    return (node != 0 && !(dat < indexKeys[node]));
+  }
+  unsigned long index = LowerIndex(dat);
+  return (index < size && !(dat < elements[CircularIndex(index)]));
 }
 
-
 /* ************************************************************************** */
-/* Insert / Remove */
+/* Traversals (two contiguous runs: [head, head + first) then [0, size - first)) */
 
 template <typename Data>
-bool SetVec<Data>::Insert(const Data& dat) {
-  for (unsigned long i = 0; i < size; ++i) {
-    if (dat == (*this)[i]) return false;
-    if (dat < (*this)[i]) {
-      InsertAt(i, dat);
-      return true;
-    }
-  }
-  InsertAt(size, dat);
-  return true;
+void SetVec<Data>::Traverse(TraverseFun fun) const {
+  PreOrderTraverse(fun);
 }
 
 template <typename Data>
-bool SetVec<Data>::Insert(Data&& dat) {
-  if (size == capacity) {
-    Resize(capacity == 0 ? 1 : capacity * 2);
+void SetVec<Data>::PreOrderTraverse(TraverseFun fun) const {
+  const unsigned long first = FirstSegment();
+  for (const Data* curr = elements + head; curr != elements + head + first; ++curr) {
+    fun(*curr);
   }
+  for (const Data* curr = elements; curr != elements + (size - first); ++curr) {
+    fun(*curr);
+  }
+}
 
-  long left = 0;
-  long right = size - 1;
-  long insertPos = 0;
-  bool exists = false;
-
-  while (left <= right) {
-    long mid = (left + right) / 2;
-    const Data& midVal = elements[CircularIndex(mid)];
-
-    if (midVal == dat) {
-      exists = true;
-      break;
-    } else if (midVal < dat) {
-      left = mid + 1;
-    } else {
-      right = mid - 1;
-    }
+template <typename Data>
+void SetVec<Data>::PostOrderTraverse(TraverseFun fun) const {
+  const unsigned long first = FirstSegment();
+  for (const Data* curr = elements + (size - first); curr != elements; ) {
+    fun(*--curr);
   }
+  for (const Data* curr = elements + head + first; curr != elements + head; ) {
+    fun(*--curr);
+  }
+}
 
-  if (exists) return false;
 
-  insertPos = left;
-  InsertAt(insertPos, std::move(dat)); 
+/* ************************************************************************** */
+/* Insert / Remove */
+
+template <typename Data>
+bool SetVec<Data>::Insert(const Data& dat) {
+  unsigned long index = LowerIndex(dat);
+  if (index < size && !(dat < elements[CircularIndex(index)])) return false;
+  InsertAt(index, dat);
   return true;
 }
 
+template <typename Data>
+bool SetVec<Data>::Insert(Data&& dat) {
+  unsigned long index = LowerIndex(dat);
+  if (index < size && !(dat < elements[CircularIndex(index)])) return false;
+  InsertAt(index, std::move(dat));
+  return true;
+}
 
 template <typename Data>
 bool SetVec<Data>::Remove(const Data& dat) {
   long index = BinarySearch(dat);
   if (index == -1) return false;
 
-  for (unsigned long i = index; i < size - 1; ++i) {
-    elements[CircularIndex(i)] = std::move(elements[CircularIndex(i + 1)]);
-  }
-
-  --size;
-  tail = (head + size) % capacity;
+  RemoveAt(index);
 
   if (size < capacity / 4 && capacity > 1)
     Resize(capacity / 2);
@@ -259,7 +305,7 @@ const Data& SetVec<Data>::Min() const {
 template <typename Data>
 Data SetVec<Data>::MinNRemove() {
   if (Empty()) throw std::length_error("Empty set");
-  Data tmp = (*this)[0];
+  Data tmp = std::move(elements[head]);
   RemoveAt(0);
   return tmp;
 }
@@ -279,7 +325,7 @@ const Data& SetVec<Data>::Max() const {
 template <typename Data>
 Data SetVec<Data>::MaxNRemove() {
   if (Empty()) throw std::length_error("Empty set");
-  Data tmp = (*this)[size - 1];
+  Data tmp = std::move(elements[CircularIndex(size - 1)]);
   RemoveAt(size - 1);
   return tmp;
 }
@@ -295,27 +341,23 @@ void SetVec<Data>::RemoveMax() {
 
 template <typename Data>
 const Data& SetVec<Data>::Predecessor(const Data& dat) const {
-  const Data* pred = nullptr;
-  for (unsigned long i = 0; i < size; ++i) {
-    if ((*this)[i] < dat) pred = &(*this)[i];
-    else break;
+  if (EnsureIndex()) {
+    unsigned long node = IndexPredecessorNode(dat);
+    if (node == 0) throw std::length_error("No predecessor");
+    return indexKeys[node];
   }
-  if (!pred) throw std::length_error("No predecessor");
-  return *pred;
+  unsigned long index = LowerIndex(dat);
+  if (index == 0) throw std::length_error("No predecessor");
+  return elements[CircularIndex(index - 1)];
 }
 
 template <typename Data>
 Data SetVec<Data>::PredecessorNRemove(const Data& dat) {
-  for (unsigned long i = 0; i < size; ++i) {
-    if ((*this)[i] < dat) {
-      if (i + 1 == size || (*this)[i + 1] >= dat) {
-        Data tmp = (*this)[i];
-        RemoveAt(i);
-        return tmp;
-      }
-    }
-  }
-  throw std::length_error("No predecessor");
+  unsigned long index = LowerIndex(dat);
+  if (index == 0) throw std::length_error("No predecessor");
+  Data tmp = std::move(elements[CircularIndex(index - 1)]);
+  RemoveAt(index - 1);
+  return tmp;
 }
 
 template <typename Data>
@@ -325,22 +367,23 @@ void SetVec<Data>::RemovePredecessor(const Data& dat) {
 
 template <typename Data>
 const Data& SetVec<Data>::Successor(const Data& dat) const {
-  for (unsigned long i = 0; i < size; ++i) {
-    if ((*this)[i] > dat) return (*this)[i];
+  if (EnsureIndex()) {
+    unsigned long node = IndexUpperNode(dat);
+    if (node == 0) throw std::length_error("No successor");
+    return indexKeys[node];
   }
-  throw std::length_error("No successor");
+  unsigned long index = UpperIndex(dat);
+  if (index == size) throw std::length_error("No successor");
+  return elements[CircularIndex(index)];
 }
 
 template <typename Data>
 Data SetVec<Data>::SuccessorNRemove(const Data& dat) {
-  for (unsigned long i = 0; i < size; ++i) {
-    if ((*this)[i] > dat) {
-      Data tmp = (*this)[i];
-      RemoveAt(i);
-      return tmp;
-    }
-  }
-  throw std::length_error("No successor");
+  unsigned long index = UpperIndex(dat);
+  if (index == size) throw std::length_error("No successor");
+  Data tmp = std::move(elements[CircularIndex(index)]);
+  RemoveAt(index);
+  return tmp;
 }
 
 template <typename Data>
@@ -348,77 +391,621 @@ void SetVec<Data>::RemoveSuccessor(const Data& dat) {
   (void)SuccessorNRemove(dat);
 }
 
+/* ************************************************************************** */
+/* Range queries */
+
+template <typename Data>
+const Data& SetVec<Data>::LowerBound(const Data& dat) const {
+  if (EnsureIndex()) {
+    unsigned long node = IndexLowerNode(dat);
+    if (node == 0) throw std::length_error("No lower bound");
+    return indexKeys[node];
+  }
+  unsigned long index = LowerIndex(dat);
+  if (index == size) throw std::length_error("No lower bound");
+  return elements[CircularIndex(index)];
+}
+
+template <typename Data>
+const Data& SetVec<Data>::UpperBound(const Data& dat) const {
+  if (EnsureIndex()) {
+    unsigned long node = IndexUpperNode(dat);
+    if (node == 0) throw std::length_error("No upper bound");
+    return indexKeys[node];
+  }
+  unsigned long index = UpperIndex(dat);
+  if (index == size) throw std::length_error("No upper bound");
+  return elements[CircularIndex(index)];
+}
+
+template <typename Data>
+void SetVec<Data>::RangeTraverse(const Data& lo, const Data& hi, RangeFun fun) const {
+  if (!(lo < hi)) return;
+  unsigned long last = QueryLowerIndex(hi);
+  for (unsigned long i = QueryLowerIndex(lo); i < last; ++i) {
+    fun(elements[CircularIndex(i)]);
+  }
+}
+
+template <typename Data>
+unsigned long SetVec<Data>::RangeCount(const Data& lo, const Data& hi) const {
+  if (!(lo < hi)) return 0;
+  return QueryLowerIndex(hi) - QueryLowerIndex(lo);
+}
+
+template <typename Data>
+unsigned long SetVec<Data>::RangeRemove(const Data& lo, const Data& hi) {
+  if (!(lo < hi)) return 0;
+  unsigned long first = LowerIndex(lo);
+  unsigned long removed = LowerIndex(hi) - first;
+  if (removed == 0) return 0;
+
+  indexValid = false;
+
+  // Close the gap with a single block shift of the shorter side
+  if (first < size - first - removed) {
+    for (unsigned long i = first; i > 0; --i) {
+      elements[CircularIndex(i - 1 + removed)] = std::move(elements[CircularIndex(i - 1)]);
+    }
+    head = (head + removed) & (capacity - 1);
+    Touch(0, first);
+  } else {
+    for (unsigned long i = first; i + removed < size; ++i) {
+      elements[CircularIndex(i)] = std::move(elements[CircularIndex(i + removed)]);
+    }
+    Touch(first, size - removed);
+  }
+  size -= removed;
+  tail = (head + size) & (capacity - 1);
+  Shrink();
+  return removed;
+}
+
 /* ************************************************************************** */
 /* InsertAll / RemoveAll / InsertSome / RemoveSome */
 
+template <typename Data>
+template <typename Value>
+void SetVec<Data>::PushBatch(Vector<Data>& batch, unsigned long& count, Value&& dat) {
+  if (count == batch.Size()) {
+    batch.Resize(count == 0 ? BulkThreshold : count * 2);
+  }
+  batch[count++] = std::forward<Value>(dat);
+}
+
+template <typename Data>
+unsigned long SetVec<Data>::InsertBatch(Vector<Data>& batch, unsigned long count) {
+  unsigned long inserted = 0;
+
+  if (count < BulkThreshold) {
+    for (unsigned long j = 0; j < count; ++j) {
+      inserted += Insert(std::move(batch[j]));
+    }
+    return inserted;
+  }
+
+  // Sort and dedupe the batch, then merge it with the buffer in one pass
+  Data* first = batch.begin();
+  std::sort(first, first + count);
+  Data* last = std::unique(first, first + count);
+  unsigned long unique = last - first;
+
+  unsigned long newCap = std::bit_ceil(size + unique);
+  Data* merged = new Data[newCap];
+  unsigned long i = 0;
+  unsigned long j = 0;
+  unsigned long k = 0;
+  while (i < size && j < unique) {
+    Data& curr = elements[CircularIndex(i)];
+    if (first[j] < curr) {
+      merged[k++] = std::move(first[j++]);
+    } else {
+      if (!(curr < first[j])) ++j; // Already present: keep the stored one
+      merged[k++] = std::move(curr);
+      ++i;
+    }
+  }
+  while (i < size) {
+    merged[k++] = std::move(elements[CircularIndex(i++)]);
+  }
+  while (j < unique) {
+    merged[k++] = std::move(first[j++]);
+  }
+
+  inserted = k - size;
+  indexValid = false;
+  delete[] elements;
+  elements = merged;
+  capacity = newCap;
+  size = k;
+  head = 0;
+  tail = size & (capacity - 1);
+  if (snapshots != nullptr) snapshots->Forget();
+  return inserted;
+}
+
 template <typename Data>
 bool SetVec<Data>::InsertAll(const TraversableContainer<Data>& container) {
-  bool modified = false;
-  container.Traverse([&](const Data& dat) { modified |= Insert(dat); });
-  return modified;
+  Vector<Data> batch;
+  unsigned long count = 0;
+  container.Traverse([&batch, &count](const Data& dat) { PushBatch(batch, count, dat); });
+  return (InsertBatch(batch, count) == count);
 }
 
 template <typename Data>
 bool SetVec<Data>::InsertAll(MappableContainer<Data>&& container) {
-  bool modified = false;
-  container.Map([&](Data& dat) { modified |= Insert(std::move(dat)); });
-  return modified;
+  Vector<Data> batch;
+  unsigned long count = 0;
+  container.Map([&batch, &count](Data& dat) { PushBatch(batch, count, std::move(dat)); });
+  return (InsertBatch(batch, count) == count);
+}
+
+template <typename Data>
+template <ForeignInputRange<Data> Range>
+bool SetVec<Data>::InsertAll(Range&& range) {
+  Vector<Data> batch;
+  unsigned long count = 0;
+  for (auto&& dat : range) {
+    PushBatch(batch, count, std::forward<decltype(dat)>(dat));
+  }
+  return (InsertBatch(batch, count) == count);
+}
+
+template <typename Data>
+unsigned long SetVec<Data>::RemoveBatch(Vector<Data>& batch, unsigned long count) {
+  unsigned long removed = 0;
+
+  if (count < BulkThreshold) {
+    for (unsigned long j = 0; j < count; ++j) {
+      removed += Remove(batch[j]);
+    }
+    return removed;
+  }
+
+  Data* probes = batch.begin();
+  std::sort(probes, probes + count);
+  unsigned long unique = std::unique(probes, probes + count) - probes;
+
+  // Merge against the sorted probes, compacting the survivors towards the head
+  unsigned long j = 0;
+  unsigned long w = 0;
+  unsigned long moved = size; // First index written by the compaction
+  for (unsigned long i = 0; i < size; ++i) {
+    Data& curr = elements[CircularIndex(i)];
+    while (j < unique && probes[j] < curr) ++j;
+    if (j < unique && !(curr < probes[j])) {
+      ++j;
+      ++removed;
+    } else {
+      if (w != i) {
+        elements[CircularIndex(w)] = std::move(curr);
+        if (moved == size) moved = w;
+      }
+      ++w;
+    }
+    if (j == unique && w == i + 1) break; // Nothing left to remove or to shift
+  }
+
+  if (removed > 0) {
+    indexValid = false;
+    size -= removed;
+    tail = (head + size) & (capacity - 1);
+    Touch(moved, size);
+
+    Shrink(); // Once, to the capacity the single removals would have reached
+  }
+  return removed;
 }
 
 template <typename Data>
 bool SetVec<Data>::RemoveAll(const TraversableContainer<Data>& container) {
-  bool modified = false;
-  container.Traverse([&](const Data& dat) { modified |= Remove(dat); });
-  return modified;
+  Vector<Data> batch;
+  unsigned long count = 0;
+  container.Traverse([&batch, &count](const Data& dat) { PushBatch(batch, count, dat); });
+  return (RemoveBatch(batch, count) == count);
 }
 
 template <typename Data>
 bool SetVec<Data>::InsertSome(const TraversableContainer<Data>& container) {
-  bool modified = false;
-  container.Traverse([&](const Data& dat) {
-    if (!modified && Insert(dat)) modified = true;
-  });
-  return modified;
+  Vector<Data> batch;
+  unsigned long count = 0;
+  container.Traverse([&batch, &count](const Data& dat) { PushBatch(batch, count, dat); });
+  return (InsertBatch(batch, count) > 0);
 }
 
 template <typename Data>
 bool SetVec<Data>::InsertSome(MappableContainer<Data>&& container) {
-  bool modified = false;
-  container.Map([&](Data& dat) {
-    if (!modified && Insert(std::move(dat))) modified = true;
-  });
-  return modified;
+  Vector<Data> batch;
+  unsigned long count = 0;
+  container.Map([&batch, &count](Data& dat) { PushBatch(batch, count, std::move(dat)); });
+  return (InsertBatch(batch, count) > 0);
+}
+
+template <typename Data>
+template <ForeignInputRange<Data> Range>
+bool SetVec<Data>::InsertSome(Range&& range) {
+  Vector<Data> batch;
+  unsigned long count = 0;
+  for (auto&& dat : range) {
+    PushBatch(batch, count, std::forward<decltype(dat)>(dat));
+  }
+  return (InsertBatch(batch, count) > 0);
 }
 
 template <typename Data>
 bool SetVec<Data>::RemoveSome(const TraversableContainer<Data>& container) {
-  bool modified = false;
-  container.Traverse([&](const Data& dat) {
-    if (!modified && Remove(dat)) modified = true;
-  });
-  return modified;
+  Vector<Data> batch;
+  unsigned long count = 0;
+  container.Traverse([&batch, &count](const Data& dat) { PushBatch(batch, count, dat); });
+  return (RemoveBatch(batch, count) > 0);
+}
+
+/* ************************************************************************** */
+/* Search index */
+
+template <typename Data>
+void SetVec<Data>::EnableSearchIndex(bool enable) {
+  indexEnabled = enable;
+  if (!enable) ReleaseIndex();
+}
+
+template <typename Data>
+void SetVec<Data>::ReleaseIndex() const noexcept {
+  delete[] indexKeys;
+  delete[] indexRanks;
+  indexKeys = nullptr;
+  indexRanks = nullptr;
+  indexValid = false;
+}
+
+template <typename Data>
+void SetVec<Data>::BuildIndex(unsigned long node, unsigned long& rank) const {
+  // An in-order visit of the implicit tree lays the sorted keys out in BFS order
+  if (node > size) return;
+  BuildIndex(2 * node, rank);
+  indexKeys[node] = elements[CircularIndex(rank)];
+  indexRanks[node] = rank++;
+  BuildIndex(2 * node + 1, rank);
+}
+
+template <typename Data>
+bool SetVec<Data>::EnsureIndex() const noexcept {
+  if (!indexEnabled || size == 0) return false;
+  if (indexValid) return true;
+
+  ReleaseIndex();
+  try {
+    indexKeys = new Data[size + 1];
+    indexRanks = new unsigned long[size + 1];
+    unsigned long rank = 0;
+    BuildIndex(1, rank);
+  } catch (...) {
+    ReleaseIndex(); // Fall back to the plain search
+    return false;
+  }
+  indexValid = true;
+  return true;
+}
+
+template <typename Data>
+template <bool Right>
+unsigned long SetVec<Data>::IndexDescent(const Data& dat) const {
+  // Branchless descent: turn right while the key is below the value (or not above it, for Right)
+  unsigned long node = 1;
+  while (node <= size) {
+#ifdef __GNUC__
+    if (IndexPrefetch * node <= size) __builtin_prefetch(indexKeys + IndexPrefetch * node);
+#endif
+    if constexpr (Right) node = 2 * node + !(dat < indexKeys[node]);
+    else node = 2 * node + (indexKeys[node] < dat);
+  }
+  return node;
+}
+
+template <typename Data>
+unsigned long SetVec<Data>::IndexLowerNode(const Data& dat) const {
+  unsigned long node = IndexDescent<false>(dat);
+  return node >> (std::countr_one(node) + 1); // Last left turn: first key not below the value
+}
+
+template <typename Data>
+unsigned long SetVec<Data>::IndexUpperNode(const Data& dat) const {
+  unsigned long node = IndexDescent<true>(dat);
+  return node >> (std::countr_one(node) + 1); // Last left turn: first key above the value
+}
+
+template <typename Data>
+unsigned long SetVec<Data>::IndexPredecessorNode(const Data& dat) const {
+  unsigned long node = IndexDescent<false>(dat);
+  return node >> (std::countr_zero(node) + 1); // Last right turn: last key below the value
+}
+
+template <typename Data>
+unsigned long SetVec<Data>::QueryLowerIndex(const Data& dat) const {
+  if (!EnsureIndex()) return LowerIndex(dat);
+  unsigned long node = IndexLowerNode(dat);
+  return (node == 0) ? size : indexRanks[node];
+}
+
+/* ************************************************************************** */
+/* Set algebra */
+
+template <typename Data>
+unsigned long SetVec<Data>::FirstSegment() const noexcept {
+  return CircularFirstSegment(head, size, capacity);
+}
+
+template <typename Data>
+unsigned long SetVec<Data>::GallopIndex(const Data& dat, unsigned long from) const {
+  // Exponential steps from 'from', then binary search inside the last step
+  unsigned long lo = from;
+  unsigned long bound = from;
+  unsigned long step = 1;
+  while (bound < size && elements[CircularIndex(bound)] < dat) {
+    lo = bound + 1;
+    bound += step;
+    step *= 2;
+  }
+  unsigned long hi = (bound < size) ? bound : size;
+  while (lo < hi) {
+    unsigned long mid = lo + (hi - lo) / 2;
+    if (elements[CircularIndex(mid)] < dat) lo = mid + 1;
+    else hi = mid;
+  }
+  return lo;
+}
+
+template <typename Data>
+SetVec<Data> SetVec<Data>::Merge(const SetVec& other, bool onlyHere, bool both, bool onlyOther) const {
+  SetVec result;
+  unsigned long bound = size + other.size;
+  if (bound == 0) return result;
+
+  unsigned long cap = std::bit_ceil(bound);
+  Data* merged = new Data[cap];
+  unsigned long i = 0;
+  unsigned long j = 0;
+  unsigned long k = 0;
+  while (i < size && j < other.size) {
+    const Data& mine = elements[CircularIndex(i)];
+    const Data& theirs = other.elements[other.CircularIndex(j)];
+    if (mine < theirs) {
+      if (onlyHere) merged[k++] = mine;
+      ++i;
+    } else if (theirs < mine) {
+      if (onlyOther) merged[k++] = theirs;
+      ++j;
+    } else {
+      if (both) merged[k++] = mine;
+      ++i;
+      ++j;
+    }
+  }
+  for (; onlyHere && i < size; ++i) merged[k++] = elements[CircularIndex(i)];
+  for (; onlyOther && j < other.size; ++j) merged[k++] = other.elements[other.CircularIndex(j)];
+
+  result.elements = merged;
+  result.capacity = cap;
+  result.size = k;
+  result.tail = k & (cap - 1);
+  return result;
+}
+
+template <typename Data>
+unsigned long SetVec<Data>::IntersectRuns(const Data* a, unsigned long na, const Data* b, unsigned long nb, Data* out) {
+  unsigned long count = 0;
+  unsigned long i = 0;
+  unsigned long j = 0;
+
+#ifdef __SSE2__
+  if constexpr (std::is_same_v<Data, int>) {
+    // Compare 4 x 4 blocks against all rotations, then drop the block with the smaller maximum
+    while (i + 4 <= na && j + 4 <= nb) {
+      __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+      __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + j));
+      __m128i eq = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi32(va, vb),
+                     _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(0, 3, 2, 1)))),
+        _mm_or_si128(_mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(1, 0, 3, 2))),
+                     _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(2, 1, 0, 3)))));
+      int mask = _mm_movemask_ps(_mm_castsi128_ps(eq));
+      for (int l = 0; mask != 0; ++l, mask >>= 1) {
+        if (mask & 1) out[count++] = a[i + l];
+      }
+      int maxA = a[i + 3];
+      int maxB = b[j + 3];
+      if (maxA <= maxB) i += 4;
+      if (maxB <= maxA) j += 4;
+    }
+  }
+#endif
+
+  while (i < na && j < nb) {
+    if (a[i] < b[j]) {
+      ++i;
+    } else if (b[j] < a[i]) {
+      ++j;
+    } else {
+      out[count++] = a[i];
+      ++i;
+      ++j;
+    }
+  }
+  return count;
+}
+
+template <typename Data>
+SetVec<Data> SetVec<Data>::Union(const SetVec& other) const {
+  return Merge(other, true, true, true);
 }
 
+template <typename Data>
+SetVec<Data> SetVec<Data>::Intersection(const SetVec& other) const {
+  const SetVec& small = (size <= other.size) ? *this : other;
+  const SetVec& large = (size <= other.size) ? other : *this;
+  SetVec result;
+  if (small.size == 0) return result;
+
+  result.capacity = std::bit_ceil(small.size);
+  result.elements = new Data[result.capacity];
+  unsigned long count = 0;
+  if (large.size / GallopRatio >= small.size) {
+    unsigned long pos = 0;
+    for (unsigned long i = 0; i < small.size && pos < large.size; ++i) {
+      const Data& dat = small.elements[small.CircularIndex(i)];
+      pos = large.GallopIndex(dat, pos);
+      if (pos < large.size && !(dat < large.elements[large.CircularIndex(pos)])) {
+        result.elements[count++] = dat;
+      }
+    }
+  } else {
+    // Each buffer holds at most two sorted runs: intersecting them pairwise keeps the output sorted
+    const Data* runsA[2] = {elements + head, elements};
+    unsigned long lensA[2] = {FirstSegment(), size - FirstSegment()};
+    const Data* runsB[2] = {other.elements + other.head, other.elements};
+    unsigned long lensB[2] = {other.FirstSegment(), other.size - other.FirstSegment()};
+    for (unsigned long a = 0; a < 2; ++a) {
+      for (unsigned long b = 0; b < 2; ++b) {
+        count += IntersectRuns(runsA[a], lensA[a], runsB[b], lensB[b], result.elements + count);
+      }
+    }
+  }
+
+  result.size = count;
+  result.tail = count & (result.capacity - 1);
+  return result;
+}
+
+template <typename Data>
+SetVec<Data> SetVec<Data>::Difference(const SetVec& other) const {
+  if (size / GallopRatio < other.size || other.size == 0) {
+    return Merge(other, true, false, false);
+  }
+
+  // Few values to take out: copy the runs between them
+  SetVec result;
+  result.capacity = std::bit_ceil(size);
+  result.elements = new Data[result.capacity];
+  unsigned long count = 0;
+  unsigned long i = 0;
+  for (unsigned long j = 0; j < other.size; ++j) {
+    const Data& dat = other.elements[other.CircularIndex(j)];
+    unsigned long pos = GallopIndex(dat, i);
+    for (; i < pos; ++i) result.elements[count++] = elements[CircularIndex(i)];
+    if (i < size && !(dat < elements[CircularIndex(i)])) ++i;
+  }
+  for (; i < size; ++i) result.elements[count++] = elements[CircularIndex(i)];
+
+  result.size = count;
+  result.tail = count & (result.capacity - 1);
+  return result;
+}
+
+template <typename Data>
+SetVec<Data> SetVec<Data>::SymmetricDifference(const SetVec& other) const {
+  return Merge(other, true, false, true);
+}
+
+/* ************************************************************************** */
+
 template <typename Data>
 long SetVec<Data>::BinarySearch(const Data& dat) const {
-  if (size == 0) return -1;
+  unsigned long index = LowerIndex(dat);
+  return (index < size && elements[CircularIndex(index)] == dat) ? static_cast<long>(index) : -1;
+}
+
+template <typename Data>
+unsigned long SetVec<Data>::LowerIndex(const Data& dat) const {
+  return CircularLowerIndex(elements, head, size, capacity, dat);
+}
+
+template <typename Data>
+unsigned long SetVec<Data>::UpperIndex(const Data& dat) const {
+  return CircularUpperIndex(elements, head, size, capacity, dat);
+}
+
+template <typename Data>
+void SetVec<Data>::Shrink() {
+  unsigned long newCap = capacity;
+  while (size < newCap / 4 && newCap > 1) newCap /= 2;
+  if (newCap != capacity) Resize(newCap);
+}
+
+template <typename Data>
+void SetVec<Data>::Touch(unsigned long first, unsigned long end) noexcept {
+  if (snapshots == nullptr || first >= end) return;
+  // The indices map to one run of slots, or two when they wrap around
+  const unsigned long slot = CircularIndex(first);
+  const unsigned long count = end - first;
+  if (slot + count <= capacity) {
+    snapshots->Touch(slot, slot + count);
+  } else {
+    snapshots->Touch(slot, capacity);
+    snapshots->Touch(0, slot + count - capacity);
+  }
+}
 
-  long left = 0;
-  long right = size - 1;
+/* ************************************************************************** */
+/* Batched lookup */
+
+template <typename Data>
+unsigned long SetVec<Data>::ExistsBatch(const TraversableContainer<Data>& probes, Vector<bool>& found) const {
+  found.Resize(probes.Size());
+  Data group[ProbeGroup];
+  unsigned long filled = 0;
+  unsigned long index = 0;
+  unsigned long hits = 0;
+  probes.Traverse([&](const Data& dat) {
+    group[filled++] = dat;
+    if (filled == ProbeGroup) {
+      hits += SearchGroup(group, filled, found, index);
+      index += filled;
+      filled = 0;
+    }
+  });
+  if (filled > 0) hits += SearchGroup(group, filled, found, index);
+  return hits;
+}
 
-  while (left <= right) {
-    long mid = (left + right) / 2;
-    const Data& midVal = elements[CircularIndex(mid)];
+template <typename Data>
+unsigned long SetVec<Data>::SearchGroup(const Data* group, unsigned long count, Vector<bool>& found, unsigned long offset) const {
+  if (size == 0) {
+    for (unsigned long j = 0; j < count; ++j) found[offset + j] = false;
+    return 0;
+  }
 
-    if (midVal == dat)
-      return mid;
-    else if (midVal < dat)
-      left = mid + 1;
-    else
-      right = mid - 1;
+  // Branchless lower bound: the window shrinks the same way for every probe,
+  // so one level is done for the whole group before the next one starts
+  unsigned long base[ProbeGroup] = {};
+  for (unsigned long length = size; length > 1; ) {
+    const unsigned long half = length / 2;
+    const unsigned long next = (length - half) / 2;
+    for (unsigned long j = 0; j < count; ++j) {
+      base[j] += (elements[CircularIndex(base[j] + half)] < group[j]) ? half : 0;
+#ifdef __GNUC__
+      __builtin_prefetch(elements + CircularIndex(base[j] + next));
+#endif
+    }
+    length -= half;
+  }
+
+  unsigned long hits = 0;
+  for (unsigned long j = 0; j < count; ++j) {
+    const unsigned long index = base[j] + (elements[CircularIndex(base[j])] < group[j]);
+    const bool hit = index < size && elements[CircularIndex(index)] == group[j];
+    found[offset + j] = hit;
+    hits += hit;
   }
+  return hits;
+}
 
-  return -1;
+/* ************************************************************************** */
+/* Snapshot */
+
+template <typename Data>
+SnapshotView<Data> SetVec<Data>::Snapshot() const {
+  if (snapshots == nullptr) snapshots = new SnapshotCache<Data>();
+  return snapshots->Take(elements, capacity, head, size, true);
 }
 
 } // namespace lasd
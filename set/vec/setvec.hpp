@@ -5,6 +5,9 @@
 
 #include "../set.hpp"
 #include "../../vector/vector.hpp"
+#include "circular.hpp"
+#include <compare>
+#include <iterator>
 #include <stdexcept>
 
 /* ************************************************************************** */
@@ -27,6 +30,15 @@ private:
   unsigned long tail = 0;           // Index of insertion point (after last)
   unsigned long capacity = 0;       // Allocated capacity
 
+  // Optional read-optimized search index (Eytzinger layout), rebuilt lazily by const queries
+  bool indexEnabled = false;
+  mutable bool indexValid = false;
+  mutable Data* indexKeys = nullptr;           // Keys in BFS order, 1-based
+  mutable unsigned long* indexRanks = nullptr; // Logical index of each key
+
+  // Chunks shared with the snapshots handed out so far, created by the first Snapshot()
+  mutable SnapshotCache<Data>* snapshots = nullptr;
+
 protected:
 
   using Container::size;
@@ -38,7 +50,46 @@ protected:
   void InsertAt(unsigned long, const Data&);
   void InsertAt(unsigned long, Data&&);
   void RemoveAt(unsigned long);
+  void OpenGap(unsigned long); // Makes room at the given index, shifting the shorter side
   long BinarySearch(const Data&) const;
+  unsigned long LowerIndex(const Data&) const; // First index whose value is not below the given one
+  unsigned long UpperIndex(const Data&) const; // First index whose value is above the given one
+  void Shrink(); // Halves the capacity while at most a quarter of it is used
+  void Touch(unsigned long, unsigned long) noexcept; // Marks the indices in [first, end) as written since the last snapshot
+
+  // Bulk insertion: batches at least this large are sorted and merged in one pass
+  static constexpr unsigned long BulkThreshold = 16;
+
+  template <typename Value>
+  static void PushBatch(Vector<Data>&, unsigned long&, Value&&);
+  unsigned long InsertBatch(Vector<Data>&, unsigned long); // Returns how many values were new
+  unsigned long RemoveBatch(Vector<Data>&, unsigned long); // Returns how many values were removed
+
+  // Set algebra: sizes this far apart switch from merging to galloping search
+  static constexpr unsigned long GallopRatio = 32;
+
+  unsigned long FirstSegment() const noexcept; // Length of the run from head to the end of the buffer
+  unsigned long GallopIndex(const Data&, unsigned long) const; // First index not below the value, from the given one
+  SetVec Merge(const SetVec&, bool, bool, bool) const; // Keeps values only here / in both / only in the other
+  static unsigned long IntersectRuns(const Data*, unsigned long, const Data*, unsigned long, Data*);
+
+  // Search index: descendants this many times deeper sit in one contiguous block, prefetched ahead
+  static constexpr unsigned long IndexPrefetch = 16;
+
+  bool EnsureIndex() const noexcept; // Rebuilds if stale; false if it cannot be used
+  void BuildIndex(unsigned long, unsigned long&) const;
+  void ReleaseIndex() const noexcept;
+  template <bool Right>
+  unsigned long IndexDescent(const Data&) const;
+  unsigned long IndexLowerNode(const Data&) const;       // 0 if every key is below the value
+  unsigned long IndexUpperNode(const Data&) const;       // 0 if no key is above the value
+  unsigned long IndexPredecessorNode(const Data&) const; // 0 if no key is below the value
+  unsigned long QueryLowerIndex(const Data&) const;      // LowerIndex through the search index, if enabled
+
+  // Batched lookup: this many binary searches advance in lockstep, each prefetching its next probe
+  static constexpr unsigned long ProbeGroup = 8;
+
+  unsigned long SearchGroup(const Data*, unsigned long, Vector<bool>&, unsigned long) const; // Returns the hits
 
 public:
 
@@ -46,6 +97,55 @@ public:
   using LinearContainer<Data>::operator==;
   using LinearContainer<Data>::operator!=;
 
+  /* ************************************************************************ */
+
+  // Random-access iterator over the circular buffer (read-only: elements must stay ordered)
+  class ConstIterator {
+
+  private:
+
+    const SetVec* set = nullptr;
+    unsigned long index = 0; // Logical position (0 is the minimum)
+
+  public:
+
+    using iterator_concept = std::random_access_iterator_tag;
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = Data;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Data*;
+    using reference = const Data&;
+
+    ConstIterator() = default;
+    ConstIterator(const SetVec* st, unsigned long idx) noexcept : set(st), index(idx) {}
+
+    reference operator*() const noexcept { return set->elements[set->CircularIndex(index)]; }
+    pointer operator->() const noexcept { return &**this; }
+    reference operator[](difference_type off) const noexcept { return *(*this + off); }
+
+    ConstIterator& operator++() noexcept { ++index; return *this; }
+    ConstIterator operator++(int) noexcept { ConstIterator tmp = *this; ++index; return tmp; }
+    ConstIterator& operator--() noexcept { --index; return *this; }
+    ConstIterator operator--(int) noexcept { ConstIterator tmp = *this; --index; return tmp; }
+
+    ConstIterator& operator+=(difference_type off) noexcept { index += off; return *this; }
+    ConstIterator& operator-=(difference_type off) noexcept { index -= off; return *this; }
+
+    friend ConstIterator operator+(ConstIterator it, difference_type off) noexcept { return it += off; }
+    friend ConstIterator operator+(difference_type off, ConstIterator it) noexcept { return it += off; }
+    friend ConstIterator operator-(ConstIterator it, difference_type off) noexcept { return it -= off; }
+    friend difference_type operator-(const ConstIterator& it1, const ConstIterator& it2) noexcept {
+      return static_cast<difference_type>(it1.index) - static_cast<difference_type>(it2.index);
+    }
+
+    friend bool operator==(const ConstIterator& it1, const ConstIterator& it2) noexcept { return it1.index == it2.index; }
+    friend std::strong_ordering operator<=>(const ConstIterator& it1, const ConstIterator& it2) noexcept { return it1.index <=> it2.index; }
+
+  };
+
+  using const_iterator = ConstIterator;
+  using iterator = ConstIterator;
+
   // Default constructor
   SetVec() = default;
 
@@ -53,6 +153,9 @@ public:
   SetVec(const TraversableContainer<Data>&); // Copy from TraversableContainer
   SetVec(MappableContainer<Data>&&);         // Move from MappableContainer
 
+  template <ForeignInputRange<Data> Range>
+  SetVec(Range&&);                           // Copy (or move, for prvalue elements) from any input range
+
   // Copy constructor
   SetVec(const SetVec&);
 
@@ -89,6 +192,19 @@ public:
   Data SuccessorNRemove(const Data&) override;
   void RemoveSuccessor(const Data&) override;
 
+  using typename OrderedDictionaryContainer<Data>::RangeFun;
+  const Data& LowerBound(const Data&) const override;
+  const Data& UpperBound(const Data&) const override;
+  void RangeTraverse(const Data&, const Data&, RangeFun) const override;
+  unsigned long RangeCount(const Data&, const Data&) const override;
+  unsigned long RangeRemove(const Data&, const Data&) override;
+
+  // TraversableContainer functions (native loops over the two runs of the buffer)
+  using typename TraversableContainer<Data>::TraverseFun;
+  void Traverse(TraverseFun) const override;
+  void PreOrderTraverse(TraverseFun) const override;
+  void PostOrderTraverse(TraverseFun) const override;
+
   // Dictionary functions
   bool Insert(const Data&) override;    // Copy
   bool Insert(Data&&) override;         // Move
@@ -104,12 +220,39 @@ public:
 
   bool RemoveSome(const TraversableContainer<Data>&) override;
 
+  template <ForeignInputRange<Data> Range>
+  bool InsertAll(Range&&);
+  template <ForeignInputRange<Data> Range>
+  bool InsertSome(Range&&);
+
+  // Read-optimized mode: Exists, Predecessor, Successor and the range queries search a
+  // cache-friendly copy of the keys, rebuilt on first use after each modification.
+  // Lookups then return references into that copy, valid until the next modification.
+  // Not safe for concurrent readers, since the first query after a change rebuilds it.
+  void EnableSearchIndex(bool = true);
+  bool SearchIndexEnabled() const noexcept { return indexEnabled; }
+
+  // Set algebra (linear-time sorted merge)
+  SetVec Union(const SetVec&) const;
+  SetVec Intersection(const SetVec&) const;
+  SetVec Difference(const SetVec&) const;          // Values here but not in the other
+  SetVec SymmetricDifference(const SetVec&) const;
+
   // LinearContainer functions
   const Data& operator[](unsigned long) const override;
 
+  // Immutable, sorted view of the current values. It costs one pointer per
+  // chunk plus a copy of the chunks written since the previous snapshot; the
+  // others are shared with it. Call it from the writer (the view itself may
+  // be read from any thread).
+  SnapshotView<Data> Snapshot() const;
+
   // TestableContainer function
   bool Exists(const Data&) const noexcept override;
 
+  // Set function: the misses of one search overlap with those of the others in its group
+  unsigned long ExistsBatch(const TraversableContainer<Data>&, Vector<bool>&) const override;
+
   // ClearableContainer function
   void Clear() override;
 
@@ -118,6 +261,12 @@ public:
   bool Empty() const noexcept override { return (size == 0); }
   unsigned long Size() const noexcept override { return size; }
 
+  // Iterators
+  const_iterator begin() const noexcept { return const_iterator(this, 0); }
+  const_iterator end() const noexcept { return const_iterator(this, size); }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
+
 };
 
 /* ************************************************************************** */
@@ -0,0 +1,189 @@
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+namespace lasd {
+
+/* ************************************************************************** */
+/* SnapshotView: copy and move */
+
+template <typename Data>
+SnapshotView<Data>::SnapshotView(const SnapshotView& other)
+    : table(other.table), head(other.head), sorted(other.sorted) {
+  size = other.size;
+}
+
+template <typename Data>
+SnapshotView<Data>::SnapshotView(SnapshotView&& other) noexcept {
+  std::swap(table, other.table);
+  std::swap(head, other.head);
+  std::swap(size, other.size);
+  std::swap(sorted, other.sorted);
+}
+
+template <typename Data>
+SnapshotView<Data>& SnapshotView<Data>::operator=(const SnapshotView& other) {
+  table = other.table;
+  head = other.head;
+  size = other.size;
+  sorted = other.sorted;
+  return *this;
+}
+
+template <typename Data>
+SnapshotView<Data>& SnapshotView<Data>::operator=(SnapshotView&& other) noexcept {
+  std::swap(table, other.table);
+  std::swap(head, other.head);
+  std::swap(size, other.size);
+  std::swap(sorted, other.sorted);
+  return *this;
+}
+
+/* ************************************************************************** */
+/* SnapshotView: access */
+
+template <typename Data>
+const Data& SnapshotView<Data>::operator[](unsigned long index) const {
+  if (index >= size) throw std::out_of_range("Access out of range");
+  return At(index);
+}
+
+template <typename Data>
+const Data& SnapshotView<Data>::At(unsigned long index) const noexcept {
+  unsigned long slot = head + index;
+  if (slot >= table->slots) slot -= table->slots;
+  return table->chunks[slot >> Table::ChunkShift][slot & (Table::ChunkSize - 1)];
+}
+
+/* ************************************************************************** */
+/* SnapshotView: traversals */
+
+template <typename Data>
+void SnapshotView<Data>::Traverse(TraverseFun fun) const {
+  PreOrderTraverse(fun);
+}
+
+template <typename Data>
+void SnapshotView<Data>::PreOrderTraverse(TraverseFun fun) const {
+  unsigned long slot = head;
+  for (unsigned long left = size; left > 0; ) {
+    if (slot == table->slots) slot = 0;
+    const Data* chunk = table->chunks[slot >> Table::ChunkShift].get();
+    const unsigned long offset = slot & (Table::ChunkSize - 1);
+    const unsigned long run = std::min({Table::ChunkSize - offset, table->slots - slot, left});
+    for (unsigned long k = 0; k < run; ++k) {
+      fun(chunk[offset + k]);
+    }
+    slot += run;
+    left -= run;
+  }
+}
+
+template <typename Data>
+void SnapshotView<Data>::PostOrderTraverse(TraverseFun fun) const {
+  if (size == 0) return;
+  unsigned long end = head + size; // Slot after the last value
+  if (end > table->slots) end -= table->slots;
+  for (unsigned long left = size; left > 0; ) {
+    if (end == 0) end = table->slots;
+    const unsigned long slot = end - 1;
+    const Data* chunk = table->chunks[slot >> Table::ChunkShift].get();
+    const unsigned long offset = slot & (Table::ChunkSize - 1);
+    const unsigned long run = std::min(offset + 1, left);
+    for (unsigned long k = 0; k < run; ++k) {
+      fun(chunk[offset - k]);
+    }
+    end -= run;
+    left -= run;
+  }
+}
+
+/* ************************************************************************** */
+/* SnapshotView: search */
+
+template <typename Data>
+bool SnapshotView<Data>::Exists(const Data& dat) const noexcept {
+  if constexpr (requires(const Data& a, const Data& b) { a < b; }) {
+    if (sorted) {
+      unsigned long lo = 0;
+      unsigned long hi = size;
+      while (lo < hi) {
+        unsigned long mid = lo + (hi - lo) / 2;
+        if (At(mid) < dat) lo = mid + 1;
+        else hi = mid;
+      }
+      return (lo < size && !(dat < At(lo)));
+    }
+  }
+  return TraversableContainer<Data>::Exists(dat);
+}
+
+/* ************************************************************************** */
+/* SnapshotCache */
+
+template <typename Data>
+void SnapshotCache<Data>::Touch(unsigned long slot) noexcept {
+  const unsigned long chunk = slot >> Table::ChunkShift;
+  if (last != nullptr && chunk < last->count) {
+    dirty[chunk >> 6] |= std::uint64_t(1) << (chunk & 63);
+  }
+}
+
+template <typename Data>
+void SnapshotCache<Data>::Touch(unsigned long first, unsigned long end) noexcept {
+  if (last == nullptr || last->count == 0 || first >= end) return;
+  const unsigned long stop = std::min((end - 1) >> Table::ChunkShift, last->count - 1);
+  for (unsigned long chunk = first >> Table::ChunkShift; chunk <= stop; ++chunk) {
+    dirty[chunk >> 6] |= std::uint64_t(1) << (chunk & 63);
+  }
+}
+
+template <typename Data>
+void SnapshotCache<Data>::Forget() noexcept {
+  last.reset();
+}
+
+template <typename Data>
+SnapshotView<Data> SnapshotCache<Data>::Take(const Data* values, unsigned long slots, unsigned long head, unsigned long size, bool sorted) {
+  std::shared_ptr<Table> table = std::make_shared<Table>();
+  table->slots = slots;
+  table->count = (slots + Table::ChunkSize - 1) >> Table::ChunkShift;
+  table->chunks = std::make_unique<std::shared_ptr<const Data[]>[]>(table->count);
+
+  const unsigned long end = head + size; // Past the slots when the values wrap around
+  for (unsigned long chunk = 0; chunk < table->count; ++chunk) {
+    const unsigned long first = chunk << Table::ChunkShift;
+    const unsigned long length = table->Length(chunk);
+    const bool live = (size > 0) && ((first < end && first + length > head) || (end > slots && first < end - slots));
+    if (!live) continue; // Any value written here later marks the chunk
+
+    if (last != nullptr && chunk < last->count && last->chunks[chunk] != nullptr && last->Length(chunk) == length
+        && (dirty[chunk >> 6] & (std::uint64_t(1) << (chunk & 63))) == 0) {
+      table->chunks[chunk] = last->chunks[chunk];
+    } else {
+      std::shared_ptr<Data[]> copy(new Data[length]);
+      std::copy(values + first, values + first + length, copy.get());
+      table->chunks[chunk] = std::move(copy);
+    }
+  }
+
+  const unsigned long needed = (table->count + 63) / 64;
+  if (needed > words) {
+    delete[] dirty;
+    dirty = new std::uint64_t[needed];
+    words = needed;
+  }
+  std::fill(dirty, dirty + words, 0);
+  last = table;
+
+  SnapshotView<Data> view;
+  view.table = std::move(table);
+  view.head = head;
+  view.size = size;
+  view.sorted = sorted;
+  return view;
+}
+
+/* ************************************************************************** */
+
+}
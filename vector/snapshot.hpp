@@ -0,0 +1,183 @@
+#ifndef SNAPSHOT_HPP
+#define SNAPSHOT_HPP
+
+/* ************************************************************************** */
+
+#include "../container/linear.hpp"
+#include <cstdint>
+#include <memory>
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// The values of one version, cut into fixed-size chunks of storage slots.
+// A chunk is shared by every version in which none of its slots changed.
+template <typename Data>
+struct SnapshotTable {
+
+  static constexpr unsigned int ChunkShift = 8;
+  static constexpr unsigned long ChunkSize = 1UL << ChunkShift;
+
+  unsigned long slots = 0;  // Storage slots covered (the capacity, for a circular buffer)
+  unsigned long count = 0;  // Chunks: the last one may be shorter
+  std::unique_ptr<std::shared_ptr<const Data[]>[]> chunks; // Null where no value was live
+
+  unsigned long Length(unsigned long chunk) const noexcept {
+    unsigned long first = chunk << ChunkShift;
+    return (slots - first < ChunkSize) ? slots - first : ChunkSize;
+  }
+
+};
+
+/* ************************************************************************** */
+
+// Immutable view of a Vector or a SetVec, as it was when Snapshot() was
+// called. Copies share the same chunks, and a chunk is freed together with
+// the last view that uses it. A view never reads its container again, so it
+// may be handed to other threads and read there while the writer goes on.
+template <typename Data>
+class SnapshotView : public virtual LinearContainer<Data> {
+  // Must extend LinearContainer<Data>
+
+private:
+
+  template <typename> friend class SnapshotCache;
+
+  using Table = SnapshotTable<Data>;
+
+  std::shared_ptr<const Table> table;
+  unsigned long head = 0;   // Slot of the first value; the values wrap around the table
+  bool sorted = false;
+
+protected:
+
+  using Container::size;
+
+public:
+
+  // Default constructor
+  SnapshotView() = default;
+
+  /* ************************************************************************ */
+
+  // Copy constructor (shares the chunks)
+  SnapshotView(const SnapshotView&);
+
+  // Move constructor
+  SnapshotView(SnapshotView&&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Destructor
+  virtual ~SnapshotView() = default;
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  SnapshotView& operator=(const SnapshotView&);
+
+  // Move assignment
+  SnapshotView& operator=(SnapshotView&&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from LinearContainer)
+
+  const Data& operator[](unsigned long) const override; // (throws std::out_of_range)
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from TraversableContainer)
+
+  using typename TraversableContainer<Data>::TraverseFun;
+
+  void Traverse(TraverseFun) const override;
+  void PreOrderTraverse(TraverseFun) const override;
+  void PostOrderTraverse(TraverseFun) const override; // Chunk by chunk
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from TestableContainer)
+
+  bool Exists(const Data&) const noexcept override; // Binary search, for a view of a set
+
+  /* ************************************************************************ */
+
+  // Specific member function
+
+  bool Sorted() const noexcept { return sorted; }
+
+protected:
+
+  // Auxiliary functions, if necessary!
+
+  const Data& At(unsigned long) const noexcept;
+
+};
+
+/* ************************************************************************** */
+
+// Writer-side state of a container that hands out snapshots: the table of
+// the latest one, and one bit per chunk written since. The container marks
+// every slot it writes; a new snapshot copies the marked chunks and shares
+// the rest. Not thread-safe: it belongs to the writer.
+template <typename Data>
+class SnapshotCache {
+
+private:
+
+  using Table = SnapshotTable<Data>;
+
+  std::shared_ptr<const Table> last;
+  std::uint64_t* dirty = nullptr; // One bit per chunk of the last table
+  unsigned long words = 0;
+
+public:
+
+  // Default constructor
+  SnapshotCache() = default;
+
+  /* ************************************************************************ */
+
+  // Copy constructor
+  SnapshotCache(const SnapshotCache&) = delete;
+
+  // Move constructor
+  SnapshotCache(SnapshotCache&&) = delete;
+
+  /* ************************************************************************ */
+
+  // Destructor
+  ~SnapshotCache() { delete[] dirty; }
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  SnapshotCache& operator=(const SnapshotCache&) = delete;
+
+  // Move assignment
+  SnapshotCache& operator=(SnapshotCache&&) = delete;
+
+  /* ************************************************************************ */
+
+  // Specific member functions
+
+  void Touch(unsigned long) noexcept;                // The slot was written
+  void Touch(unsigned long, unsigned long) noexcept; // The slots in [first, last) were written
+  void Forget() noexcept;                            // The values moved to other slots: share nothing
+
+  // Slots, their count, the slot of the first value and how many values follow it (wrapping around)
+  SnapshotView<Data> Take(const Data*, unsigned long, unsigned long, unsigned long, bool);
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "snapshot.cpp"
+
+#endif
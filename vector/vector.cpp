@@ -31,6 +31,28 @@ namespace lasd {
     });
   }
   
+  template <typename Data>
+  template <ForeignInputRange<Data> Range>
+  Vector<Data>::Vector(Range&& range) {
+    if constexpr (std::ranges::sized_range<Range>) {
+      size = std::ranges::size(range);
+      elements_ = new Data[size];
+      ulong i = 0;
+      for (auto&& dat : range)
+        elements_[i++] = std::forward<decltype(dat)>(dat);
+    } else {
+      // Single-pass range of unknown length: grow geometrically, then trim
+      ulong count = 0;
+      for (auto&& dat : range) {
+        if (count == size)
+          Resize(size == 0 ? 1 : size * 2);
+        elements_[count++] = std::forward<decltype(dat)>(dat);
+      }
+      if (count != size)
+        Resize(count);
+    }
+  }
+  
   template <typename Data>
   Vector<Data>::Vector(const Vector& vec) {
     size = vec.size;
@@ -43,11 +65,13 @@ namespace lasd {
   Vector<Data>::Vector(Vector&& vec) noexcept {
     std::swap(elements_, vec.elements_);
     std::swap(size, vec.size);
+    std::swap(snapshots_, vec.snapshots_);
   }
   
   template <typename Data>
   Vector<Data>::~Vector() {
     delete[] elements_;
+    delete snapshots_;
   }
   
   /* ************************************************************************** */
@@ -66,6 +90,7 @@ namespace lasd {
   Vector<Data>& Vector<Data>::operator=(Vector&& vec) noexcept {
     std::swap(elements_, vec.elements_);
     std::swap(size, vec.size);
+    std::swap(snapshots_, vec.snapshots_);
     return *this;
   }
   
@@ -97,6 +122,7 @@ namespace lasd {
   template <typename Data>
   Data& Vector<Data>::operator[](const ulong index) {
     if (index >= size) throw std::out_of_range("Access out of range");
+    Touch(index);
     return elements_[index];
   }
   
@@ -109,6 +135,7 @@ namespace lasd {
   template <typename Data>
   Data& Vector<Data>::Front() {
     if (size == 0) throw std::length_error("Vector is empty");
+    Touch(0);
     return elements_[0];
   }
   
@@ -121,6 +148,7 @@ namespace lasd {
   template <typename Data>
   Data& Vector<Data>::Back() {
     if (size == 0) throw std::length_error("Vector is empty");
+    Touch(size - 1);
     return elements_[size - 1];
   }
   
@@ -137,7 +165,7 @@ namespace lasd {
   template <typename Data>
   void Vector<Data>::Resize(const ulong newsize) {
     if (newsize == 0) {
-      Clear();
+      Vector<Data>::Clear(); // Resize(0) releases Vector's own storage, whatever a subclass adds to Clear
     } else {
       Data* tmp = new Data[newsize]();
       ulong min = (newsize < size) ? newsize : size;
@@ -146,14 +174,25 @@ namespace lasd {
       delete[] elements_;
       elements_ = tmp;
       size = newsize;
+      Touch(min, newsize); // Fresh values past the old end
     }
   }
   
+  /* ************************************************************************** */
+  /* Snapshot */
+  
+  template <typename Data>
+  SnapshotView<Data> Vector<Data>::Snapshot() const {
+    if (snapshots_ == nullptr) snapshots_ = new SnapshotCache<Data>();
+    return snapshots_->Take(elements_, size, 0, size, false);
+  }
+  
   /* ************************************************************************** */
   /* Mappable */
   
   template <typename Data>
   void Vector<Data>::Map(typename MappableContainer<Data>::MapFun fun) {
+    TouchAll();
     for (ulong i = 0; i < size; ++i)
       fun(elements_[i]);
   }
@@ -165,6 +204,7 @@ namespace lasd {
   
   template <typename Data>
   void Vector<Data>::PostOrderMap(typename MappableContainer<Data>::MapFun fun) {
+    TouchAll();
     for (long i = size - 1; i >= 0; --i)
       fun(elements_[i]);
   }
@@ -198,6 +238,7 @@ namespace lasd {
     for (unsigned long i = size - 1; i > index; --i) {
       elements_[i] = std::move(elements_[i - 1]);
     }
+    Touch(index, size);
     elements_[index] = dat;
   }
   
@@ -208,6 +249,7 @@ namespace lasd {
     for (unsigned long i = size - 1; i > index; --i) {
       elements_[i] = std::move(elements_[i - 1]);
     }
+    Touch(index, size);
     elements_[index] = std::move(dat);
   }  
 
@@ -226,6 +268,11 @@ namespace lasd {
   SortableVector<Data>::SortableVector(MappableContainer<Data>&& container)
       : Vector<Data>(std::move(container)) {}
   
+  template <typename Data>
+  template <ForeignInputRange<Data> Range>
+  SortableVector<Data>::SortableVector(Range&& range)
+      : Vector<Data>(std::forward<Range>(range)) {}
+  
   template <typename Data>
   SortableVector<Data>::SortableVector(const SortableVector& vec)
       : Vector<Data>(vec) {}
@@ -248,15 +295,18 @@ namespace lasd {
   
   template <typename Data>
   void lasd::SortableVector<Data>::Sort() {
-    for (unsigned long i = 1; i < this->Size(); ++i) {
-      Data temp = std::move((*this)[i]);
+    // On the buffer, marking every chunk once: the mutable operator[] would mark one per access
+    this->TouchAll();
+    Data* elements = this->elements_;
+    for (unsigned long i = 1; i < this->size; ++i) {
+      Data temp = std::move(elements[i]);
       long j = i - 1;
 
-      while (j >= 0 && temp < (*this)[j]) {
-        (*this)[j + 1] = std::move((*this)[j]);
+      while (j >= 0 && temp < elements[j]) {
+        elements[j + 1] = std::move(elements[j]);
         --j;
       }
-      (*this)[j + 1] = std::move(temp);
+      elements[j + 1] = std::move(temp);
     }
   }
   
@@ -4,6 +4,7 @@
 /* ************************************************************************** */
 
 #include "../container/linear.hpp"
+#include "snapshot.hpp"
 
 /* ************************************************************************** */
 
@@ -19,6 +20,7 @@ protected:
 
   using Container::size;
   Data* elements_ = nullptr;
+  mutable SnapshotCache<Data>* snapshots_ = nullptr; // Created by the first Snapshot()
 
 public:
     
@@ -39,6 +41,9 @@ public:
   Vector(const TraversableContainer<Data>&);
   Vector(MappableContainer<Data>&&);
 
+  template <ForeignInputRange<Data> Range>
+  Vector(Range&&); // Copy (or move, for prvalue elements) from any input range
+
   // Copy constructor
   Vector(const Vector&);
 
@@ -78,7 +83,7 @@ public:
 
   // Specific member functions
   const Data& operator[](unsigned long) const override;
-  Data& operator[](unsigned long) override;
+  Data& operator[](unsigned long) override; // Marks its chunk as written (reads too): read through const access on hot paths
 
   const Data& Front() const override;
   Data& Front() override;
@@ -91,12 +96,36 @@ public:
   void Clear() override;
   void Resize(ulong);
 
+  /* ************************************************************************ */
+
+  // Immutable view of the current values. Only the chunks written since the
+  // previous snapshot are copied; the others are shared with it.
+  SnapshotView<Data> Snapshot() const;
+
+  /* ************************************************************************ */
+
+  // Iterators (contiguous: plain pointers into the storage; the mutable ones mark every chunk as written)
+  using iterator = Data*;
+  using const_iterator = const Data*;
+
+  iterator begin() noexcept { TouchAll(); return elements_; }
+  iterator end() noexcept { TouchAll(); return elements_ + size; }
+  const_iterator begin() const noexcept { return elements_; }
+  const_iterator end() const noexcept { return elements_ + size; }
+  const_iterator cbegin() const noexcept { return elements_; }
+  const_iterator cend() const noexcept { return elements_ + size; }
+
 protected:
 
   // Auxiliary member function
   void InsertAt(unsigned long index, const Data&);
   void InsertAt(unsigned long index, Data&&);
 
+  // For writes that bypass operator[]: keeps the next snapshot from sharing stale chunks
+  void Touch(unsigned long index) noexcept { if (snapshots_ != nullptr) snapshots_->Touch(index); }
+  void Touch(unsigned long first, unsigned long end) noexcept { if (snapshots_ != nullptr) snapshots_->Touch(first, end); }
+  void TouchAll() noexcept { Touch(0, size); }
+
 };
 
 /* ************************************************************************** */
@@ -116,6 +145,9 @@ public:
   SortableVector(const TraversableContainer<Data>&);
   SortableVector(MappableContainer<Data>&&);
 
+  template <ForeignInputRange<Data> Range>
+  SortableVector(Range&&);
+
   // Copy constructor
   SortableVector(const SortableVector&);
 
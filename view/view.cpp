@@ -0,0 +1,91 @@
+
+namespace lasd {
+
+/* ************************************************************************** */
+/* MapView */
+
+template <typename Data, typename Result>
+MapView<Data, Result>::MapView(const TraversableContainer<Data>& con, MapViewFun mapfun)
+  : source(con), fun(std::move(mapfun)) {}
+
+template <typename Data, typename Result>
+bool MapView<Data, Result>::Empty() const noexcept {
+  return source.Empty();
+}
+
+template <typename Data, typename Result>
+unsigned long MapView<Data, Result>::Size() const noexcept {
+  return source.Size();
+}
+
+template <typename Data, typename Result>
+void MapView<Data, Result>::Traverse(TraverseFun visit) const {
+  source.Traverse([this, &visit](const Data& dat) {
+    visit(fun(dat));
+  });
+}
+
+/* ************************************************************************** */
+/* FilterView */
+
+template <typename Data>
+FilterView<Data>::FilterView(const TraversableContainer<Data>& con, FilterViewFun filterfun)
+  : source(con), pred(std::move(filterfun)) {}
+
+template <typename Data>
+bool FilterView<Data>::Empty() const noexcept {
+  bool empty = true;
+  source.Traverse([this, &empty](const Data& dat) {
+    if (empty && pred(dat)) empty = false;
+  });
+  return empty;
+}
+
+template <typename Data>
+unsigned long FilterView<Data>::Size() const noexcept {
+  unsigned long count = 0;
+  source.Traverse([this, &count](const Data& dat) {
+    if (pred(dat)) ++count;
+  });
+  return count;
+}
+
+template <typename Data>
+void FilterView<Data>::Traverse(TraverseFun visit) const {
+  source.Traverse([this, &visit](const Data& dat) {
+    if (pred(dat)) visit(dat);
+  });
+}
+
+/* ************************************************************************** */
+/* TakeView */
+
+template <typename Data>
+TakeView<Data>::TakeView(const TraversableContainer<Data>& con, unsigned long num)
+  : source(con), count(num) {}
+
+template <typename Data>
+bool TakeView<Data>::Empty() const noexcept {
+  return (count == 0 || source.Empty());
+}
+
+template <typename Data>
+unsigned long TakeView<Data>::Size() const noexcept {
+  unsigned long srcSize = source.Size();
+  return (count < srcSize) ? count : srcSize;
+}
+
+template <typename Data>
+void TakeView<Data>::Traverse(TraverseFun visit) const {
+  unsigned long left = count;
+  source.Traverse([&left, &visit](const Data& dat) {
+    if (left > 0) {
+      --left;
+      visit(dat);
+    }
+  });
+}
+
+/* ************************************************************************** */
+
+}
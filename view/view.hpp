@@ -0,0 +1,187 @@
+
+#ifndef VIEW_HPP
+#define VIEW_HPP
+
+/* ************************************************************************** */
+
+#include <functional>
+#include <type_traits>
+
+/* ************************************************************************** */
+
+#include "../container/traversable.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Lazy adaptors over a TraversableContainer. A view stores only a reference
+// to its source (which must outlive it) and a callable: nothing is copied,
+// and stacking views fuses them into a single traversal of the source.
+// Temporaries are rejected as sources, so stacked views must be named.
+// The callables must not throw while FilterView computes Size or Empty.
+
+/* ************************************************************************** */
+
+template <typename Data, typename Result = Data>
+class MapView : public virtual TraversableContainer<Result> {
+  // Must extend TraversableContainer<Result>
+
+private:
+
+  // ...
+
+protected:
+
+  const TraversableContainer<Data>& source;
+  std::function<Result(const Data&)> fun;
+
+public:
+
+  using MapViewFun = std::function<Result(const Data&)>;
+
+  // Specific constructors
+  MapView(const TraversableContainer<Data>&, MapViewFun);
+  MapView(const TraversableContainer<Data>&&, MapViewFun) = delete; // The source would dangle
+
+  // Destructor
+  virtual ~MapView() = default;
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  MapView& operator=(const MapView&) = delete; // Views are rebound by construction only.
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from Container)
+
+  bool Empty() const noexcept override;
+  unsigned long Size() const noexcept override;
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from TraversableContainer)
+
+  using typename TraversableContainer<Result>::TraverseFun;
+
+  void Traverse(TraverseFun) const override;
+
+};
+
+template <typename Data, typename Fun>
+MapView(const TraversableContainer<Data>&, Fun) -> MapView<Data, std::remove_cvref_t<std::invoke_result_t<Fun, const Data&>>>;
+
+/* ************************************************************************** */
+
+template <typename Data>
+class FilterView : public virtual TraversableContainer<Data> {
+  // Must extend TraversableContainer<Data>
+
+private:
+
+  // ...
+
+protected:
+
+  const TraversableContainer<Data>& source;
+  std::function<bool(const Data&)> pred;
+
+public:
+
+  using FilterViewFun = std::function<bool(const Data&)>;
+
+  // Specific constructors
+  FilterView(const TraversableContainer<Data>&, FilterViewFun);
+  FilterView(const TraversableContainer<Data>&&, FilterViewFun) = delete; // The source would dangle
+
+  // Destructor
+  virtual ~FilterView() = default;
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  FilterView& operator=(const FilterView&) = delete; // Views are rebound by construction only.
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from Container)
+
+  // Both call the predicate, which must not throw (Size is noexcept across
+  // the hierarchy, so a throwing predicate would terminate the program)
+  bool Empty() const noexcept override;         // Stops testing at the first accepted element
+  unsigned long Size() const noexcept override; // Counts the accepted elements: one pass over the source
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from TraversableContainer)
+
+  using typename TraversableContainer<Data>::TraverseFun;
+
+  void Traverse(TraverseFun) const override;
+
+};
+
+template <typename Data, typename Fun>
+FilterView(const TraversableContainer<Data>&, Fun) -> FilterView<Data>;
+
+/* ************************************************************************** */
+
+template <typename Data>
+class TakeView : public virtual TraversableContainer<Data> {
+  // Must extend TraversableContainer<Data>
+
+private:
+
+  // ...
+
+protected:
+
+  const TraversableContainer<Data>& source;
+  unsigned long count = 0;
+
+public:
+
+  // Specific constructors
+  TakeView(const TraversableContainer<Data>&, unsigned long);
+  TakeView(const TraversableContainer<Data>&&, unsigned long) = delete; // The source would dangle
+
+  // Destructor
+  virtual ~TakeView() = default;
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  TakeView& operator=(const TakeView&) = delete; // Views are rebound by construction only.
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from Container)
+
+  bool Empty() const noexcept override;
+  unsigned long Size() const noexcept override;
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from TraversableContainer)
+
+  using typename TraversableContainer<Data>::TraverseFun;
+
+  // Hands out the first elements of the source; the source still visits the
+  // remaining ones (Traverse cannot stop early), but they are not forwarded.
+  void Traverse(TraverseFun) const override;
+
+};
+
+template <typename Data>
+TakeView(const TraversableContainer<Data>&, unsigned long) -> TakeView<Data>;
+
+/* ************************************************************************** */
+
+}
+
+#include "view.cpp"
+
+#endif
@@ -0,0 +1,1208 @@
+
+#include "bench.hpp"
+
+#include "../vector/vector.hpp"
+#include "../list/list.hpp"
+#include "../set/vec/setvec.hpp"
+#include "../set/lst/setlst.hpp"
+#include "../set/avl/setavl.hpp"
+#include "../set/btree/setbtree.hpp"
+#include "../set/hash/sethash.hpp"
+#include "../set/bloom/bloomset.hpp"
+#include "../set/roaring/setroaring.hpp"
+#include "../set/veb/setveb.hpp"
+#include "../set/pma/setpma.hpp"
+#include "../concurrent/skip/concurrentsetskip.hpp"
+#include "../concurrent/sharded/shardeddictionary.hpp"
+#include "../map/vec/orderedmap.hpp"
+#include "../heap/vec/heapvec.hpp"
+#include "../view/view.hpp"
+
+#include "../flat/vector/flatvector.hpp"
+#include "../flat/list/flatlist.hpp"
+#include "../flat/setvec/flatsetvec.hpp"
+#include "../flat/heapvec/flatheapvec.hpp"
+
+#include <bit>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Nota: il makefile compila con -fsanitize=address, quindi i tempi assoluti
+// sono gonfiati; contano i rapporti tra le due colonne.
+
+volatile long benchSink = 0;
+
+template <typename Fun>
+double NsPerOp(unsigned long ops, Fun&& fun) {
+    auto start = std::chrono::steady_clock::now();
+    fun();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(stop - start).count() / ops;
+}
+
+void PrintHeader(const std::string& title, const std::string& first, const std::string& second) {
+    std::cout << "\n==== " << title << " ====\n" << std::endl;
+    std::cout << std::left << std::setw(36) << "Operazione"
+              << std::right << std::setw(16) << first
+              << std::setw(16) << second
+              << std::setw(12) << "speed-up" << std::endl;
+}
+
+void PrintRow(const std::string& name, double first, double second) {
+    std::cout << std::left << std::setw(36) << name << std::right << std::fixed << std::setprecision(2)
+              << std::setw(13) << first << " ns"
+              << std::setw(13) << second << " ns"
+              << std::setw(11) << (first / second) << "x" << std::endl;
+}
+
+std::mt19937 benchRandom(2025);
+
+/* ************************************************************************** */
+
+// I parametri per riferimento impediscono la devirtualizzazione delle classi originali
+
+template <typename Con>
+[[gnu::noinline]] long SumByIndex(const Con& con) {
+    long sum = 0;
+    for (unsigned long i = 0; i < con.Size(); ++i)
+        sum += con[i];
+    return sum;
+}
+
+template <typename Con>
+[[gnu::noinline]] long SumByTraverse(const Con& con) {
+    long sum = 0;
+    con.Traverse([&sum](const int& val) { sum += val; });
+    return sum;
+}
+
+template <typename Con>
+[[gnu::noinline]] long CountExisting(const Con& con, unsigned long probes) {
+    long found = 0;
+    for (unsigned long i = 0; i < probes; ++i)
+        found += con.Exists(static_cast<int>(i * 7));
+    return found;
+}
+
+template <typename Con>
+[[gnu::noinline]] void InsertRandom(Con& con, unsigned long count) {
+    std::mt19937 gen(7);
+    for (unsigned long i = 0; i < count; ++i)
+        con.Insert(static_cast<int>(gen() % (count * 4)));
+}
+
+// Valori crescenti: entrambe le classi cercano in binario e accodano senza spostare nulla
+template <typename Con>
+[[gnu::noinline]] void InsertAscending(Con& con, unsigned long count) {
+    for (unsigned long i = 0; i < count; ++i)
+        con.Insert(static_cast<int>(i));
+}
+
+template <typename Con>
+[[gnu::noinline]] void SortHeap(Con& con) {
+    con.Sort();
+}
+
+// Carico misto: meta' inserimenti, un quarto rimozioni, un quarto ricerche
+template <typename Con>
+[[gnu::noinline]] long MixedWorkload(Con& con, unsigned long ops, unsigned long range) {
+    std::mt19937 gen(11);
+    long found = 0;
+    for (unsigned long i = 0; i < ops; ++i) {
+        const unsigned int roll = gen();
+        const int val = static_cast<int>((roll >> 2) % range);
+        switch (roll & 3) {
+            case 0:
+            case 1: con.Insert(val); break;
+            case 2: con.Remove(val); break;
+            default: found += con.Exists(val); break;
+        }
+    }
+    return found;
+}
+
+void BenchFlatContainers() {
+    std::cout << "\n==== sizeof: gerarchia virtuale vs varianti flat (Data = int) ====\n" << std::endl;
+    std::cout << "Vector<int>     " << std::setw(4) << sizeof(Vector<int>)  << " B   FlatVector<int>  " << std::setw(4) << sizeof(FlatVector<int>)  << " B" << std::endl;
+    std::cout << "List<int>       " << std::setw(4) << sizeof(List<int>)    << " B   FlatList<int>    " << std::setw(4) << sizeof(FlatList<int>)    << " B" << std::endl;
+    std::cout << "SetVec<int>     " << std::setw(4) << sizeof(SetVec<int>)  << " B   FlatSetVec<int>  " << std::setw(4) << sizeof(FlatSetVec<int>)  << " B" << std::endl;
+    std::cout << "HeapVec<int>    " << std::setw(4) << sizeof(HeapVec<int>) << " B   FlatHeapVec<int> " << std::setw(4) << sizeof(FlatHeapVec<int>) << " B" << std::endl;
+
+    PrintHeader("Costo per operazione: originale vs flat", "originale", "flat");
+
+    const unsigned long n = 1UL << 20;
+    Vector<int> vec(n);
+    FlatVector<int> fvec(n);
+    for (unsigned long i = 0; i < n; ++i)
+        vec[i] = fvec[i] = static_cast<int>(benchRandom() % 1000);
+
+    PrintRow("Vector operator[] + Size()", NsPerOp(n, [&] { benchSink = SumByIndex(vec); }),
+                                           NsPerOp(n, [&] { benchSink = SumByIndex(fvec); }));
+    PrintRow("Vector Traverse", NsPerOp(n, [&] { benchSink = SumByTraverse(vec); }),
+                                NsPerOp(n, [&] { benchSink = SumByTraverse(fvec); }));
+
+    List<int> lst(vec);
+    FlatList<int> flst(fvec);
+    PrintRow("List Traverse", NsPerOp(n, [&] { benchSink = SumByTraverse(lst); }),
+                              NsPerOp(n, [&] { benchSink = SumByTraverse(flst); }));
+
+    // Insert in coda: stesso algoritmo da entrambe le parti, resta solo il costo
+    // del dispatch. Con valori casuali SetVec sposta il lato piu' corto del
+    // buffer circolare e FlatSetVec sempre la coda, quindi la riga misura anche
+    // la differenza di algoritmo
+    const unsigned long m = 1UL << 14;
+    SetVec<int> ascending;
+    FlatSetVec<int> fascending;
+    PrintRow("SetVec Insert (crescenti)", NsPerOp(m, [&] { InsertAscending(ascending, m); }),
+                                          NsPerOp(m, [&] { InsertAscending(fascending, m); }));
+    SetVec<int> set;
+    FlatSetVec<int> fset;
+    PrintRow("SetVec Insert (casuali)", NsPerOp(m, [&] { InsertRandom(set, m); }),
+                                        NsPerOp(m, [&] { InsertRandom(fset, m); }));
+    PrintRow("SetVec Exists", NsPerOp(n, [&] { benchSink = CountExisting(set, n); }),
+                              NsPerOp(n, [&] { benchSink = CountExisting(fset, n); }));
+
+    HeapVec<int> heap(fvec); // dal range: il costruttore da TraversableContainer ridimensiona a ogni elemento
+    FlatHeapVec<int> fheap(fvec);
+    PrintRow("HeapVec Sort (per elemento)", NsPerOp(n, [&] { SortHeap(heap); }),
+                                            NsPerOp(n, [&] { SortHeap(fheap); }));
+}
+
+/* ************************************************************************** */
+
+void BenchFoldInPlace() {
+    PrintHeader("Fold vs FoldInPlace (accumulatori pesanti)", "Fold", "FoldInPlace");
+
+    // Fold copia l'accumulatore a ogni passo: il costo per elemento cresce con n
+    for (unsigned long n = 1UL << 12; n <= 1UL << 15; n <<= 1) {
+        Vector<std::string> words(n);
+        for (unsigned long i = 0; i < n; ++i)
+            words[i] = "parola" + std::to_string(i % 100);
+
+        PrintRow("Concatenazione, n = " + std::to_string(n), NsPerOp(n, [&] {
+            benchSink = words.Fold<std::string>([](const std::string& word, const std::string& acc) { return acc + word; }, "").size();
+        }), NsPerOp(n, [&] {
+            benchSink = words.FoldInPlace<std::string>([](std::string& acc, const std::string& word) { acc += word; }, "").size();
+        }));
+    }
+}
+
+void BenchSetVecBulkInsert() {
+    PrintHeader("SetVec: Insert uno a uno vs InsertAll (sort + merge)", "Insert", "InsertAll");
+
+    for (unsigned long n = 1UL << 12; n <= 1UL << 15; n <<= 1) {
+        Vector<int> batch(n);
+        for (unsigned long i = 0; i < n; ++i)
+            batch[i] = static_cast<int>(benchRandom() % (n * 4));
+
+        PrintRow("Batch casuale, n = " + std::to_string(n), NsPerOp(n, [&] {
+            SetVec<int> set;
+            batch.Traverse([&set](const int& val) { set.Insert(val); });
+            benchSink = set.Size();
+        }), NsPerOp(n, [&] {
+            SetVec<int> set;
+            set.InsertAll(batch);
+            benchSink = set.Size();
+        }));
+    }
+}
+
+void BenchSetVecBulkRemove() {
+    PrintHeader("SetVec: Remove uno a uno vs RemoveAll (compattazione)", "Remove", "RemoveAll");
+
+    for (unsigned long n = 1UL << 12; n <= 1UL << 15; n <<= 1) {
+        Vector<int> all(n);
+        for (unsigned long i = 0; i < n; ++i)
+            all[i] = static_cast<int>(i);
+        Vector<int> half(n / 2);
+        for (unsigned long i = 0; i < n / 2; ++i)
+            half[i] = static_cast<int>(benchRandom() % n);
+        SetVec<int> base(all);
+
+        PrintRow("Meta' casuale, n = " + std::to_string(n), NsPerOp(n / 2, [&] {
+            SetVec<int> set(base);
+            half.Traverse([&set](const int& val) { set.Remove(val); });
+            benchSink = set.Size();
+        }), NsPerOp(n / 2, [&] {
+            SetVec<int> set(base);
+            set.RemoveAll(half);
+            benchSink = set.Size();
+        }));
+    }
+}
+
+void BenchSetAlgebra() {
+    PrintHeader("Intersezione: Exists in Traverse vs Intersection", "Exists", "Intersection");
+
+    const unsigned long n = 1UL << 16;
+    Vector<int> values(n);
+    for (unsigned long i = 0; i < n; ++i)
+        values[i] = static_cast<int>(benchRandom() % (n * 4));
+    SetVec<int> large(values);
+
+    for (unsigned long m : {n, n / 64, n / 1024}) {
+        Vector<int> probes(m);
+        for (unsigned long i = 0; i < m; ++i)
+            probes[i] = static_cast<int>(benchRandom() % (n * 4));
+        SetVec<int> small(probes);
+
+        PrintRow("SetVec<int> " + std::to_string(large.Size()) + " & " + std::to_string(small.Size()), NsPerOp(small.Size(), [&] {
+            SetVec<int> result;
+            small.Traverse([&](const int& val) { if (large.Exists(val)) result.Insert(val); });
+            benchSink = result.Size();
+        }), NsPerOp(small.Size(), [&] {
+            benchSink = small.Intersection(large).Size();
+        }));
+    }
+
+    SetLst<int> lstA(Vector<int>(TakeView(values, 2048)));
+    SetLst<int> lstB(Vector<int>(TakeView(values, 4096)));
+    PrintRow("SetLst<int> 2048 & 4096", NsPerOp(lstA.Size(), [&] {
+        SetLst<int> result;
+        lstA.Traverse([&](const int& val) { if (lstB.Exists(val)) result.Insert(val); });
+        benchSink = result.Size();
+    }), NsPerOp(lstA.Size(), [&] {
+        benchSink = lstA.Intersection(lstB).Size();
+    }));
+}
+
+void BenchRangeQueries() {
+    PrintHeader("Conteggio in [lo, hi): Traverse filtrata vs RangeCount", "Traverse", "RangeCount");
+
+    for (unsigned long n = 1UL << 12; n <= 1UL << 15; n <<= 1) {
+        Vector<int> values(n);
+        for (unsigned long i = 0; i < n; ++i)
+            values[i] = static_cast<int>(i * 3);
+        SetVec<int> set(values);
+        const unsigned long queries = 256;
+
+        PrintRow("SetVec<int>, n = " + std::to_string(n), NsPerOp(queries, [&] {
+            long total = 0;
+            for (unsigned long q = 0; q < queries; ++q) {
+                int lo = static_cast<int>(q * 11), hi = lo + 300;
+                set.Traverse([&](const int& val) { total += (lo <= val && val < hi); });
+            }
+            benchSink = total;
+        }), NsPerOp(queries, [&] {
+            long total = 0;
+            for (unsigned long q = 0; q < queries; ++q) {
+                int lo = static_cast<int>(q * 11);
+                total += set.RangeCount(lo, lo + 300);
+            }
+            benchSink = total;
+        }));
+    }
+}
+
+template <typename Con>
+[[gnu::noinline]] long LinearPredecessors(const Con& con, unsigned long queries) {
+    // Quello che faceva SetVec::Predecessor: scansione dall'indice 0
+    long sum = 0;
+    for (unsigned long q = 0; q < queries; ++q) {
+        const int val = static_cast<int>(q * 7919 % (con.Size() * 2)) + 1;
+        const int* pred = nullptr;
+        for (unsigned long i = 0; i < con.Size() && con[i] < val; ++i)
+            pred = &con[i];
+        sum += (pred != nullptr) ? *pred : 0;
+    }
+    return sum;
+}
+
+void BenchSetVecNeighbours() {
+    PrintHeader("SetVec: scansione lineare vs Predecessor/Successor", "Lineare", "Binaria");
+
+    const unsigned long queries = 128;
+    for (unsigned long n = 1UL << 14; n <= 1UL << 20; n <<= 2) {
+        Vector<int> values(n);
+        for (unsigned long i = 0; i < n; ++i)
+            values[i] = static_cast<int>(2 * i);
+        SetVec<int> set(values);
+
+        double linear = NsPerOp(queries, [&] { benchSink = LinearPredecessors(set, queries); });
+        PrintRow("Predecessor, n = " + std::to_string(n), linear, NsPerOp(queries, [&] {
+            long sum = 0;
+            for (unsigned long q = 0; q < queries; ++q)
+                sum += set.Predecessor(static_cast<int>(q * 7919 % (n * 2)) + 1);
+            benchSink = sum;
+        }));
+        PrintRow("Successor, n = " + std::to_string(n), linear, NsPerOp(queries, [&] {
+            long sum = 0;
+            for (unsigned long q = 0; q < queries; ++q)
+                sum += set.Successor(static_cast<int>(q * 7919 % (n * 2)) - 1);
+            benchSink = sum;
+        }));
+    }
+}
+
+void BenchSetVecCircular() {
+    PrintHeader("SetVec: consumo del minimo e inserimenti casuali", "SetLst", "SetVec");
+
+    for (unsigned long n = 1UL << 12; n <= 1UL << 15; n <<= 1) {
+        Vector<int> values(n);
+        for (unsigned long i = 0; i < n; ++i)
+            values[i] = static_cast<int>(i);
+        SetVec<int> baseVec(values);
+        SetLst<int> baseLst(values);
+
+        PrintRow("MinNRemove fino a vuoto, n = " + std::to_string(n), NsPerOp(n, [&] {
+            SetLst<int> lst(baseLst);
+            long sum = 0;
+            while (!lst.Empty()) sum += lst.MinNRemove();
+            benchSink = sum;
+        }), NsPerOp(n, [&] {
+            SetVec<int> vec(baseVec);
+            long sum = 0;
+            while (!vec.Empty()) sum += vec.MinNRemove();
+            benchSink = sum;
+        }));
+    }
+
+    for (unsigned long n = 1UL << 12; n <= 1UL << 14; n <<= 1) {
+        PrintRow("Insert casuali, n = " + std::to_string(n), NsPerOp(n, [&] {
+            SetLst<int> lst;
+            InsertRandom(lst, n);
+            benchSink = lst.Size();
+        }), NsPerOp(n, [&] {
+            SetVec<int> vec;
+            InsertRandom(vec, n);
+            benchSink = vec.Size();
+        }));
+    }
+}
+
+[[gnu::noinline]] bool IndexedExists(const LinearContainer<int>& con, int val) {
+    // Ricerca binaria generica: operator[] virtuale con controllo dei limiti
+    unsigned long lo = 0, hi = con.Size();
+    while (lo < hi) {
+        unsigned long mid = lo + (hi - lo) / 2;
+        if (con[mid] < val) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo < con.Size() && con[lo] == val;
+}
+
+void BenchSetVecSegments() {
+    PrintHeader("SetVec: accesso indicizzato vs cicli nativi sui due segmenti", "operator[]", "Nativo");
+
+    for (unsigned long n = 1UL << 14; n <= 1UL << 20; n <<= 3) {
+        Vector<int> values(n);
+        for (unsigned long i = 0; i < n; ++i)
+            values[i] = static_cast<int>(2 * i);
+        SetVec<int> set(values);
+        for (unsigned long i = 0; i < n / 3; ++i) set.RemoveMin();   // Buffer avvolto:
+        for (unsigned long i = 0; i < n / 3; ++i)                    // due segmenti
+            set.Insert(static_cast<int>(2 * (n + i)));
+
+        PrintRow("Traverse, n = " + std::to_string(n), NsPerOp(n, [&] {
+            long sum = 0;
+            set.LinearContainer<int>::PreOrderTraverse([&sum](const int& val) { sum += val; });
+            benchSink = sum;
+        }), NsPerOp(n, [&] {
+            benchSink = SumByTraverse(set);
+        }));
+
+        const unsigned long probes = 1UL << 14;
+        PrintRow("Exists, n = " + std::to_string(n), NsPerOp(probes, [&] {
+            long found = 0;
+            for (unsigned long i = 0; i < probes; ++i)
+                found += IndexedExists(set, static_cast<int>(i * 97 % (n * 4)));
+            benchSink = found;
+        }), NsPerOp(probes, [&] {
+            long found = 0;
+            for (unsigned long i = 0; i < probes; ++i)
+                found += set.Exists(static_cast<int>(i * 97 % (n * 4)));
+            benchSink = found;
+        }));
+    }
+}
+
+void BenchSetVecSearchIndex() {
+    PrintHeader("SetVec: ricerca binaria vs indice Eytzinger (sonde casuali)", "Binaria", "Eytzinger");
+
+    const unsigned long probes = 1UL << 18;
+    for (unsigned long n = 1UL << 16; n <= 1UL << 22; n <<= 3) {
+        Vector<int> values(n);
+        for (unsigned long i = 0; i < n; ++i)
+            values[i] = static_cast<int>(2 * i);
+        SetVec<int> plain(values);
+        SetVec<int> indexed(plain);
+        indexed.EnableSearchIndex();
+        indexed.Exists(0); // Costruzione dell'indice fuori dalla misura
+
+        Vector<int> queries(probes);
+        for (unsigned long i = 0; i < probes; ++i)
+            queries[i] = static_cast<int>(benchRandom() % (2 * n));
+
+        PrintRow("Exists, n = " + std::to_string(n), NsPerOp(probes, [&] {
+            long found = 0;
+            queries.Traverse([&](const int& val) { found += plain.Exists(val); });
+            benchSink = found;
+        }), NsPerOp(probes, [&] {
+            long found = 0;
+            queries.Traverse([&](const int& val) { found += indexed.Exists(val); });
+            benchSink = found;
+        }));
+        PrintRow("Successor, n = " + std::to_string(n), NsPerOp(probes, [&] {
+            long sum = 0;
+            queries.Traverse([&](const int& val) { if (val < 2 * static_cast<int>(n) - 2) sum += plain.Successor(val); });
+            benchSink = sum;
+        }), NsPerOp(probes, [&] {
+            long sum = 0;
+            queries.Traverse([&](const int& val) { if (val < 2 * static_cast<int>(n) - 2) sum += indexed.Successor(val); });
+            benchSink = sum;
+        }));
+    }
+}
+
+void BenchSetLstSkipIndex() {
+    PrintHeader("SetLst: scansione da head vs indice sparso e finger", "Da head", "SetLst");
+
+    const unsigned long queries = 1UL << 12;
+    for (unsigned long n = 1UL << 12; n <= 1UL << 16; n <<= 2) {
+        Vector<int> values(n);
+        for (unsigned long i = 0; i < n; ++i)
+            values[i] = static_cast<int>(2 * i);
+        SetLst<int> lst(values);
+
+        Vector<int> probes(queries);
+        for (unsigned long i = 0; i < queries; ++i)
+            probes[i] = static_cast<int>(benchRandom() % (2 * n));
+
+        // The walk every lookup used to do: from the front, stopping at the first value not below
+        PrintRow("Exists, n = " + std::to_string(n), NsPerOp(queries, [&] {
+            long found = 0;
+            probes.Traverse([&](const int& val) {
+                for (const int& dat : lst) {
+                    if (!(dat < val)) { found += (dat == val); break; }
+                }
+            });
+            benchSink = found;
+        }), NsPerOp(queries, [&] {
+            long found = 0;
+            probes.Traverse([&](const int& val) { found += lst.Exists(val); });
+            benchSink = found;
+        }));
+
+        const unsigned long rounds = 64;
+        PrintRow("Max, n = " + std::to_string(n), NsPerOp(rounds, [&] {
+            long sum = 0;
+            for (unsigned long r = 0; r < rounds; ++r)
+                sum += lst.Fold<int>([](const int& acc, const int& dat) { return dat > acc ? dat : acc; }, 0);
+            benchSink = sum;
+        }), NsPerOp(rounds, [&] {
+            long sum = 0;
+            for (unsigned long r = 0; r < rounds; ++r)
+                sum += lst.Max();
+            benchSink = sum;
+        }));
+    }
+}
+
+template <typename Impl>
+void BloomRows(const std::string& name, unsigned long n, unsigned long probes) {
+    // Values are even, so about 90% of the probes below are misses
+    Vector<int> values(n);
+    for (unsigned long i = 0; i < n; ++i)
+        values[i] = static_cast<int>(2 * i);
+    Impl plain(values);
+    BloomSet<int, Impl> bloom(values);
+
+    Vector<int> queries(probes);
+    for (unsigned long i = 0; i < probes; ++i)
+        queries[i] = static_cast<int>((i % 10 == 0) ? 2 * (benchRandom() % n) : 2 * (benchRandom() % n) + 1);
+    benchSink = bloom.Exists(0); // Builds the filter outside the timing
+
+    PrintRow("Exists " + name + ", n = " + std::to_string(n), NsPerOp(probes, [&] {
+        long found = 0;
+        queries.Traverse([&](const int& val) { found += plain.Exists(val); });
+        benchSink = found;
+    }), NsPerOp(probes, [&] {
+        long found = 0;
+        queries.Traverse([&](const int& val) { found += bloom.Exists(val); });
+        benchSink = found;
+    }));
+}
+
+void BenchBloomSet() {
+    PrintHeader("BloomSet: Exists con 90% di sonde assenti", "Set", "BloomSet");
+
+    for (unsigned long n = 1UL << 12; n <= 1UL << 14; n <<= 2)
+        BloomRows<SetLst<int>>("SetLst", n, 1UL << 12);
+    for (unsigned long n = 1UL << 14; n <= 1UL << 22; n <<= 4)
+        BloomRows<SetVec<int>>("SetVec", n, 1UL << 18);
+
+    // False positives at the full load reached just before a rebuild, on random
+    // odd probes (runs of consecutive misses do even better: Fibonacci hashing
+    // spreads arithmetic progressions almost evenly over the blocks)
+    std::cout << std::endl;
+    for (unsigned long n = 1UL << 16; n <= 1UL << 20; n <<= 4) {
+        BloomSet<int, SetVec<int>> bloom;
+        unsigned long i = 0;
+        for (; i < n; ++i) bloom.Insert(static_cast<int>(2 * i));
+        benchSink = bloom.Exists(0);
+        const unsigned long afterRebuild = bloom.Size();
+        while (bloom.Size() < 2 * afterRebuild) bloom.Insert(static_cast<int>(2 * i++));
+
+        const unsigned long probes = 1UL << 20;
+        unsigned long falsePositives = 0;
+        for (unsigned long q = 0; q < probes; ++q)
+            falsePositives += bloom.MayContain(static_cast<int>(benchRandom() >> 1) | 1);
+        std::cout << "Falsi positivi a pieno carico, n = " << bloom.Size() << ": " << std::fixed << std::setprecision(3)
+                  << (100.0 * falsePositives / probes) << "% (" << bloom.FilterBytes() / bloom.Size() << " byte per valore)" << std::endl;
+    }
+}
+
+void BenchSetAVL() {
+    PrintHeader("SetAVL: carico misto Insert/Remove/Exists", "SetVec", "SetAVL");
+
+    for (unsigned long n = 1UL << 12; n <= 1UL << 18; n <<= 2) {
+        const unsigned long ops = 4 * n;
+        PrintRow("Misto, ~" + std::to_string(n) + " elementi", NsPerOp(ops, [&] {
+            SetVec<int> vec;
+            benchSink = MixedWorkload(vec, ops, 2 * n);
+        }), NsPerOp(ops, [&] {
+            SetAVL<int> avl;
+            benchSink = MixedWorkload(avl, ops, 2 * n);
+        }));
+    }
+
+    PrintHeader("SetAVL: carico misto e select per rango", "SetLst", "SetAVL");
+
+    for (unsigned long n = 1UL << 10; n <= 1UL << 12; n <<= 1) {
+        const unsigned long ops = 4 * n;
+        SetLst<int> lst;
+        SetAVL<int> avl;
+        PrintRow("Misto, ~" + std::to_string(n) + " elementi", NsPerOp(ops, [&] {
+            benchSink = MixedWorkload(lst, ops, 2 * n);
+        }), NsPerOp(ops, [&] {
+            benchSink = MixedWorkload(avl, ops, 2 * n);
+        }));
+        PrintRow("operator[], n = " + std::to_string(lst.Size()), NsPerOp(lst.Size(), [&] {
+            benchSink = SumByIndex(lst);
+        }), NsPerOp(avl.Size(), [&] {
+            benchSink = SumByIndex(avl);
+        }));
+    }
+}
+
+void BenchSetBTree() {
+    PrintHeader("SetBTree: ricerca e scansione su insiemi grandi", "SetVec", "SetBTree");
+
+    const unsigned long probes = 1UL << 18;
+    for (unsigned long n = 1UL << 16; n <= 1UL << 22; n <<= 3) {
+        Vector<int> values(n);
+        for (unsigned long i = 0; i < n; ++i)
+            values[i] = static_cast<int>(2 * i);
+        SetVec<int> vec(values);
+        SetBTree<int> tree(values);
+
+        Vector<int> queries(probes);
+        for (unsigned long i = 0; i < probes; ++i)
+            queries[i] = static_cast<int>(benchRandom() % (2 * n));
+
+        PrintRow("Exists, n = " + std::to_string(n), NsPerOp(probes, [&] {
+            long found = 0;
+            queries.Traverse([&](const int& val) { found += vec.Exists(val); });
+            benchSink = found;
+        }), NsPerOp(probes, [&] {
+            long found = 0;
+            queries.Traverse([&](const int& val) { found += tree.Exists(val); });
+            benchSink = found;
+        }));
+        PrintRow("Traverse, n = " + std::to_string(n), NsPerOp(n, [&] {
+            benchSink = SumByTraverse(vec);
+        }), NsPerOp(n, [&] {
+            benchSink = SumByTraverse(tree);
+        }));
+    }
+
+    PrintHeader("SetBTree: carico misto e costruzione in blocco", "SetAVL", "SetBTree");
+
+    for (unsigned long n = 1UL << 14; n <= 1UL << 20; n <<= 3) {
+        const unsigned long ops = 4 * n;
+        PrintRow("Misto, ~" + std::to_string(n) + " elementi", NsPerOp(ops, [&] {
+            SetAVL<int> avl;
+            benchSink = MixedWorkload(avl, ops, 2 * n);
+        }), NsPerOp(ops, [&] {
+            SetBTree<int> tree;
+            benchSink = MixedWorkload(tree, ops, 2 * n);
+        }));
+
+        Vector<int> values(n);
+        for (unsigned long i = 0; i < n; ++i)
+            values[i] = static_cast<int>(benchRandom() % (4 * n));
+        PrintRow("Costruzione, n = " + std::to_string(n), NsPerOp(n, [&] {
+            SetAVL<int> avl(values);
+            benchSink = avl.Size();
+        }), NsPerOp(n, [&] {
+            SetBTree<int> tree(values);
+            benchSink = tree.Size();
+        }));
+    }
+}
+
+void BenchSetHash() {
+    PrintHeader("SetHash: Exists con sonde casuali", "SetVec", "SetHash");
+
+    const unsigned long probes = 1UL << 18;
+    for (unsigned long n = 1UL << 10; n <= 1UL << 22; n <<= 4) {
+        Vector<int> values(n);
+        for (unsigned long i = 0; i < n; ++i)
+            values[i] = static_cast<int>(2 * i);
+        SetVec<int> vec(values);
+        SetHash<int> hash(values);
+
+        Vector<int> queries(probes);
+        for (unsigned long i = 0; i < probes; ++i)
+            queries[i] = static_cast<int>(benchRandom() % (2 * n));
+
+        PrintRow("Exists<int>, n = " + std::to_string(n), NsPerOp(probes, [&] {
+            long found = 0;
+            queries.Traverse([&](const int& val) { found += vec.Exists(val); });
+            benchSink = found;
+        }), NsPerOp(probes, [&] {
+            long found = 0;
+            queries.Traverse([&](const int& val) { found += hash.Exists(val); });
+            benchSink = found;
+        }));
+    }
+
+    for (unsigned long n = 1UL << 12; n <= 1UL << 18; n <<= 6) {
+        Vector<std::string> words(n);
+        for (unsigned long i = 0; i < n; ++i)
+            words[i] = "chiave-" + std::to_string(i * 2);
+        SetVec<std::string> vec(words);
+        SetHash<std::string> hash(words);
+
+        const unsigned long count = 1UL << 16;
+        Vector<std::string> queries(count);
+        for (unsigned long i = 0; i < count; ++i)
+            queries[i] = "chiave-" + std::to_string(benchRandom() % (2 * n));
+
+        PrintRow("Exists<string>, n = " + std::to_string(n), NsPerOp(count, [&] {
+            long found = 0;
+            queries.Traverse([&](const std::string& val) { found += vec.Exists(val); });
+            benchSink = found;
+        }), NsPerOp(count, [&] {
+            long found = 0;
+            queries.Traverse([&](const std::string& val) { found += hash.Exists(val); });
+            benchSink = found;
+        }));
+    }
+
+    PrintHeader("SetHash: carico misto Insert/Remove/Exists", "SetBTree", "SetHash");
+
+    for (unsigned long n = 1UL << 14; n <= 1UL << 20; n <<= 3) {
+        const unsigned long ops = 4 * n;
+        PrintRow("Misto, ~" + std::to_string(n) + " elementi", NsPerOp(ops, [&] {
+            SetBTree<int> tree;
+            benchSink = MixedWorkload(tree, ops, 2 * n);
+        }), NsPerOp(ops, [&] {
+            SetHash<int> hash;
+            benchSink = MixedWorkload(hash, ops, 2 * n);
+        }));
+    }
+}
+
+/* ************************************************************************** */
+
+// Runs the same read-mostly workload (90% Exists, 5% Insert, 5% Remove) on
+// every thread; the timing covers the whole run, so the result is wall time
+// per operation of all threads together
+template <typename Op>
+void ParallelWorkload(unsigned int threads, unsigned long opsPerThread, unsigned long range, Op&& op) {
+    std::vector<std::thread> workers;
+    for (unsigned int t = 0; t < threads; ++t) {
+        workers.emplace_back([&op, t, opsPerThread, range]() {
+            std::mt19937 gen(17 + t);
+            long found = 0;
+            for (unsigned long i = 0; i < opsPerThread; ++i) {
+                int val = static_cast<int>(gen() % range);
+                unsigned int kind = gen() % 20;
+                found += op(kind == 0 ? 1 : (kind == 1 ? 2 : 0), val);
+            }
+            benchSink = found;
+        });
+    }
+    for (std::thread& worker : workers) worker.join();
+}
+
+void BenchConcurrentSetSkip() {
+    const unsigned long n = 1UL << 16;
+    const unsigned long ops = 1UL << 19;
+    unsigned int cores = std::thread::hardware_concurrency();
+    if (cores == 0) cores = 1;
+    // At least 4 threads even on small machines: past the cores the rows
+    // measure contention and preemption, not scaling
+    const unsigned int maxThreads = (cores < 4) ? 4 : cores;
+
+    PrintHeader("ConcurrentSetSkip: da 1 a " + std::to_string(maxThreads) + " thread su " + std::to_string(cores) + " core (90% Exists)", "SetVec+mutex", "ConcSetSkip");
+
+    for (unsigned int threads = 1; ; threads = (threads * 2 < maxThreads) ? threads * 2 : maxThreads) {
+        SetVec<int> vec;
+        std::mutex lock;
+        ConcurrentSetSkip<int> skip;
+        for (unsigned long i = 0; i < n; ++i) {
+            vec.Insert(static_cast<int>(2 * i));
+            skip.Insert(static_cast<int>(2 * i));
+        }
+
+        PrintRow(std::to_string(threads) + " thread" + (threads > cores ? " (oltre i core)" : ""), NsPerOp(ops, [&] {
+            ParallelWorkload(threads, ops / threads, 2 * n, [&](unsigned int kind, int val) -> long {
+                std::lock_guard<std::mutex> guard(lock);
+                if (kind == 1) return vec.Insert(val);
+                if (kind == 2) return vec.Remove(val);
+                return vec.Exists(val);
+            });
+        }), NsPerOp(ops, [&] {
+            ParallelWorkload(threads, ops / threads, 2 * n, [&](unsigned int kind, int val) -> long {
+                if (kind == 1) return skip.Insert(val);
+                if (kind == 2) return skip.Remove(val);
+                return skip.Exists(val);
+            });
+        }));
+        if (threads == maxThreads) break;
+    }
+}
+
+void BenchShardedDictionary() {
+    const unsigned long n = 1UL << 16;
+    const unsigned long ops = 1UL << 19;
+    unsigned int cores = std::thread::hardware_concurrency();
+    if (cores == 0) cores = 1;
+
+    PrintHeader("ShardedDictionary<SetVec>: scalabilita' fino a " + std::to_string(cores) + " core (90% Exists)", "SetVec+mutex", "Sharded(16)");
+
+    Vector<int> values(n);
+    for (unsigned long i = 0; i < n; ++i) values[i] = static_cast<int>(2 * i);
+
+    for (unsigned int threads = 1; ; threads = (threads * 2 < cores) ? threads * 2 : cores) {
+        SetVec<int> vec(values);
+        std::mutex lock;
+        ShardedDictionary<int, SetVec<int>> sharded(values);
+
+        PrintRow(std::to_string(threads) + " thread", NsPerOp(ops, [&] {
+            ParallelWorkload(threads, ops / threads, 2 * n, [&](unsigned int kind, int val) -> long {
+                std::lock_guard<std::mutex> guard(lock);
+                if (kind == 1) return vec.Insert(val);
+                if (kind == 2) return vec.Remove(val);
+                return vec.Exists(val);
+            });
+        }), NsPerOp(ops, [&] {
+            ParallelWorkload(threads, ops / threads, 2 * n, [&](unsigned int kind, int val) -> long {
+                if (kind == 1) return sharded.Insert(val);
+                if (kind == 2) return sharded.Remove(val);
+                return sharded.Exists(val);
+            });
+        }));
+        if (threads == cores) break;
+    }
+
+    // One lock per shard for the whole batch, against one per value
+    const unsigned long batch = 1UL << 14;
+    Vector<int> incoming(batch);
+    for (unsigned long i = 0; i < batch; ++i) incoming[i] = static_cast<int>(benchRandom() % (4 * n));
+    ShardedDictionary<int, SetVec<int>> single(values);
+    ShardedDictionary<int, SetVec<int>> batched(values);
+    PrintRow("Batch di " + std::to_string(batch) + ", Insert vs InsertSome", NsPerOp(batch, [&] {
+        long inserted = 0;
+        incoming.Traverse([&](const int& val) { inserted += single.Insert(val); });
+        benchSink = inserted;
+    }), NsPerOp(batch, [&] {
+        benchSink = batched.InsertSome(incoming);
+    }));
+}
+
+/* ************************************************************************** */
+
+void BenchSnapshot() {
+    PrintHeader("SetVec: copia intera vs Snapshot (ns per versione)", "Copia", "Snapshot");
+
+    const unsigned long versions = 64;
+    for (unsigned long n = 1UL << 14; n <= 1UL << 18; n <<= 2) {
+        Vector<int> values(n);
+        for (unsigned long i = 0; i < n; ++i)
+            values[i] = static_cast<int>(2 * i);
+
+        // Un writer che aggiunge in coda: ogni versione cambia solo l'ultimo blocco
+        SetVec<int> copied(values);
+        SetVec<int> shared(values);
+        int next = static_cast<int>(2 * n);
+        PrintRow("16 in coda, n = " + std::to_string(n), NsPerOp(versions, [&] {
+            long sum = 0;
+            for (unsigned long v = 0; v < versions; ++v) {
+                for (int k = 0; k < 16; ++k) copied.Insert(next + 2 * k);
+                SetVec<int> version(copied);
+                sum += version.Size();
+            }
+            benchSink = sum;
+        }), NsPerOp(versions, [&] {
+            long sum = 0;
+            for (unsigned long v = 0; v < versions; ++v) {
+                for (int k = 0; k < 16; ++k) shared.Insert(next + 2 * k);
+                SnapshotView<int> version = shared.Snapshot();
+                sum += version.Size();
+            }
+            benchSink = sum;
+        }));
+
+        // Inserimenti sparsi: lo spostamento del lato corto sporca piu' blocchi
+        PrintRow("16 sparsi, n = " + std::to_string(n), NsPerOp(versions, [&] {
+            long sum = 0;
+            for (unsigned long v = 0; v < versions; ++v) {
+                for (int k = 0; k < 16; ++k) copied.Insert(static_cast<int>(benchRandom() % (2 * n)) | 1);
+                SetVec<int> version(copied);
+                sum += version.Size();
+            }
+            benchSink = sum;
+        }), NsPerOp(versions, [&] {
+            long sum = 0;
+            for (unsigned long v = 0; v < versions; ++v) {
+                for (int k = 0; k < 16; ++k) shared.Insert(static_cast<int>(benchRandom() % (2 * n)) | 1);
+                SnapshotView<int> version = shared.Snapshot();
+                sum += version.Size();
+            }
+            benchSink = sum;
+        }));
+    }
+}
+
+/* ************************************************************************** */
+
+// Record chiave + carico da 60 byte, ordinato e confrontato solo per chiave
+struct BenchRecord {
+    int key = 0;
+    char payload[60] = {};
+
+    bool operator<(const BenchRecord& other) const noexcept { return key < other.key; }
+    bool operator==(const BenchRecord& other) const noexcept { return key == other.key; }
+    bool operator!=(const BenchRecord& other) const noexcept { return key != other.key; }
+};
+
+struct BenchPayload {
+    char bytes[60] = {};
+
+    bool operator==(const BenchPayload&) const noexcept = default;
+};
+
+void BenchOrderedMap() {
+    PrintHeader("SetVec di record vs OrderedMap (chiavi e valori separati)", "SetVec", "OrderedMap");
+
+    const unsigned long probes = 1UL << 18;
+    const unsigned long inserts = 1UL << 10;
+    for (unsigned long n = 1UL << 12; n <= 1UL << 20; n <<= 4) {
+        // Chiavi pari in ordine: ogni inserimento accoda
+        Vector<int> keys(n);
+        SetVec<BenchRecord> records;
+        OrderedMap<int, BenchPayload> map;
+        for (unsigned long i = 0; i < n; ++i) {
+            keys[i] = static_cast<int>(2 * i);
+            BenchRecord rec;
+            rec.key = keys[i];
+            rec.payload[0] = static_cast<char>(i);
+            records.Insert(rec);
+            BenchPayload val;
+            val.bytes[0] = static_cast<char>(i);
+            map.Insert(keys[i], val);
+        }
+
+        // Chiavi dispari sparse: ogni inserimento sposta il lato corto
+        Vector<int> odd(inserts);
+        for (unsigned long i = 0; i < inserts; ++i)
+            odd[i] = static_cast<int>(benchRandom() % n) * 2 + 1;
+        PrintRow("Insert sparso, n = " + std::to_string(n), NsPerOp(inserts, [&] {
+            odd.Traverse([&](const int& key) {
+                BenchRecord rec;
+                rec.key = key;
+                records.Insert(rec);
+            });
+        }), NsPerOp(inserts, [&] {
+            odd.Traverse([&](const int& key) { map.Insert(key, BenchPayload()); });
+        }));
+
+        Vector<int> queries(probes);
+        for (unsigned long i = 0; i < probes; ++i)
+            queries[i] = keys[benchRandom() % n];
+
+        PrintRow("Find, n = " + std::to_string(n), NsPerOp(probes, [&] {
+            long sum = 0;
+            queries.Traverse([&](const int& key) {
+                BenchRecord probe;
+                probe.key = key;
+                sum += records.LowerBound(probe).payload[0];
+            });
+            benchSink = sum;
+        }), NsPerOp(probes, [&] {
+            long sum = 0;
+            queries.Traverse([&](const int& key) { sum += map.Find(key).bytes[0]; });
+            benchSink = sum;
+        }));
+        PrintRow("Successor, n = " + std::to_string(n), NsPerOp(probes, [&] {
+            long sum = 0;
+            queries.Traverse([&](const int& key) {
+                BenchRecord probe;
+                probe.key = key - 1;
+                sum += records.Successor(probe).key;
+            });
+            benchSink = sum;
+        }), NsPerOp(probes, [&] {
+            long sum = 0;
+            queries.Traverse([&](const int& key) { sum += map.Successor(key - 1); });
+            benchSink = sum;
+        }));
+    }
+}
+
+void BenchExistsBatch() {
+    PrintHeader("ExistsBatch vs un Exists per sonda (ns per sonda)", "Exists", "ExistsBatch");
+
+    const unsigned long probes = 1UL << 18;
+    for (unsigned long n = 1UL << 16; n <= 1UL << 22; n <<= 3) {
+        Vector<int> values(n);
+        for (unsigned long i = 0; i < n; ++i)
+            values[i] = static_cast<int>(2 * i);
+        SetVec<int> set(values);
+
+        Vector<int> queries(probes);
+        for (unsigned long i = 0; i < probes; ++i)
+            queries[i] = static_cast<int>(benchRandom() % (2 * n));
+        Vector<bool> found;
+
+        PrintRow("SetVec, n = " + std::to_string(n), NsPerOp(probes, [&] {
+            long hits = 0;
+            queries.Traverse([&](const int& val) { hits += set.Exists(val); });
+            benchSink = hits;
+        }), NsPerOp(probes, [&] {
+            benchSink = set.ExistsBatch(queries, found);
+        }));
+    }
+
+    const unsigned long listProbes = 1UL << 12;
+    for (unsigned long n = 1UL << 12; n <= 1UL << 16; n <<= 2) {
+        Vector<int> values(n);
+        for (unsigned long i = 0; i < n; ++i)
+            values[i] = static_cast<int>(2 * i);
+        SetLst<int> set(values);
+
+        Vector<int> queries(listProbes);
+        for (unsigned long i = 0; i < listProbes; ++i)
+            queries[i] = static_cast<int>(benchRandom() % (2 * n));
+        Vector<bool> found;
+
+        PrintRow("SetLst, n = " + std::to_string(n), NsPerOp(listProbes, [&] {
+            long hits = 0;
+            queries.Traverse([&](const int& val) { hits += set.Exists(val); });
+            benchSink = hits;
+        }), NsPerOp(listProbes, [&] {
+            benchSink = set.ExistsBatch(queries, found);
+        }));
+    }
+}
+
+void BenchSetRoaring() {
+    // Tre distribuzioni di identificativi: meta' di un intervallo (bitmap),
+    // sequenze di identificativi consecutivi (run) e valori sparsi (array)
+    const unsigned long n = 1UL << 20;
+    std::vector<std::pair<std::string, Vector<int>>> cases;
+    Vector<int> dense(n);
+    for (unsigned long i = 0; i < n; ++i)
+        dense[i] = static_cast<int>(benchRandom() % (2 * n));
+    cases.emplace_back("densi", std::move(dense));
+    Vector<int> runs(n);
+    for (unsigned long i = 0; i < n; i += 256) {
+        const int start = static_cast<int>(benchRandom() % (64 * n));
+        for (unsigned long k = 0; k < 256; ++k) runs[i + k] = start + static_cast<int>(k);
+    }
+    cases.emplace_back("sequenze", std::move(runs));
+    Vector<int> sparse(n);
+    for (unsigned long i = 0; i < n; ++i)
+        sparse[i] = static_cast<int>(benchRandom() % (32 * n));
+    cases.emplace_back("sparsi", std::move(sparse));
+
+    std::cout << "\n==== SetRoaring: memoria occupata (n = " << n << " inserimenti) ====\n" << std::endl;
+    for (auto& [name, values] : cases) {
+        SetVec<int> vec(values);
+        SetRoaring<int> roaring(values);
+        const unsigned long vecBytes = std::bit_ceil(vec.Size()) * sizeof(int); // Capacita' potenza di due
+        std::cout << std::left << std::setw(12) << name << "SetVec " << std::right << std::setw(9) << vecBytes
+                  << " B   SetRoaring " << std::setw(9) << roaring.MemoryBytes() << " B   riduzione "
+                  << std::fixed << std::setprecision(1) << static_cast<double>(vecBytes) / roaring.MemoryBytes() << "x" << std::endl;
+    }
+
+    PrintHeader("SetRoaring vs SetVec<int> (ns per operazione)", "SetVec", "SetRoaring");
+    const unsigned long probes = 1UL << 18;
+    for (auto& [name, values] : cases) {
+        SetVec<int> vec(values);
+        SetRoaring<int> roaring(values);
+        Vector<int> queries(probes);
+        for (unsigned long i = 0; i < probes; ++i)
+            queries[i] = values[benchRandom() % n] + static_cast<int>(benchRandom() % 3) - 1;
+
+        PrintRow("Exists, " + name, NsPerOp(probes, [&] {
+            long hits = 0;
+            queries.Traverse([&](const int& val) { hits += vec.Exists(val); });
+            benchSink = hits;
+        }), NsPerOp(probes, [&] {
+            long hits = 0;
+            queries.Traverse([&](const int& val) { hits += roaring.Exists(val); });
+            benchSink = hits;
+        }));
+        PrintRow("Successor, " + name, NsPerOp(probes, [&] {
+            long sum = 0;
+            queries.Traverse([&](const int& val) { if (val < vec.Max()) sum += vec.Successor(val); });
+            benchSink = sum;
+        }), NsPerOp(probes, [&] {
+            long sum = 0;
+            queries.Traverse([&](const int& val) { if (val < roaring.Max()) sum += roaring.Successor(val); });
+            benchSink = sum;
+        }));
+    }
+}
+
+void BenchSetVEB() {
+    PrintHeader("SetVEB vs SetVec<unsigned int> (ns per operazione)", "SetVec", "SetVEB");
+
+    const unsigned long probes = 1UL << 18;
+    for (unsigned long n = 1UL << 14; n <= 1UL << 22; n <<= 4) {
+        Vector<unsigned int> values(n);
+        for (unsigned long i = 0; i < n; ++i)
+            values[i] = static_cast<unsigned int>(benchRandom());
+        SetVec<unsigned int> vec(values);
+        SetVEB veb(values);
+        const unsigned long vecBytes = std::bit_ceil(vec.Size()) * sizeof(unsigned int);
+        const unsigned long vebBytes = veb.MemoryBytes();
+
+        Vector<unsigned int> queries(probes);
+        for (unsigned long i = 0; i < probes; ++i)
+            queries[i] = static_cast<unsigned int>(benchRandom());
+        queries.Map([&](unsigned int& val) { val = std::max(val, vec.Min() + 1); });
+
+        const std::string size = ", n = " + std::to_string(n);
+        PrintRow("Predecessor" + size, NsPerOp(probes, [&] {
+            long sum = 0;
+            queries.Traverse([&](const unsigned int& val) { sum += vec.Predecessor(val); });
+            benchSink = sum;
+        }), NsPerOp(probes, [&] {
+            long sum = 0;
+            queries.Traverse([&](const unsigned int& val) { sum += veb.Predecessor(val); });
+            benchSink = sum;
+        }));
+        PrintRow("Successor" + size, NsPerOp(probes, [&] {
+            long sum = 0;
+            queries.Traverse([&](const unsigned int& val) { if (val < vec.Max()) sum += vec.Successor(val); });
+            benchSink = sum;
+        }), NsPerOp(probes, [&] {
+            long sum = 0;
+            queries.Traverse([&](const unsigned int& val) { if (val < veb.Max()) sum += veb.Successor(val); });
+            benchSink = sum;
+        }));
+        PrintRow("Exists" + size, NsPerOp(probes, [&] {
+            long hits = 0;
+            queries.Traverse([&](const unsigned int& val) { hits += vec.Exists(val); });
+            benchSink = hits;
+        }), NsPerOp(probes, [&] {
+            long hits = 0;
+            queries.Traverse([&](const unsigned int& val) { hits += veb.Exists(val); });
+            benchSink = hits;
+        }));
+
+        // Inserimenti casuali su un insieme gia' grande: SetVec sposta meta' buffer in media
+        const unsigned long inserts = 1UL << 11;
+        PrintRow("Insert + Remove" + size, NsPerOp(2 * inserts, [&] {
+            for (unsigned long i = 0; i < inserts; ++i) vec.Insert(queries[i]);
+            for (unsigned long i = 0; i < inserts; ++i) vec.Remove(queries[i]);
+        }), NsPerOp(2 * inserts, [&] {
+            for (unsigned long i = 0; i < inserts; ++i) veb.Insert(queries[i]);
+            for (unsigned long i = 0; i < inserts; ++i) veb.Remove(queries[i]);
+        }));
+        std::cout << "  memoria: SetVec " << vecBytes << " B, SetVEB " << vebBytes << " B" << std::endl;
+    }
+}
+
+void BenchSetPMA() {
+    PrintHeader("SetPMA vs SetVec<int> (ns per operazione)", "SetVec", "SetPMA");
+
+    const unsigned long probes = 1UL << 18;
+    for (unsigned long n = 1UL << 14; n <= 1UL << 22; n <<= 4) {
+        Vector<int> values(n);
+        for (unsigned long i = 0; i < n; ++i)
+            values[i] = static_cast<int>(benchRandom() >> 1);
+        SetVec<int> vec(values);
+        SetPMA<int> pma(values);
+
+        Vector<int> queries(probes);
+        for (unsigned long i = 0; i < probes; ++i)
+            queries[i] = static_cast<int>(benchRandom() >> 1);
+
+        const std::string size = ", n = " + std::to_string(n);
+        // Inserimenti casuali su un insieme gia' grande: SetVec sposta meta' buffer in media
+        const unsigned long inserts = 1UL << 11;
+        PrintRow("Insert + Remove" + size, NsPerOp(2 * inserts, [&] {
+            for (unsigned long i = 0; i < inserts; ++i) vec.Insert(queries[i]);
+            for (unsigned long i = 0; i < inserts; ++i) vec.Remove(queries[i]);
+        }), NsPerOp(2 * inserts, [&] {
+            for (unsigned long i = 0; i < inserts; ++i) pma.Insert(queries[i]);
+            for (unsigned long i = 0; i < inserts; ++i) pma.Remove(queries[i]);
+        }));
+        PrintRow("Exists" + size, NsPerOp(probes, [&] {
+            long hits = 0;
+            queries.Traverse([&](const int& val) { hits += vec.Exists(val); });
+            benchSink = hits;
+        }), NsPerOp(probes, [&] {
+            long hits = 0;
+            queries.Traverse([&](const int& val) { hits += pma.Exists(val); });
+            benchSink = hits;
+        }));
+        PrintRow("Traverse (per valore)" + size, NsPerOp(vec.Size(), [&] {
+            long sum = 0;
+            vec.Traverse([&](const int& val) { sum += val; });
+            benchSink = sum;
+        }), NsPerOp(pma.Size(), [&] {
+            long sum = 0;
+            pma.Traverse([&](const int& val) { sum += val; });
+            benchSink = sum;
+        }));
+        std::cout << "  slot: SetVec " << std::bit_ceil(vec.Size()) << ", SetPMA " << pma.Capacity() << std::endl;
+    }
+}
+
+void RunAllBenchmarks() {
+    BenchFlatContainers();
+    BenchFoldInPlace();
+    BenchSetVecBulkInsert();
+    BenchSetVecBulkRemove();
+    BenchSetAlgebra();
+    BenchRangeQueries();
+    BenchSetVecNeighbours();
+    BenchSetVecCircular();
+    BenchSetVecSegments();
+    BenchSetVecSearchIndex();
+    BenchSetLstSkipIndex();
+    BenchSnapshot();
+    BenchOrderedMap();
+    BenchExistsBatch();
+    BenchSetRoaring();
+    BenchSetVEB();
+    BenchSetPMA();
+    BenchSetAVL();
+    BenchSetBTree();
+    BenchSetHash();
+    BenchBloomSet();
+    BenchConcurrentSetSkip();
+    BenchShardedDictionary();
+    std::cout << std::endl;
+}
+
+/* ************************************************************************** */
+
+}
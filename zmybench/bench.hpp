@@ -0,0 +1,11 @@
+
+#ifndef MYBENCH_HPP
+#define MYBENCH_HPP
+
+namespace lasd {
+
+void RunAllBenchmarks();
+
+}
+
+#endif
@@ -10,16 +10,46 @@
 #include "../list/list.hpp"
 #include "../set/lst/setlst.hpp"
 #include "../set/vec/setvec.hpp"
+#include "../set/avl/setavl.hpp"
+#include "../set/btree/setbtree.hpp"
+#include "../set/hash/sethash.hpp"
+#include "../set/bloom/bloomset.hpp"
+#include "../set/roaring/setroaring.hpp"
+#include "../set/veb/setveb.hpp"
+#include "../set/pma/setpma.hpp"
 #include "../set/set.hpp"
 
+#include "../concurrent/skip/concurrentsetskip.hpp"
+#include "../concurrent/sharded/shardeddictionary.hpp"
+
+#include "../map/vec/orderedmap.hpp"
+
 
 #include "../heap/heap.hpp"
 #include "../heap/vec/heapvec.hpp"
 #include "../pq/pq.hpp"
 #include "../pq/heap/pqheap.hpp"
 
+#include "../view/view.hpp"
+
+#include "../flat/vector/flatvector.hpp"
+#include "../flat/list/flatlist.hpp"
+#include "../flat/setvec/flatsetvec.hpp"
+#include "../flat/heapvec/flatheapvec.hpp"
+
+#include <algorithm>
+#include <atomic>
 #include <iostream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <ranges>
 #include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
 
 namespace lasd {
 
@@ -2334,6 +2364,865 @@ void TestSetVecString() {
     std::cout << std::endl;
 }
 
+void TestIteratorsAndRanges() {
+    std::cout << "==== Test Iteratori e Range ====" << std::endl;
+
+    static_assert(std::contiguous_iterator<lasd::Vector<int>::iterator>);
+    static_assert(std::ranges::contiguous_range<lasd::Vector<int>>);
+    static_assert(std::random_access_iterator<lasd::SetVec<int>::const_iterator>);
+    static_assert(std::ranges::random_access_range<const lasd::SetVec<int>>);
+    static_assert(std::forward_iterator<lasd::List<int>::iterator>);
+    static_assert(std::forward_iterator<lasd::List<int>::const_iterator>);
+    static_assert(std::ranges::forward_range<const lasd::SetLst<int>>);
+
+    // Vector: costruzione da range e algoritmi standard
+    std::vector<int> src = {5, 3, 9, 1, 7};
+    lasd::Vector<int> vec(src);
+    Check(vec.Size() == 5 && vec[0] == 5 && vec[4] == 7, "Vector da std::vector");
+    Check(std::accumulate(vec.begin(), vec.end(), 0) == 25, "Vector accumulate su iteratori");
+    std::ranges::sort(vec);
+    Check(vec[0] == 1 && vec[4] == 9, "Vector std::ranges::sort");
+    int sum = 0;
+    for (const int& x : vec) sum += x;
+    Check(sum == 25, "Vector range-for");
+
+    lasd::Vector<int> iota(std::views::iota(0, 4));
+    Check(iota.Size() == 4 && iota[3] == 3, "Vector da views::iota");
+
+    lasd::Vector<int> filtered(src | std::views::filter([](int x) { return x > 4; }));
+    Check(filtered.Size() == 3 && filtered[0] == 5 && filtered[2] == 7, "Vector da range non sized");
+
+    lasd::Vector<int> empty(std::vector<int>{});
+    Check(empty.Empty() && empty.begin() == empty.end(), "Vector da range vuoto");
+
+    // Vector<string>: elementi prvalue spostati
+    lasd::Vector<std::string> strs(std::views::iota(1, 4) | std::views::transform([](int x) { return std::to_string(x); }));
+    Check(strs.Size() == 3 && strs[2] == "3", "Vector<string> da transform");
+
+    // List
+    lasd::List<int> lst(src);
+    Check(lst.Size() == 5 && lst.Front() == 5 && lst.Back() == 7, "List da std::vector");
+    for (int& x : lst) x *= 2;
+    Check(lst[1] == 6, "List iteratore mutabile");
+    Check(std::ranges::find(lst, 18) != lst.end(), "List std::ranges::find");
+    const lasd::List<int>& clst = lst;
+    Check(std::distance(clst.begin(), clst.end()) == 5, "List const_iterator distance");
+
+    // SetVec: iteratore random-access sul buffer circolare
+    lasd::SetVec<int> setvec(std::vector<int>{4, 2, 8, 2, 6});
+    Check(setvec.Size() == 4, "SetVec da range con duplicati");
+    Check(std::ranges::is_sorted(setvec), "SetVec range ordinato");
+    Check(*(setvec.begin() + 2) == 6 && setvec.end()[-1] == 8, "SetVec aritmetica iteratori");
+    Check(*std::ranges::lower_bound(setvec, 5) == 6, "SetVec std::ranges::lower_bound");
+    setvec.RemoveMin();
+    setvec.Insert(1);
+    Check(std::ranges::equal(setvec, std::vector<int>{1, 4, 6, 8}), "SetVec ranges::equal dopo modifiche");
+
+    Check(setvec.InsertAll(std::vector<int>{10, 12}), "SetVec InsertAll da range");
+    Check(!setvec.InsertAll(std::vector<int>{12, 14}), "SetVec InsertAll da range con duplicato");
+    Check(setvec.InsertSome(std::views::iota(13, 16)), "SetVec InsertSome da views::iota");
+    Check(setvec.Size() == 9 && setvec.Max() == 15, "SetVec dopo InsertAll/InsertSome");
+
+    // SetLst
+    lasd::SetLst<std::string> setlst(std::vector<std::string>{"pera", "mela", "kiwi", "mela"});
+    Check(setlst.Size() == 3 && *setlst.begin() == "kiwi", "SetLst da range con duplicati");
+    Check(std::ranges::is_sorted(setlst), "SetLst range ordinato");
+    Check(setlst.InsertAll(std::vector<std::string>{"uva"}), "SetLst InsertAll da range");
+    Check(!setlst.InsertSome(std::vector<std::string>{"uva", "pera"}), "SetLst InsertSome senza nuovi valori");
+    std::string concat;
+    for (const std::string& str : setlst) concat += str;
+    Check(concat == "kiwimelaperauva", "SetLst range-for");
+
+    std::cout << std::endl;
+}
+
+void TestFlatContainers() {
+    std::cout << "==== Test contenitori flat (FlatVector, FlatList, FlatSetVec) ====" << std::endl;
+
+    static_assert(!std::is_polymorphic_v<lasd::FlatVector<int>>);
+    static_assert(std::is_final_v<lasd::FlatSetVec<int>>);
+    static_assert(sizeof(lasd::FlatVector<int>) < sizeof(lasd::Vector<int>));
+
+    // FlatVector: stessa API di Vector
+    lasd::FlatVector<int> vec(5);
+    for (unsigned long i = 0; i < 5; ++i) vec[i] = 5 - i;
+    Check(vec.Size() == 5 && vec.Front() == 5 && vec.Back() == 1, "FlatVector Size/Front/Back");
+    Check(vec.Exists(3) && !vec.Exists(42), "FlatVector Exists");
+    Check(vec.Fold<int>([](const int& val, const int& acc) { return acc + val; }, 0) == 15, "FlatVector Fold");
+    int post = 0;
+    vec.PostOrderTraverse([&post](const int& val) { post = post * 10 + val; });
+    Check(post == 12345, "FlatVector PostOrderTraverse");
+    vec.Map([](int& val) { val *= 2; });
+    vec.Sort();
+    Check(vec[0] == 2 && vec[4] == 10, "FlatVector Map + Sort");
+    bool thrown = false;
+    try { vec[5]; } catch (std::out_of_range&) { thrown = true; }
+    Check(thrown, "FlatVector operator[] fuori range");
+
+    lasd::Vector<int> orig(3);
+    orig[0] = 1; orig[1] = 2; orig[2] = 3;
+    lasd::FlatVector<int> fromOrig(orig);
+    lasd::FlatVector<int> copy(fromOrig);
+    Check(copy == fromOrig && copy[2] == 3, "FlatVector da TraversableContainer e copia");
+    copy.Resize(1);
+    Check(copy != fromOrig && copy.Size() == 1, "FlatVector Resize");
+
+    // FlatList: stessa API di List
+    lasd::FlatList<std::string> lst;
+    lst.InsertAtBack("b");
+    lst.InsertAtFront("a");
+    lst.InsertAtBack("c");
+    Check(lst.Size() == 3 && lst[1] == "b", "FlatList inserimenti");
+    std::string rev;
+    lst.PostOrderTraverse([&rev](const std::string& str) { rev += str; });
+    Check(rev == "cba", "FlatList PostOrderTraverse");
+    Check(lst.FrontNRemove() == "a" && lst.BackNRemove() == "c" && lst.Size() == 1, "FlatList FrontNRemove/BackNRemove");
+    lasd::FlatList<std::string> lst2(lst);
+    Check(lst2 == lst, "FlatList copy constructor");
+    lst.Clear();
+    thrown = false;
+    try { lst.RemoveFromFront(); } catch (std::length_error&) { thrown = true; }
+    Check(thrown && lst.Empty(), "FlatList RemoveFromFront su vuota");
+
+    // FlatSetVec: stessa API di SetVec
+    lasd::FlatSetVec<int> set(std::vector<int>{5, -10, 3, 5, 8});
+    Check(set.Size() == 4 && set.Min() == -10 && set.Max() == 8, "FlatSetVec da range con duplicati");
+    Check(set.Insert(0) && !set.Insert(3), "FlatSetVec Insert");
+    Check(set.Predecessor(3) == 0 && set.Successor(3) == 5, "FlatSetVec Predecessor/Successor");
+    Check(set.PredecessorNRemove(1) == 0 && !set.Exists(0), "FlatSetVec PredecessorNRemove");
+    Check(set.SuccessorNRemove(5) == 8 && set.Max() == 5, "FlatSetVec SuccessorNRemove");
+    Check(set.Remove(-10) && !set.Remove(-10), "FlatSetVec Remove");
+    Check(!set.InsertAll(orig) && set.Size() == 4, "FlatSetVec InsertAll da Vector (3 duplicato)");
+    Check(!set.RemoveAll(std::vector<int>{1, 99}) && set.RemoveSome(std::vector<int>{2, 98}), "FlatSetVec RemoveAll/RemoveSome");
+    thrown = false;
+    try { set.Successor(5); } catch (std::length_error&) { thrown = true; }
+    Check(thrown, "FlatSetVec Successor inesistente");
+    lasd::FlatSetVec<int> set2;
+    set2 = set;
+    Check(set2 == set && set2.MinNRemove() == 3 && set2 != set, "FlatSetVec copy assignment");
+
+    std::cout << std::endl;
+}
+
+void TestViews() {
+    std::cout << "==== Test MapView / FilterView / TakeView ====" << std::endl;
+
+    lasd::Vector<int> vec(8);
+    for (unsigned long i = 0; i < 8; ++i) vec[i] = 8 - i; // 8, 7, ..., 1
+
+    // FilterView
+    lasd::FilterView even(vec, [](const int& x) { return x % 2 == 0; });
+    Check(even.Size() == 4 && !even.Empty(), "FilterView Size/Empty");
+    Check(even.Exists(6) && !even.Exists(7), "FilterView Exists");
+    Check(even.Fold<int>([](const int& val, const int& acc) { return acc + val; }, 0) == 20, "FilterView Fold");
+
+    lasd::FilterView none(vec, [](const int& x) { return x > 100; });
+    Check(none.Empty() && none.Size() == 0, "FilterView vuota");
+
+    // MapView (cambio di tipo dedotto)
+    lasd::MapView names(vec, [](const int& x) { return std::to_string(x * 10); });
+    Check(names.Size() == 8 && names.Exists("30") && !names.Exists("3"), "MapView<int, string>");
+
+    // TakeView
+    lasd::TakeView firsts(vec, 3);
+    Check(firsts.Size() == 3, "TakeView Size");
+    int sum = 0;
+    firsts.Traverse([&sum](const int& x) { sum += x; });
+    Check(sum == 8 + 7 + 6, "TakeView Traverse");
+    lasd::TakeView all(vec, 100);
+    Check(all.Size() == 8, "TakeView oltre la size");
+
+    // Composizione: un solo passaggio sulla sorgente, nessun Vector intermedio
+    unsigned long calls = 0;
+    lasd::FilterView large(vec, [](const int& x) { return x > 3; });
+    lasd::SetVec<int> set(lasd::MapView(large, [&calls](const int& x) { ++calls; return x % 3; }));
+    Check(set.Size() == 3 && set.Min() == 0 && set.Max() == 2, "SetVec(MapView(FilterView))");
+    Check(calls == 5, "Composizione fusa: mappa chiamata una volta per elemento accettato");
+
+    lasd::FilterView odd(vec, [](const int& x) { return x % 2 == 1; });
+    lasd::HeapVec<int> heap(lasd::TakeView(odd, 2));
+    Check(heap.Size() == 2 && heap.IsHeap() && heap[0] == 7, "HeapVec(TakeView(FilterView))");
+
+    // Una sorgente temporanea non puo' essere legata a una vista
+    static_assert(!std::is_constructible_v<lasd::TakeView<int>, lasd::Vector<int>&&, unsigned long>);
+    static_assert(!std::is_constructible_v<lasd::FilterView<int>, lasd::FilterView<int>&&, lasd::FilterView<int>::FilterViewFun>);
+    static_assert(std::is_constructible_v<lasd::TakeView<int>, lasd::FilterView<int>&, unsigned long>);
+
+    // Size ed Empty restano noexcept anche sulle viste impilate
+    lasd::MapView<int, int> doubled(odd, [](const int& x) { return 2 * x; });
+    static_assert(noexcept(doubled.Size()) && noexcept(odd.Empty()));
+    Check(doubled.Size() == odd.Size() && !doubled.Empty(), "MapView(FilterView) Size/Empty");
+
+    // La vista riflette le modifiche della sorgente
+    vec[0] = 100;
+    Check(even.Exists(100) && !even.Exists(8), "Vista pigra segue la sorgente");
+
+    std::cout << std::endl;
+}
+
+void TestFoldInPlace() {
+    std::cout << "==== Test FoldInPlace / PreOrderFoldInPlace / PostOrderFoldInPlace ====" << std::endl;
+
+    lasd::Vector<std::string> vec(3);
+    vec[0] = "a"; vec[1] = "b"; vec[2] = "c";
+
+    auto append = [](std::string& acc, const std::string& str) { acc += str; };
+    Check(vec.FoldInPlace<std::string>(append, ">") == ">abc", "Vector FoldInPlace");
+    Check(vec.PreOrderFoldInPlace<std::string>(append, "") == "abc", "Vector PreOrderFoldInPlace");
+    Check(vec.PostOrderFoldInPlace<std::string>(append, "") == "cba", "Vector PostOrderFoldInPlace");
+
+    // Stesso risultato di Fold
+    std::string folded = vec.Fold<std::string>([](const std::string& str, const std::string& acc) { return acc + str; }, "");
+    Check(folded == vec.FoldInPlace<std::string>(append, ""), "FoldInPlace coerente con Fold");
+
+    lasd::List<std::string> lst(vec);
+    Check(lst.PostOrderFoldInPlace<std::string>(append, "") == "cba", "List PostOrderFoldInPlace");
+
+    lasd::SetLst<int> setlst(std::vector<int>{3, 1, 2});
+    Check(setlst.FoldInPlace<int>([](int& acc, const int& x) { acc = acc * 10 + x; }, 0) == 123, "SetLst FoldInPlace");
+
+    // Accumulatore contenitore: nessuna copia per elemento
+    lasd::SetVec<int> setvec(std::vector<int>{5, 4, 6});
+    lasd::List<int> collected = setvec.PostOrderFoldInPlace<lasd::List<int>>([](lasd::List<int>& acc, const int& x) {
+        acc.InsertAtBack(x);
+    }, lasd::List<int>());
+    Check(collected.Size() == 3 && collected.Front() == 6 && collected.Back() == 4, "SetVec PostOrderFoldInPlace su List");
+
+    lasd::FlatVector<int> fvec(std::vector<int>{1, 2, 3});
+    Check(fvec.PostOrderFoldInPlace<int>([](int& acc, const int& x) { acc = acc * 10 + x; }, 0) == 321, "FlatVector PostOrderFoldInPlace");
+
+    std::cout << std::endl;
+}
+
+void TestSetVecBulkInsert() {
+    std::cout << "==== Test SetVec InsertAll / InsertSome (sort + merge) ====" << std::endl;
+
+    // Batch grande con duplicati interni: passa per il merge
+    lasd::Vector<int> batch(40);
+    for (unsigned long i = 0; i < 40; ++i) batch[i] = static_cast<int>((i * 17) % 20); // 0..19, ognuno due volte
+
+    lasd::SetVec<int> set;
+    set.Insert(5); set.Insert(100); set.Insert(-3);
+    Check(!set.InsertAll(batch), "InsertAll con duplicati nel batch -> false");
+    Check(set.Size() == 22 && set.Min() == -3 && set.Max() == 100, "InsertAll merge Size/Min/Max");
+    bool sorted = true;
+    for (unsigned long i = 1; i < set.Size(); ++i) sorted &= set[i - 1] < set[i];
+    Check(sorted, "InsertAll merge mantiene l'ordine");
+
+    Check(!set.InsertSome(batch), "InsertSome tutti presenti -> false");
+    Check(set.Size() == 22, "InsertSome tutti presenti non modifica");
+
+    lasd::Vector<int> fresh(20);
+    for (unsigned long i = 0; i < 20; ++i) fresh[i] = 200 + static_cast<int>(i);
+    Check(set.InsertAll(fresh), "InsertAll tutti nuovi -> true");
+    Check(set.Size() == 42 && set.Max() == 219, "InsertAll tutti nuovi Size/Max");
+
+    // InsertSome continua dopo il primo inserimento
+    lasd::Vector<int> mixed(3);
+    mixed[0] = 500; mixed[1] = 5; mixed[2] = 501;
+    Check(set.InsertSome(mixed) && set.Exists(500) && set.Exists(501), "InsertSome inserisce tutti i nuovi");
+
+    // Costruttori
+    lasd::SetVec<int> built(batch);
+    Check(built.Size() == 20 && built.Min() == 0 && built.Max() == 19, "SetVec(TraversableContainer) bulk");
+    lasd::SetVec<int> copied(built);
+    Check(copied == built, "Copy constructor");
+
+    lasd::Vector<std::string> words(30);
+    for (unsigned long i = 0; i < 30; ++i) words[i] = std::string("w") + std::to_string(i % 25);
+    lasd::SetVec<std::string> moved(std::move(words));
+    Check(moved.Size() == 25 && moved.Min() == "w0" && moved.Max() == "w9", "SetVec(MappableContainer&&) bulk");
+
+    // Range e vista filtrata (Size() della vista non serve)
+    lasd::SetVec<int> ranged(std::vector<int>{9, 3, 3, 7, 1, 9, 2, 8, 6, 5, 4, 0, 10, 11, 12, 13, 14, 15});
+    Check(ranged.Size() == 16 && ranged.Min() == 0 && ranged.Max() == 15, "SetVec(Range) bulk");
+    Check(!ranged.InsertAll(std::vector<int>{1, 2, 3}) && ranged.InsertSome(std::vector<int>{1, 99}), "InsertAll/InsertSome su range");
+
+    lasd::SetVec<int> evens(lasd::FilterView(batch, [](const int& x) { return x % 2 == 0; }));
+    Check(evens.Size() == 10 && evens.Max() == 18, "SetVec(FilterView) bulk");
+
+    // Batch piccolo: percorso per singolo elemento
+    lasd::SetVec<int> small;
+    Check(small.InsertAll(std::vector<int>{3, 1, 2}) && small.Size() == 3 && small[0] == 1, "InsertAll batch piccolo");
+    Check(!small.InsertAll(std::vector<int>{4, 4}) && small.Size() == 4, "InsertAll batch piccolo con duplicati");
+
+    std::cout << std::endl;
+}
+
+void TestSetVecBulkRemove() {
+    std::cout << "==== Test SetVec RemoveAll / RemoveSome (compattazione) ====" << std::endl;
+
+    lasd::Vector<int> all(100);
+    for (unsigned long i = 0; i < 100; ++i) all[i] = static_cast<int>(i);
+
+    // Rimozione dei pari (50 valori, batch grande)
+    lasd::Vector<int> evens(50);
+    for (unsigned long i = 0; i < 50; ++i) evens[i] = static_cast<int>(98 - 2 * i);
+    lasd::SetVec<int> set(all);
+    Check(set.RemoveAll(evens), "RemoveAll tutti presenti -> true");
+    Check(set.Size() == 50 && set.Min() == 1 && set.Max() == 99, "RemoveAll Size/Min/Max");
+    bool odd = true;
+    for (unsigned long i = 0; i < set.Size(); ++i) odd &= (set[i] == static_cast<int>(2 * i + 1));
+    Check(odd, "RemoveAll compatta in ordine");
+
+    Check(!set.RemoveSome(evens) && set.Size() == 50, "RemoveSome nessuno presente -> false");
+
+    // Batch con duplicati e valori assenti
+    lasd::Vector<int> mixed(20);
+    for (unsigned long i = 0; i < 20; ++i) mixed[i] = static_cast<int>(i / 2) * 3; // 0,0,3,3,...,27,27
+    Check(!set.RemoveAll(mixed), "RemoveAll con assenti/duplicati -> false");
+    Check(set.Size() == 45 && !set.Exists(3) && !set.Exists(27) && set.Exists(1), "RemoveAll rimuove solo i presenti");
+
+    // RemoveSome prosegue oltre il primo
+    lasd::Vector<int> some(3);
+    some[0] = 1; some[1] = 1000; some[2] = 99;
+    Check(set.RemoveSome(some) && !set.Exists(1) && !set.Exists(99) && set.Size() == 43, "RemoveSome rimuove tutti i presenti");
+
+    // Svuotamento completo e shrink unico
+    lasd::SetVec<int> full(all);
+    Check(full.RemoveAll(all) && full.Empty() && full.Size() == 0, "RemoveAll svuota");
+    Check(full.Insert(7) && full.Size() == 1 && full.Min() == 7, "Reinserimento dopo svuotamento");
+
+    // Testa: rimozione di un prefisso
+    lasd::SetVec<int> prefix(all);
+    lasd::Vector<int> firsts(30);
+    for (unsigned long i = 0; i < 30; ++i) firsts[i] = static_cast<int>(i);
+    Check(prefix.RemoveAll(firsts) && prefix.Size() == 70 && prefix[0] == 30 && prefix.Max() == 99, "RemoveAll prefisso");
+
+    std::cout << std::endl;
+}
+
+template <typename Set>
+bool SameAsNaive(const Set& got, const Set& a, const Set& b, bool onlyA, bool both, bool onlyB) {
+    // Riferimento: Exists dentro Traverse
+    unsigned long expected = 0;
+    bool ok = true;
+    a.Traverse([&](const int& x) {
+        bool keep = b.Exists(x) ? both : onlyA;
+        expected += keep;
+        ok &= (keep == got.Exists(x));
+    });
+    b.Traverse([&](const int& x) {
+        if (!a.Exists(x)) {
+            expected += onlyB;
+            ok &= (onlyB == got.Exists(x));
+        }
+    });
+    for (unsigned long i = 1; i < got.Size(); ++i) ok &= got[i - 1] < got[i];
+    return ok && got.Size() == expected;
+}
+
+void TestSetAlgebra() {
+    std::cout << "==== Test Union / Intersection / Difference / SymmetricDifference ====" << std::endl;
+
+    // Multipli di 2 e di 3 (dimensioni simili: merge, kernel SIMD per int)
+    lasd::Vector<int> twos(300), threes(200);
+    for (unsigned long i = 0; i < 300; ++i) twos[i] = static_cast<int>(2 * i);
+    for (unsigned long i = 0; i < 200; ++i) threes[i] = static_cast<int>(3 * i);
+    lasd::SetVec<int> vecA(twos), vecB(threes);
+    lasd::SetLst<int> lstA(twos), lstB(threes);
+
+    Check(SameAsNaive(vecA.Union(vecB), vecA, vecB, true, true, true), "SetVec Union");
+    Check(SameAsNaive(vecA.Intersection(vecB), vecA, vecB, false, true, false), "SetVec Intersection");
+    Check(vecA.Intersection(vecB).Size() == 100 && vecA.Intersection(vecB).Max() == 594, "SetVec Intersection multipli di 6");
+    Check(SameAsNaive(vecA.Difference(vecB), vecA, vecB, true, false, false), "SetVec Difference");
+    Check(SameAsNaive(vecA.SymmetricDifference(vecB), vecA, vecB, true, false, true), "SetVec SymmetricDifference");
+
+    Check(SameAsNaive(lstA.Union(lstB), lstA, lstB, true, true, true), "SetLst Union");
+    Check(SameAsNaive(lstA.Intersection(lstB), lstA, lstB, false, true, false), "SetLst Intersection");
+    Check(SameAsNaive(lstA.Difference(lstB), lstA, lstB, true, false, false), "SetLst Difference");
+    Check(SameAsNaive(lstA.SymmetricDifference(lstB), lstA, lstB, true, false, true), "SetLst SymmetricDifference");
+
+    // Dimensioni sbilanciate: ricerca esponenziale
+    lasd::SetVec<int> few(std::vector<int>{-1, 0, 7, 300, 599, 1000});
+    Check(SameAsNaive(few.Intersection(vecA), few, vecA, false, true, false), "SetVec Intersection sbilanciata");
+    Check(SameAsNaive(vecA.Intersection(few), vecA, few, false, true, false), "SetVec Intersection sbilanciata (simmetrica)");
+    Check(SameAsNaive(vecA.Difference(few), vecA, few, true, false, false), "SetVec Difference sbilanciata");
+    Check(vecA.Difference(few).Size() == 298, "SetVec Difference sbilanciata Size");
+
+    // Casi limite
+    lasd::SetVec<int> emptyVec;
+    Check(vecA.Intersection(emptyVec).Empty() && emptyVec.Difference(vecA).Empty(), "SetVec con insieme vuoto");
+    Check(vecA.Union(emptyVec) == vecA && vecA.Difference(emptyVec) == vecA, "SetVec Union/Difference con vuoto");
+    Check(vecA.SymmetricDifference(vecA).Empty() && vecA.Intersection(vecA) == vecA, "SetVec con se stesso");
+    lasd::SetLst<int> emptyLst;
+    Check(lstA.Union(emptyLst) == lstA && lstA.Intersection(emptyLst).Empty(), "SetLst con insieme vuoto");
+
+    // Tipo non int: percorso scalare
+    lasd::SetVec<std::string> wordsA(std::vector<std::string>{"a", "b", "c", "d", "e", "f"});
+    lasd::SetVec<std::string> wordsB(std::vector<std::string>{"b", "d", "f", "h"});
+    lasd::SetVec<std::string> common = wordsA.Intersection(wordsB);
+    Check(common.Size() == 3 && common[0] == "b" && common[2] == "f", "SetVec<string> Intersection");
+    Check(wordsA.Union(wordsB).Size() == 7 && wordsB.Difference(wordsA).Min() == "h", "SetVec<string> Union/Difference");
+
+    // Il risultato resta un insieme utilizzabile
+    lasd::SetVec<int> inter = vecA.Intersection(vecB);
+    Check(inter.Insert(1) && inter.Min() == 0 && inter.Remove(594) && inter.Max() == 588, "Risultato modificabile");
+
+    std::cout << std::endl;
+}
+
+void TestRangeQueries(lasd::OrderedDictionaryContainer<int>& set, const std::string& name) {
+    // Insieme atteso: multipli di 5 in [0, 100)
+    Check(set.LowerBound(10) == 10 && set.LowerBound(11) == 15 && set.LowerBound(-7) == 0, name + " LowerBound");
+    Check(set.UpperBound(10) == 15 && set.UpperBound(11) == 15, name + " UpperBound");
+    bool thrown = false;
+    try { set.LowerBound(96); } catch (std::length_error&) { thrown = true; }
+    Check(thrown, name + " LowerBound oltre il massimo -> length_error");
+    thrown = false;
+    try { set.UpperBound(95); } catch (std::length_error&) { thrown = true; }
+    Check(thrown, name + " UpperBound del massimo -> length_error");
+
+    std::string seen;
+    set.RangeTraverse(12, 31, [&seen](const int& x) { seen += std::to_string(x) + " "; });
+    Check(seen == "15 20 25 30 ", name + " RangeTraverse");
+    Check(set.RangeCount(10, 30) == 4 && set.RangeCount(-100, 1000) == 20, name + " RangeCount");
+    Check(set.RangeCount(30, 10) == 0 && set.RangeCount(11, 14) == 0, name + " RangeCount intervalli vuoti");
+
+    Check(set.RangeRemove(20, 50) == 6, name + " RangeRemove");
+    Check(set.Size() == 14 && !set.Exists(20) && !set.Exists(45) && set.Exists(50) && set.Exists(15), name + " RangeRemove contenuto");
+    Check(set.Successor(15) == 50 && set.Predecessor(50) == 15, name + " RangeRemove ordine preservato");
+    Check(set.RangeRemove(20, 50) == 0 && set.RangeRemove(60, 60) == 0, name + " RangeRemove senza effetto");
+    Check(set.RangeRemove(90, 1000) == 2 && set.Max() == 85, name + " RangeRemove coda");
+    Check(set.RangeRemove(-5, 10) == 2 && set.Min() == 10, name + " RangeRemove testa");
+    Check(set.Insert(95) && set.Max() == 95, name + " Insert dopo RangeRemove");
+    Check(set.RangeRemove(0, 1000) == 11 && set.Size() == 0, name + " RangeRemove totale");
+    Check(set.Insert(3) && set.Min() == 3 && set.Max() == 3, name + " Insert dopo svuotamento");
+}
+
+void TestRangeQueries() {
+    std::cout << "==== Test LowerBound / UpperBound / RangeTraverse / RangeCount / RangeRemove ====" << std::endl;
+
+    lasd::Vector<int> fives(20);
+    for (unsigned long i = 0; i < 20; ++i) fives[i] = static_cast<int>(5 * (19 - i));
+
+    lasd::SetVec<int> vec(fives);
+    TestRangeQueries(vec, "SetVec");
+    lasd::SetLst<int> lst(fives);
+    TestRangeQueries(lst, "SetLst");
+
+    lasd::SetVec<std::string> words(std::vector<std::string>{"ape", "bue", "cane", "gatto", "lupo"});
+    Check(words.RangeCount("b", "h") == 3 && words.LowerBound("d") == "gatto", "SetVec<string> range");
+
+    std::cout << std::endl;
+}
+
+void TestSetVecNeighbours() {
+    std::cout << "==== Test SetVec Predecessor / Successor (ricerca binaria) ====" << std::endl;
+
+    // Confronto con SetLst su valori pseudo-casuali
+    lasd::SetVec<int> vec;
+    lasd::SetLst<int> lst;
+    unsigned long seed = 12345;
+    bool sameInsert = true;
+    for (unsigned long i = 0; i < 300; ++i) {
+        seed = seed * 1103515245 + 12345;
+        const int val = static_cast<int>((seed >> 8) % 1000);
+        sameInsert &= (vec.Insert(val) == lst.Insert(val));
+    }
+    Check(sameInsert && vec.Size() == lst.Size(), "Insert(const Data&) coerente con SetLst");
+
+    bool same = true;
+    for (int probe = -2; probe <= 1001; ++probe) {
+        bool vecThrows = false, lstThrows = false;
+        int vecVal = 0, lstVal = 0;
+        try { vecVal = vec.Predecessor(probe); } catch (std::length_error&) { vecThrows = true; }
+        try { lstVal = lst.Predecessor(probe); } catch (std::length_error&) { lstThrows = true; }
+        same &= (vecThrows == lstThrows) && (vecThrows || vecVal == lstVal);
+        vecThrows = lstThrows = false;
+        try { vecVal = vec.Successor(probe); } catch (std::length_error&) { vecThrows = true; }
+        try { lstVal = lst.Successor(probe); } catch (std::length_error&) { lstThrows = true; }
+        same &= (vecThrows == lstThrows) && (vecThrows || vecVal == lstVal);
+    }
+    Check(same, "Predecessor/Successor coerenti con SetLst");
+
+    bool sameRemove = true;
+    for (int probe = 0; probe < 1000; probe += 37) {
+        if (vec.Size() > 2 && probe > vec.Min()) sameRemove &= (vec.PredecessorNRemove(probe) == lst.PredecessorNRemove(probe));
+        if (vec.Size() > 2 && probe < vec.Max()) sameRemove &= (vec.SuccessorNRemove(probe) == lst.SuccessorNRemove(probe));
+    }
+    Check(sameRemove && vec.Size() == lst.Size(), "PredecessorNRemove/SuccessorNRemove coerenti con SetLst");
+
+    // Casi limite
+    lasd::SetVec<int> one(std::vector<int>{5});
+    bool thrown = false;
+    try { one.PredecessorNRemove(5); } catch (std::length_error&) { thrown = true; }
+    Check(thrown && one.Size() == 1, "PredecessorNRemove del minimo -> length_error");
+    thrown = false;
+    try { one.SuccessorNRemove(5); } catch (std::length_error&) { thrown = true; }
+    Check(thrown && one.Size() == 1, "SuccessorNRemove del massimo -> length_error");
+    Check(one.SuccessorNRemove(4) == 5 && one.Empty(), "SuccessorNRemove ultimo elemento");
+
+    std::cout << std::endl;
+}
+
+void TestSetVecCircular() {
+    std::cout << "==== Test SetVec buffer circolare (head mobile) ====" << std::endl;
+
+    // Consumo tipo coda: il minimo esce in O(1), l'head avanza e il buffer si avvolge
+    lasd::SetVec<int> vec;
+    lasd::SetLst<int> lst;
+    bool same = true;
+    int next = 0;
+    for (unsigned long round = 0; round < 200; ++round) {
+        for (unsigned long k = 0; k < 3; ++k, next += 7) {
+            const int val = (next * 31) % 1000;
+            same &= (vec.Insert(val) == lst.Insert(val));
+        }
+        if (round % 3 != 2) same &= (vec.MinNRemove() == lst.MinNRemove());
+        if (round % 5 == 4) same &= (vec.MaxNRemove() == lst.MaxNRemove());
+        if (round % 7 == 6) same &= (vec.Remove(static_cast<int>(round)) == lst.Remove(static_cast<int>(round)));
+    }
+    Check(same && vec.Size() == lst.Size(), "Insert/MinNRemove/MaxNRemove/Remove coerenti con SetLst");
+    bool equalContents = true;
+    for (unsigned long i = 0; i < vec.Size(); ++i) equalContents &= (vec[i] == lst[i]);
+    Check(equalContents, "Contenuto ordinato identico");
+
+    // Buffer avvolto: inserimenti vicino alla testa e alla coda
+    lasd::SetVec<int> ring;
+    for (int i = 0; i < 16; ++i) ring.Insert(i * 10);
+    for (int i = 0; i < 6; ++i) ring.RemoveMin();
+    for (int i = 0; i < 5; ++i) ring.Insert(200 + i);
+    Check(ring.Insert(65) && ring.Insert(145) && ring.Insert(61) && ring.Insert(202) == false, "Insert su buffer avvolto");
+    bool sorted = true;
+    for (unsigned long i = 1; i < ring.Size(); ++i) sorted &= ring[i - 1] < ring[i];
+    Check(sorted && ring.Size() == 18 && ring.Min() == 60 && ring.Max() == 204, "Ordine su buffer avvolto");
+    Check(ring.Predecessor(65) == 61 && ring.Successor(150) == 200 && ring.Exists(145), "Ricerche su buffer avvolto");
+
+    // Operazioni di blocco su buffer avvolto
+    lasd::SetVec<int> other(std::vector<int>{60, 65, 100, 150, 201, 300});
+    Check(ring.Intersection(other).Size() == 5 && ring.Union(other).Size() == 19, "Algebra su buffer avvolto");
+    Check(ring.Difference(other).Size() == 13 && ring.SymmetricDifference(other).Size() == 14, "Differenze su buffer avvolto");
+    lasd::SetVec<int> copy(ring);
+    Check(copy == ring && copy.RangeRemove(61, 100) == 5 && copy.Min() == 60 && copy.Successor(60) == 100, "RangeRemove vicino alla testa");
+    Check(copy.RangeRemove(145, 203) == 5 && copy.Max() == 204 && copy.Predecessor(203) == 140, "RangeRemove vicino alla coda");
+    lasd::Vector<int> batch(20);
+    for (unsigned long i = 0; i < 20; ++i) batch[i] = static_cast<int>(i * 10 + 5);
+    Check(!ring.InsertAll(batch) && ring.Size() == 36 && ring.Min() == 5, "InsertAll su buffer avvolto");
+    Check(ring.RemoveAll(batch) && ring.Size() == 16 && !ring.Exists(65), "RemoveAll su buffer avvolto");
+
+    std::cout << std::endl;
+}
+
+void TestSetVecSegments() {
+    std::cout << "==== Test SetVec capacita' potenza di 2 e visite sui segmenti ====" << std::endl;
+
+    // Buffer avvolto: [head, fine) + [0, resto)
+    lasd::SetVec<int> ring;
+    for (int i = 0; i < 12; ++i) ring.Insert(i);
+    for (int i = 0; i < 5; ++i) ring.RemoveMin();
+    for (int i = 12; i < 17; ++i) ring.Insert(i);
+
+    std::string pre, post;
+    ring.PreOrderTraverse([&pre](const int& x) { pre += std::to_string(x) + " "; });
+    ring.PostOrderTraverse([&post](const int& x) { post += std::to_string(x) + " "; });
+    Check(pre == "5 6 7 8 9 10 11 12 13 14 15 16 ", "PreOrderTraverse su due segmenti");
+    Check(post == "16 15 14 13 12 11 10 9 8 7 6 5 ", "PostOrderTraverse su due segmenti");
+    Check(ring.Fold<int>([](const int& x, const int& acc) { return acc + x; }, 0) == 126, "Fold su due segmenti");
+
+    bool all = true;
+    for (int i = 5; i < 17; ++i) all &= ring.Exists(i);
+    Check(all && !ring.Exists(4) && !ring.Exists(17), "Exists su entrambi i segmenti");
+    Check(ring.LowerBound(11) == 11 && ring.UpperBound(11) == 12 && ring.Predecessor(12) == 11, "Ricerche al confine dei segmenti");
+
+    // Stesso contenuto, disposizione diversa
+    lasd::SetVec<int> flat(std::vector<int>{5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16});
+    Check(ring == flat && flat == ring, "operator== tra buffer avvolto e contiguo");
+    flat.Remove(16);
+    flat.Insert(17);
+    Check(ring != flat, "operator!= sull'ultimo elemento");
+
+    // Resize arrotonda la capacita' e accetta 0 su insieme vuoto
+    lasd::SetVec<int> resized(ring);
+    resized.Resize(100);
+    Check(resized == ring && resized.Insert(50) && resized.Max() == 50, "Resize mantiene il contenuto");
+    lasd::SetVec<int> empty;
+    empty.Resize(0);
+    Check(empty.Empty() && empty.Insert(1) && empty.Size() == 1, "Resize(0) su insieme vuoto");
+
+    std::cout << std::endl;
+}
+
+void TestSetVecSearchIndex() {
+    std::cout << "==== Test SetVec indice di ricerca (layout Eytzinger) ====" << std::endl;
+
+    lasd::SetVec<int> vec;
+    vec.EnableSearchIndex();
+    Check(vec.SearchIndexEnabled() && !vec.Exists(0), "Indice su insieme vuoto");
+
+    // Interrogazioni alternate a modifiche: l'indice va ricostruito ogni volta
+    lasd::SetLst<int> lst;
+    unsigned long seed = 777;
+    bool same = true;
+    for (unsigned long round = 0; round < 60; ++round) {
+        for (unsigned long k = 0; k < 5; ++k) {
+            seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+            const int val = static_cast<int>((seed >> 33) % 500);
+            vec.Insert(val);
+            lst.Insert(val);
+        }
+        if (round % 4 == 3) same &= (vec.MinNRemove() == lst.MinNRemove());
+        if (round % 6 == 5) same &= (vec.Remove(static_cast<int>(round * 7)) == lst.Remove(static_cast<int>(round * 7)));
+        for (int probe = -1; probe <= 501; probe += 3) {
+            same &= (vec.Exists(probe) == lst.Exists(probe));
+            if (!lst.Empty() && probe > lst.Min()) same &= (vec.Predecessor(probe) == lst.Predecessor(probe));
+            if (!lst.Empty() && probe < lst.Max()) same &= (vec.Successor(probe) == lst.Successor(probe));
+        }
+    }
+    Check(same, "Exists/Predecessor/Successor con indice coerenti con SetLst");
+
+    Check(vec.RangeCount(100, 200) == lst.RangeCount(100, 200), "RangeCount con indice");
+    vec.RangeRemove(100, 200);
+    lst.RangeRemove(100, 200);
+    Check(!vec.Exists(150) && vec.Successor(99) == lst.Successor(99), "Indice invalidato da RangeRemove");
+
+    lasd::Vector<int> batch(40);
+    for (unsigned long i = 0; i < 40; ++i) batch[i] = static_cast<int>(1000 + i);
+    vec.InsertAll(batch);
+    Check(vec.Exists(1039) && vec.Max() == 1039 && vec.Successor(1000) == 1001, "Indice invalidato da InsertAll");
+    vec.RemoveAll(batch);
+    Check(!vec.Exists(1020), "Indice invalidato da RemoveAll");
+
+    // Copia e spostamento portano con se' la modalita'
+    lasd::SetVec<int> copy(vec);
+    Check(copy.SearchIndexEnabled() && copy == vec && copy.Exists(vec.Max()), "Copia con indice");
+    lasd::SetVec<int> moved(std::move(copy));
+    Check(moved.SearchIndexEnabled() && moved.Exists(vec.Min()), "Spostamento con indice");
+    vec.Clear();
+    Check(!vec.Exists(moved.Min()) && vec.Insert(5) && vec.Exists(5), "Indice invalidato da Clear");
+
+    moved.EnableSearchIndex(false);
+    Check(!moved.SearchIndexEnabled() && moved.Exists(moved.Max()), "Disattivazione dell'indice");
+
+    lasd::SetVec<std::string> words(std::vector<std::string>{"delta", "alfa", "charlie", "bravo"});
+    words.EnableSearchIndex();
+    Check(words.Exists("charlie") && words.Predecessor("c") == "bravo" && words.Successor("charlie") == "delta", "Indice su stringhe");
+
+    std::cout << std::endl;
+}
+
+void TestSetLstSkipIndex() {
+    std::cout << "==== Test SetLst indice sparso e finger ====" << std::endl;
+
+    // Stessa sequenza su SetLst e SetVec: inserimenti, rimozioni singole, a
+    // intervalli e dagli estremi, con interrogazioni in mezzo
+    lasd::SetLst<int> lst;
+    lasd::SetVec<int> vec;
+    unsigned long seed = 4242;
+    bool same = true;
+    for (unsigned long round = 0; round < 200; ++round) {
+        for (unsigned long k = 0; k < 20; ++k) {
+            seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+            const int val = static_cast<int>((seed >> 33) % 5000);
+            same &= (lst.Insert(val) == vec.Insert(val));
+        }
+        for (unsigned long k = 0; k < 8; ++k) {
+            seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+            const int val = static_cast<int>((seed >> 33) % 5000);
+            same &= (lst.Remove(val) == vec.Remove(val));
+        }
+        if (round % 10 == 9) same &= (lst.RangeRemove(static_cast<int>(round * 20), static_cast<int>(round * 20 + 60)) == vec.RangeRemove(static_cast<int>(round * 20), static_cast<int>(round * 20 + 60)));
+        if (round % 7 == 6) same &= (lst.MinNRemove() == vec.MinNRemove() && lst.MaxNRemove() == vec.MaxNRemove());
+        for (int probe = -1; probe <= 5001; probe += 97) {
+            same &= (lst.Exists(probe) == vec.Exists(probe));
+            if (probe > vec.Min()) same &= (lst.Predecessor(probe) == vec.Predecessor(probe));
+            if (probe < vec.Max()) same &= (lst.Successor(probe) == vec.Successor(probe));
+        }
+        same &= (lst.Size() == vec.Size() && lst.Min() == vec.Min() && lst.Max() == vec.Max());
+    }
+    Check(same && lst.Size() > 1000, "Operazioni miste coerenti con SetVec");
+
+    bool ordered = true;
+    unsigned long i = 0;
+    for (const int& dat : lst) ordered &= (dat == vec[i++]);
+    Check(ordered && i == vec.Size(), "Lista ancora ordinata");
+
+    // Inserimenti crescenti: partono dalla coda o dal finger
+    lasd::SetLst<int> ascending;
+    bool inserted = true;
+    for (int v = 0; v < 3000; v += 3) inserted &= ascending.Insert(v);
+    for (int v = 1; v < 3000; v += 3) inserted &= ascending.Insert(v);
+    Check(inserted && ascending.Size() == 2000 && ascending.Min() == 0 && ascending.Max() == 2998, "Inserimenti crescenti");
+    Check(ascending.Successor(1) == 3 && ascending.Predecessor(3) == 1 && !ascending.Exists(2), "Successor/Predecessor con finger");
+
+    ascending.Resize(100);
+    Check(ascending.Size() == 100 && ascending.Max() == 148 && !ascending.Exists(2998) && ascending.Insert(2998), "Resize azzera l'indice");
+    lasd::SetLst<int> moved(std::move(ascending));
+    Check(ascending.Empty() && !ascending.Exists(0) && ascending.Insert(7) && ascending.Exists(7), "Spostamento azzera l'indice dell'origine");
+    Check(moved.Exists(0) && moved.Exists(2998) && moved.Size() == 101, "Spostamento");
+    moved.Clear();
+    Check(!moved.Exists(0) && moved.Insert(1) && moved.Min() == 1, "Clear azzera l'indice");
+
+    std::cout << std::endl;
+}
+
+void TestSnapshot() {
+    std::cout << "==== Test Snapshot di SetVec e Vector ====" << std::endl;
+
+    // Le versioni vecchie restano intatte mentre l'insieme cambia
+    lasd::SetVec<int> set;
+    for (int v = 0; v < 2000; v += 2) set.Insert(v);
+    lasd::SnapshotView<int> first = set.Snapshot();
+    set.Insert(1);
+    set.Remove(1000);
+    set.RemoveMin();
+    set.RangeRemove(1500, 1600);
+    lasd::SnapshotView<int> second = set.Snapshot();
+    Check(first.Size() == 1000 && first.Front() == 0 && first.Exists(1000) && !first.Exists(1), "La prima versione non cambia");
+    Check(second.Size() == set.Size() && second.Exists(1) && !second.Exists(1000) && !second.Exists(0) && !second.Exists(1550), "La seconda vede le modifiche");
+    Check(second == set && second.Sorted(), "Snapshot uguale all'insieme");
+
+    bool ascending = true;
+    int prev = -1;
+    first.Traverse([&ascending, &prev](const int& dat) { ascending &= (prev < dat); prev = dat; });
+    bool descending = true;
+    unsigned long count = 0;
+    first.PostOrderTraverse([&descending, &prev, &count](const int& dat) { descending &= (count == 0 || dat < prev); prev = dat; ++count; });
+    Check(ascending && descending && prev == 0 && count == first.Size(), "Visite di una versione");
+
+    // Copie e spostamenti condividono i blocchi
+    lasd::SnapshotView<int> copy(second);
+    lasd::SnapshotView<int> moved(std::move(copy));
+    Check(moved == second && copy.Empty(), "Copia e spostamento di uno snapshot");
+    try {
+        (void)second[second.Size()];
+        Check(false, "Accesso fuori dai limiti");
+    } catch (const std::out_of_range&) {
+        Check(true, "Accesso fuori dai limiti");
+    }
+
+    // Vector: scritture da operator[], Map, Resize e iteratori
+    lasd::Vector<int> vec(600);
+    for (unsigned long i = 0; i < vec.Size(); ++i) vec[i] = static_cast<int>(i);
+    lasd::SnapshotView<int> before = vec.Snapshot();
+    vec[599] = -1;
+    vec.Resize(700);
+    *(vec.begin() + 10) = -2;
+    lasd::SnapshotView<int> after = vec.Snapshot();
+    vec.Map([](int& dat) { dat = 0; });
+    lasd::SnapshotView<int> zeros = vec.Snapshot();
+    Check(before.Size() == 600 && before[599] == 599 && before[10] == 10, "La prima versione del Vector non cambia");
+    Check(after.Size() == 700 && after[599] == -1 && after[10] == -2 && after[650] == 0 && after[300] == 300, "La seconda vede le modifiche");
+    Check(zeros == vec && before[300] == 300, "Map marca tutti i blocchi");
+
+    // Sort e HeapVec::Sort scrivono sul buffer: la versione successiva deve vederlo
+    lasd::SortableVector<int> sortable(600);
+    for (unsigned long i = 0; i < sortable.Size(); ++i) sortable[i] = static_cast<int>(600 - i);
+    lasd::SnapshotView<int> unsorted = sortable.Snapshot();
+    sortable.Sort();
+    lasd::SnapshotView<int> sorted = sortable.Snapshot();
+    Check(unsorted[0] == 600 && sorted == sortable && sorted[0] == 1 && sorted[599] == 600, "Snapshot dopo SortableVector::Sort");
+    lasd::HeapVec<int> heap(sortable);
+    lasd::SnapshotView<int> heaped = heap.Snapshot();
+    heap.Sort();
+    lasd::SnapshotView<int> heapSorted = heap.Snapshot();
+    Check(heaped[0] == 600 && heapSorted[0] == 1 && heapSorted[599] == 600 && heapSorted == heap, "Snapshot dopo HeapVec::Sort");
+
+    // Un writer continua a inserire mentre due lettori leggono l'ultima versione pubblicata
+    lasd::SetVec<int> shared;
+    std::mutex publish;
+    std::shared_ptr<const lasd::SnapshotView<int>> latest = std::make_shared<const lasd::SnapshotView<int>>(shared.Snapshot());
+    std::atomic<bool> done{false};
+    std::atomic<bool> consistent{true};
+    std::thread writer([&shared, &publish, &latest, &done] {
+        for (int i = 0; i < 20000; ++i) {
+            shared.Insert((i * 7919) % 20011);
+            if (i % 3 == 0) shared.Remove((i * 31) % 20011);
+            if (i % 64 == 0) {
+                std::shared_ptr<const lasd::SnapshotView<int>> next = std::make_shared<const lasd::SnapshotView<int>>(shared.Snapshot());
+                std::lock_guard<std::mutex> lock(publish);
+                latest.swap(next);
+            }
+        }
+        done = true;
+    });
+    auto reader = [&publish, &latest, &done, &consistent] {
+        while (!done) {
+            std::shared_ptr<const lasd::SnapshotView<int>> view;
+            {
+                std::lock_guard<std::mutex> lock(publish);
+                view = latest;
+            }
+            unsigned long seen = 0;
+            int last = -1;
+            view->Traverse([&seen, &last, &consistent](const int& dat) {
+                if (!(last < dat)) consistent = false;
+                last = dat;
+                ++seen;
+            });
+            if (seen != view->Size()) consistent = false;
+        }
+    };
+    std::thread first_reader(reader);
+    std::thread second_reader(reader);
+    writer.join();
+    first_reader.join();
+    second_reader.join();
+    Check(consistent && shared.Snapshot() == shared, "Lettori concorrenti vedono versioni ordinate e complete");
+
+    std::cout << std::endl;
+}
+
+void TestExistsBatch() {
+    std::cout << "==== Test ExistsBatch ====" << std::endl;
+
+    // Sonde in ordine sparso, con ripetizioni e valori assenti
+    lasd::Vector<int> probes(300);
+    for (unsigned long i = 0; i < 300; ++i)
+        probes[i] = static_cast<int>((i * 53) % 250) - 20;
+
+    lasd::SetVec<int> vec;
+    lasd::SetLst<int> lst;
+    lasd::SetAVL<int> avl;
+    for (int v = 0; v < 200; v += 3) {
+        vec.Insert(v);
+        lst.Insert(v);
+        avl.Insert(v);
+    }
+    vec.RemoveMin(); // La testa del buffer circolare si sposta
+    vec.Insert(0);
+
+    auto agrees = [&probes](const lasd::Set<int>& set) {
+        lasd::Vector<bool> found(7); // Ridimensionato dalla chiamata
+        unsigned long hits = set.ExistsBatch(probes, found);
+        unsigned long expected = 0;
+        bool same = (found.Size() == probes.Size());
+        for (unsigned long i = 0; same && i < probes.Size(); ++i) {
+            same &= (found[i] == set.Exists(probes[i]));
+            expected += found[i];
+        }
+        return same && hits == expected && hits > 0;
+    };
+    Check(agrees(vec), "SetVec: ricerche binarie intercalate");
+    Check(agrees(lst), "SetLst: sonde ordinate e un solo passaggio");
+    Check(agrees(avl), "SetAVL: implementazione di default");
+
+    lasd::List<int> few;
+    few.InsertAtBack(199);
+    few.InsertAtBack(198);
+    few.InsertAtBack(-3);
+    lasd::Vector<bool> found;
+    Check(vec.ExistsBatch(few, found) == 1 && found.Size() == 3 && !found[0] && found[1] && !found[2], "SetVec: gruppo incompleto");
+    Check(lst.ExistsBatch(few, found) == 1 && !found[0] && found[1] && !found[2], "SetLst: sonde da una lista");
+
+    lasd::SetVec<int> emptyVec;
+    lasd::SetLst<int> emptyLst;
+    Check(emptyVec.ExistsBatch(probes, found) == 0 && found.Size() == 300 && !found[0], "SetVec vuoto");
+    Check(emptyLst.ExistsBatch(probes, found) == 0 && !found[299], "SetLst vuoto");
+    Check(vec.ExistsBatch(lasd::Vector<int>(), found) == 0 && found.Empty(), "Nessuna sonda");
+
+    // Lista abbastanza lunga da usare l'indice sparso durante il passaggio
+    lasd::SetLst<std::string> words;
+    lasd::Vector<std::string> queries(500);
+    for (unsigned long i = 0; i < 1000; ++i) words.Insert(std::string("w") + std::to_string(i * 2));
+    for (unsigned long i = 0; i < 500; ++i) queries[i] = std::string("w") + std::to_string((i * 7919) % 2000);
+    bool same = (words.ExistsBatch(queries, found) == 250);
+    for (unsigned long i = 0; i < 500; ++i) same &= (found[i] == words.Exists(queries[i]));
+    Check(same, "SetLst<string> con indice sparso");
+
+    std::cout << std::endl;
+}
+
 void RunAllTests1() {
 
     TestResetCounter();
@@ -2362,6 +3251,22 @@ void RunAllTests1() {
     TestSetVecDouble();
     TestSetVecString();
 
+    TestIteratorsAndRanges();
+    TestFlatContainers();
+    TestViews();
+    TestFoldInPlace();
+    TestSetVecBulkInsert();
+    TestSetVecBulkRemove();
+    TestSetAlgebra();
+    TestRangeQueries();
+    TestSetVecNeighbours();
+    TestSetVecCircular();
+    TestSetVecSegments();
+    TestSetVecSearchIndex();
+    TestSetLstSkipIndex();
+    TestSnapshot();
+    TestExistsBatch();
+
     std::cout << "== RISULTATI TOTALI ES1 ==" << std::endl;
     std::cout << "Totale test eseguiti: " << totalTests << std::endl;
     std::cout << "Test falliti:         " << failedTests << std::endl;
@@ -3191,6 +4096,54 @@ void TestPQHeapString() {
     std::cout << std::endl;
 }
 
+void TestHeapIteratorsAndRanges() {
+    std::cout << "==== Test Iteratori e Range su HeapVec / PQHeap ====" << std::endl;
+
+    static_assert(std::ranges::contiguous_range<lasd::HeapVec<int>>);
+    static_assert(std::ranges::contiguous_range<lasd::PQHeap<int>>);
+
+    std::vector<int> src = {3, 9, 1, 7, 5};
+
+    lasd::HeapVec<int> heap(src);
+    Check(heap.Size() == 5 && heap.IsHeap(), "HeapVec da std::vector");
+    Check(std::ranges::is_heap(heap), "HeapVec std::ranges::is_heap");
+    Check(*std::ranges::max_element(heap) == heap[0], "HeapVec massimo in testa");
+
+    lasd::PQHeap<int> pq(std::views::iota(1, 6));
+    Check(pq.Size() == 5 && pq.Tip() == 5, "PQHeap da views::iota");
+    pq.Insert(42);
+    pq.RemoveTip();
+    Check(std::ranges::distance(pq) == 5, "PQHeap iteratori seguono la size logica");
+    Check(std::accumulate(pq.begin(), pq.end(), 0) == 15, "PQHeap accumulate");
+
+    std::cout << std::endl;
+}
+
+void TestFlatHeapVec() {
+    std::cout << "==== Test FlatHeapVec ====" << std::endl;
+
+    static_assert(!std::is_polymorphic_v<lasd::FlatHeapVec<int>>);
+
+    lasd::FlatHeapVec<int> heap(std::vector<int>{10, 5, 20, 15, 2});
+    Check(heap.Size() == 5 && heap.IsHeap() && heap[0] == 20, "FlatHeapVec da range");
+
+    heap.Sort();
+    Check(!heap.IsHeap() && heap[0] == 2 && heap[4] == 20, "FlatHeapVec Sort");
+
+    heap.Heapify();
+    Check(heap.IsHeap(), "FlatHeapVec Heapify");
+
+    lasd::Vector<int> vec(3);
+    vec[0] = 1; vec[1] = 3; vec[2] = 2;
+    lasd::FlatHeapVec<int> heap2(vec);
+    Check(heap2.Front() == 3 && heap2.Exists(2), "FlatHeapVec da TraversableContainer");
+
+    lasd::FlatHeapVec<int> moved(std::move(heap2));
+    Check(moved.Size() == 3 && heap2.Size() == 0, "FlatHeapVec move constructor");
+
+    std::cout << std::endl;
+}
+
 void RunAllTests2() {
 
     TestResetCounter();
@@ -3205,12 +4158,895 @@ void RunAllTests2() {
     TestPQHeapDouble();
     TestPQHeapString();
 
+    TestHeapIteratorsAndRanges();
+    TestFlatHeapVec();
+
     std::cout << "== RISULTATI TOTALI ES2 ==" << std::endl;
     std::cout << "Totale test eseguiti: " << totalTests << std::endl;
     std::cout << "Test falliti:         " << failedTests << std::endl;
     std::cout << std::endl;
 }
 
+/* ************************************************************************** */
+
+void TestSetAVLInt() {
+    std::cout << "==== Test SetAVL<int> ====" << std::endl;
+
+    lasd::SetAVL<int> avl;
+    Check(avl.Empty() && avl.Size() == 0 && !avl.Exists(0), "SetAVL vuoto");
+    bool thrown = false;
+    try { avl.Min(); } catch (std::length_error&) { thrown = true; }
+    Check(thrown, "Min su vuoto -> length_error");
+    thrown = false;
+    try { avl[0]; } catch (std::out_of_range&) { thrown = true; }
+    Check(thrown, "operator[] su vuoto -> out_of_range");
+
+    Check(avl.Insert(5) && avl.Insert(1) && avl.Insert(9) && !avl.Insert(5), "Insert e duplicati");
+    Check(avl.Size() == 3 && avl.Min() == 1 && avl.Max() == 9, "Min / Max");
+    Check(avl[0] == 1 && avl[1] == 5 && avl[2] == 9, "operator[] per rango");
+    Check(avl.Predecessor(5) == 1 && avl.Successor(5) == 9 && avl.Successor(6) == 9, "Predecessor / Successor");
+    thrown = false;
+    try { avl.Predecessor(1); } catch (std::length_error&) { thrown = true; }
+    Check(thrown, "Predecessor del minimo -> length_error");
+
+    // Inserimenti crescenti: le rotazioni devono tenere l'albero bilanciato e i ranghi corretti
+    for (int i = 10; i < 1000; ++i) avl.Insert(i);
+    bool ranks = true;
+    for (unsigned long i = 3; i < avl.Size(); ++i) ranks &= (avl[i] == static_cast<int>(i + 7));
+    Check(avl.Size() == 993 && ranks, "Select dopo inserimenti ordinati");
+
+    std::string order;
+    lasd::SetAVL<int> small(std::vector<int>{4, 2, 8, 6});
+    small.PreOrderTraverse([&order](const int& x) { order += std::to_string(x) + " "; });
+    small.PostOrderTraverse([&order](const int& x) { order += std::to_string(x) + " "; });
+    Check(order == "2 4 6 8 8 6 4 2 ", "Traverse crescente e decrescente");
+    Check(small.Fold<int>([](const int& x, const int& acc) { return acc + x; }, 0) == 20, "Fold");
+
+    Check(std::ranges::is_sorted(avl) && std::ranges::distance(avl) == 993, "Iteratori ad accesso casuale");
+    Check(*std::ranges::lower_bound(avl, 500) == 500 && avl.end() - avl.begin() == 993, "Algoritmi standard sugli iteratori");
+
+    // Rimozioni su tutti i casi (foglia, un figlio, due figli) e dal pool riciclato
+    Check(avl.Remove(500) && !avl.Exists(500) && !avl.Remove(500), "Remove");
+    Check(avl.MinNRemove() == 1 && avl.MaxNRemove() == 999, "MinNRemove / MaxNRemove");
+    avl.RemovePredecessor(10);
+    avl.RemoveSuccessor(997);
+    Check(!avl.Exists(9) && !avl.Exists(998) && avl.Size() == 988, "RemovePredecessor / RemoveSuccessor");
+    Check(avl.PredecessorNRemove(11) == 10 && avl.SuccessorNRemove(996) == 997, "PredecessorNRemove / SuccessorNRemove");
+    for (int i = 0; i < 1000; i += 2) avl.Remove(i);
+    bool odd = true;
+    avl.Traverse([&odd](const int& x) { odd &= (x % 2 != 0); });
+    Check(odd && avl.Size() == 494 && avl[0] == 5 && avl[493] == 995, "Rimozioni in massa");
+
+    // Confronto con SetLst su un carico misto casuale
+    lasd::SetLst<int> lst;
+    lasd::SetAVL<int> mixed;
+    unsigned long seed = 42;
+    bool same = true;
+    for (unsigned long step = 0; step < 3000; ++step) {
+        seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+        const int val = static_cast<int>((seed >> 33) % 400);
+        if ((seed >> 20) % 3 != 0) {
+            same &= (mixed.Insert(val) == lst.Insert(val));
+        } else {
+            same &= (mixed.Remove(val) == lst.Remove(val));
+        }
+    }
+    same &= (mixed.Size() == lst.Size());
+    for (unsigned long i = 0; same && i < lst.Size(); ++i) same &= (mixed[i] == lst[i]);
+    Check(same, "Carico misto coerente con SetLst");
+    Check(mixed == lst && lst == mixed, "Confronto con LinearContainer");
+
+    std::cout << std::endl;
+}
+
+void TestSetAVLCopyMove() {
+    std::cout << "==== Test SetAVL copia, spostamento, Resize ====" << std::endl;
+
+    lasd::Vector<int> values(100);
+    for (unsigned long i = 0; i < 100; ++i) values[i] = static_cast<int>((i * 37) % 100);
+    lasd::SetAVL<int> avl(values);
+    Check(avl.Size() == 100 && avl.Min() == 0 && avl.Max() == 99, "Costruttore da TraversableContainer");
+
+    lasd::SetAVL<int> copy(avl);
+    Check(copy == avl && copy[42] == 42, "Costruttore di copia");
+    copy.Remove(42);
+    Check(avl.Exists(42) && copy != avl, "Copia indipendente");
+
+    lasd::SetAVL<int> moved(std::move(copy));
+    Check(moved.Size() == 99 && copy.Size() == 0 && copy.Insert(1), "Costruttore di spostamento");
+
+    lasd::SetAVL<int> assigned;
+    assigned = avl;
+    Check(assigned == avl, "Assegnamento di copia");
+    assigned = std::move(moved);
+    Check(assigned.Size() == 99 && !assigned.Exists(42), "Assegnamento di spostamento");
+
+    lasd::List<int> source;
+    for (int i = 0; i < 10; ++i) source.InsertAtBack(i);
+    lasd::SetAVL<int> fromMove(std::move(source));
+    Check(fromMove.Size() == 10 && fromMove.Max() == 9, "Costruttore da MappableContainer");
+
+    avl.Resize(30);
+    Check(avl.Size() == 30 && avl.Max() == 29 && avl.Min() == 0, "Resize rimuove i massimi");
+    avl.Resize(50);
+    Check(avl.Size() == 30, "Resize non aggiunge elementi");
+    avl.Clear();
+    Check(avl.Empty() && avl.Insert(7) && avl.Min() == 7 && avl.Size() == 1, "Clear e riuso");
+
+    lasd::SetAVL<std::string> words(std::vector<std::string>{"delta", "alfa", "charlie", "bravo"});
+    Check(words[0] == "alfa" && words[3] == "delta" && words.Successor("b") == "bravo", "SetAVL<string>");
+    words.InsertAll(std::vector<std::string>{"echo", "alfa"});
+    Check(words.Size() == 5 && words.Max() == "echo", "InsertAll su SetAVL<string>");
+
+    std::cout << std::endl;
+}
+
+void TestSetAVLRangeQueries() {
+    std::cout << "==== Test SetAVL range query ====" << std::endl;
+
+    lasd::Vector<int> fives(20);
+    for (unsigned long i = 0; i < 20; ++i) fives[i] = static_cast<int>(5 * (19 - i));
+    lasd::SetAVL<int> avl(fives);
+    TestRangeQueries(avl, "SetAVL");
+
+    std::cout << std::endl;
+}
+
+void TestSetBTreeInt() {
+    std::cout << "==== Test SetBTree<int> ====" << std::endl;
+
+    lasd::SetBTree<int> tree;
+    Check(tree.Empty() && !tree.Exists(0) && tree.begin() == tree.end(), "SetBTree vuoto");
+    bool thrown = false;
+    try { tree.Max(); } catch (std::length_error&) { thrown = true; }
+    Check(thrown, "Max su vuoto -> length_error");
+
+    // Abbastanza valori da avere piu' livelli interni: split di foglie e di nodi interni
+    for (int i = 0; i < 20000; ++i) tree.Insert((i * 7919) % 20000);
+    Check(tree.Size() == 20000 && tree.Min() == 0 && tree.Max() == 19999 && !tree.Insert(123), "Insert con split");
+    bool ranks = true;
+    for (unsigned long i = 0; i < 20000; i += 97) ranks &= (tree[i] == static_cast<int>(i));
+    Check(ranks && tree[19999] == 19999, "operator[] per rango");
+    Check(tree.Predecessor(500) == 499 && tree.Successor(500) == 501, "Predecessor / Successor");
+
+    long sum = 0;
+    tree.Traverse([&sum](const int& x) { sum += x; });
+    Check(sum == 19999L * 20000 / 2, "Traverse lungo le foglie");
+    std::string tail;
+    tree.PostOrderTraverse([&tail](const int& x) { if (x >= 19997) tail += std::to_string(x) + " "; });
+    Check(tail == "19999 19998 19997 ", "PostOrderTraverse decrescente");
+    Check(std::ranges::is_sorted(tree) && std::ranges::distance(tree) == 20000, "Iteratori bidirezionali");
+    Check(*std::prev(tree.end()) == 19999 && *std::ranges::lower_bound(tree, 777) == 777, "Iteratori e algoritmi standard");
+
+    // Rimozioni che forzano prestiti e fusioni fino a svuotare l'albero
+    for (int i = 0; i < 20000; i += 2) tree.Remove(i);
+    bool odd = true;
+    tree.Traverse([&odd](const int& x) { odd &= (x % 2 != 0); });
+    Check(odd && tree.Size() == 10000 && tree[0] == 1 && tree[9999] == 19999, "Rimozioni con fusioni");
+    Check(tree.MinNRemove() == 1 && tree.MaxNRemove() == 19999, "MinNRemove / MaxNRemove");
+    Check(tree.PredecessorNRemove(100) == 99 && tree.SuccessorNRemove(100) == 101, "PredecessorNRemove / SuccessorNRemove");
+    for (int i = 0; i < 20000; ++i) tree.Remove(i);
+    Check(tree.Empty() && tree.Insert(42) && tree.Min() == 42 && tree.Max() == 42, "Svuotamento e riuso");
+
+    // Confronto con SetLst su un carico misto casuale
+    lasd::SetLst<int> lst;
+    lasd::SetBTree<int> mixed;
+    unsigned long seed = 4242;
+    bool same = true;
+    for (unsigned long step = 0; step < 6000; ++step) {
+        seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+        const int val = static_cast<int>((seed >> 33) % 700);
+        if ((seed >> 20) % 3 != 0) {
+            same &= (mixed.Insert(val) == lst.Insert(val));
+        } else {
+            same &= (mixed.Remove(val) == lst.Remove(val));
+        }
+    }
+    Check(same && mixed == lst && lst == mixed, "Carico misto coerente con SetLst");
+
+    std::cout << std::endl;
+}
+
+void TestSetBTreeBulk() {
+    std::cout << "==== Test SetBTree caricamento in blocco ====" << std::endl;
+
+    lasd::Vector<int> values(5000);
+    for (unsigned long i = 0; i < 5000; ++i) values[i] = static_cast<int>((i * 37) % 2500);
+    lasd::SetBTree<int> tree(values);
+    Check(tree.Size() == 2500 && tree.Min() == 0 && tree.Max() == 2499 && tree[1234] == 1234, "Costruttore da TraversableContainer");
+
+    lasd::Vector<int> more(3000);
+    for (unsigned long i = 0; i < 3000; ++i) more[i] = static_cast<int>(2000 + i);
+    Check(!tree.InsertAll(more) && tree.Size() == 5000 && tree.Max() == 4999, "InsertAll con fusione");
+    Check(tree.InsertSome(more) == false && tree.InsertSome(std::vector<int>{-1, 0}) && tree.Min() == -1, "InsertSome");
+    Check(tree.InsertAll(std::vector<int>{6000, 6001}) && tree.Size() == 5003, "InsertAll piccolo");
+
+    lasd::SetBTree<int> copy(tree);
+    Check(copy == tree && copy.RangeCount(0, 5000) == 5000, "Costruttore di copia");
+    copy.Remove(2500);
+    Check(copy != tree && tree.Exists(2500), "Copia indipendente");
+    lasd::SetBTree<int> moved(std::move(copy));
+    Check(moved.Size() == 5002 && copy.Empty() && copy.Insert(1), "Costruttore di spostamento");
+
+    lasd::SetBTree<int> assigned;
+    assigned = tree;
+    Check(assigned == tree, "Assegnamento di copia");
+    assigned = std::move(moved);
+    Check(assigned.Size() == 5002 && !assigned.Exists(2500), "Assegnamento di spostamento");
+
+    tree.Resize(100);
+    Check(tree.Size() == 100 && tree.Max() == 98, "Resize rimuove i massimi");
+    tree.Clear();
+    Check(tree.Empty() && tree.Insert(7) && tree.Size() == 1, "Clear e riuso");
+
+    lasd::SetBTree<std::string> words(std::vector<std::string>{"delta", "alfa", "charlie", "bravo", "alfa"});
+    Check(words.Size() == 4 && words[0] == "alfa" && words[3] == "delta" && words.Successor("b") == "bravo", "SetBTree<string>");
+    for (int i = 0; i < 300; ++i) words.Insert(std::string("k") + std::to_string(1000 + i));
+    for (int i = 0; i < 300; i += 3) words.Remove(std::string("k") + std::to_string(1000 + i));
+    Check(words.Size() == 204 && words.Max() == "k1299" && words.Predecessor("k1003") == "k1002", "SetBTree<string> con molti livelli");
+
+    lasd::Vector<int> fives(20);
+    for (unsigned long i = 0; i < 20; ++i) fives[i] = static_cast<int>(5 * (19 - i));
+    lasd::SetBTree<int> ranged(fives);
+    TestRangeQueries(ranged, "SetBTree");
+
+    std::cout << std::endl;
+}
+
+// Hash volutamente pessimo: tutte le chiavi finiscono in poche sequenze di scansione
+struct CollidingHash {
+    std::size_t operator()(int val) const noexcept { return static_cast<std::size_t>(val % 3); }
+};
+
+void TestSetHashInt() {
+    std::cout << "==== Test SetHash<int> ====" << std::endl;
+
+    lasd::SetHash<int> hash;
+    Check(hash.Empty() && !hash.Exists(0) && !hash.Remove(0) && hash.begin() == hash.end(), "SetHash vuoto");
+    Check(hash.Insert(5) && hash.Insert(-5) && !hash.Insert(5) && hash.Size() == 2, "Insert e duplicati");
+    Check(hash.Exists(5) && hash.Exists(-5) && !hash.Exists(0), "Exists");
+
+    // Crescita attraverso piu' rehash
+    for (int i = 0; i < 10000; ++i) hash.Insert(i * 3);
+    bool all = true;
+    for (int i = 0; i < 10000; ++i) all &= hash.Exists(i * 3) && !hash.Exists(i * 3 + 1);
+    Check(all && hash.Size() == 10002, "Rehash preserva il contenuto");
+
+    // Rimozioni senza tombstone: le sequenze di scansione restano corrette
+    for (int i = 0; i < 10000; i += 2) hash.Remove(i * 3);
+    all = true;
+    for (int i = 0; i < 10000; ++i) all &= (hash.Exists(i * 3) == (i % 2 == 1));
+    Check(all && hash.Size() == 5002 && hash.Exists(-5), "Remove con spostamento all'indietro");
+
+    long sum = 0;
+    unsigned long visited = 0;
+    hash.Traverse([&sum, &visited](const int& x) { sum += x; ++visited; });
+    long expected = 0; // -5 e 5
+    for (int i = 1; i < 10000; i += 2) expected += i * 3;
+    Check(visited == 5002 && sum == expected, "Traverse visita ogni valore una volta");
+    Check(std::ranges::distance(hash) == 5002 && std::ranges::count(hash, 3) == 1, "Iteratori e algoritmi standard");
+
+    // Hash con moltissime collisioni
+    lasd::SetHash<int, CollidingHash> bad;
+    for (int i = 0; i < 500; ++i) bad.Insert(i);
+    for (int i = 0; i < 500; i += 5) bad.Remove(i);
+    all = true;
+    for (int i = 0; i < 500; ++i) all &= (bad.Exists(i) == (i % 5 != 0));
+    Check(all && bad.Size() == 400, "Hash personalizzato con collisioni");
+
+    // Chiavi distanti 128: con l'hash identita' hanno gli stessi 7 bit bassi,
+    // quindi il byte di controllo deve venire da altri bit
+    lasd::SetHash<int> strided;
+    for (int i = 0; i < 20000; ++i) strided.Insert(i * 128);
+    for (int i = 0; i < 20000; i += 3) strided.Remove(i * 128);
+    all = true;
+    for (int i = 0; i < 20000; ++i) all &= (strided.Exists(i * 128) == (i % 3 != 0)) && !strided.Exists(i * 128 + 64);
+    Check(all && strided.Size() == 13333, "Chiavi con passo 128 attraverso i rehash");
+
+    // Confronto con SetLst su un carico misto casuale
+    lasd::SetLst<int> lst;
+    lasd::SetHash<int> mixed;
+    unsigned long seed = 99;
+    bool same = true;
+    for (unsigned long step = 0; step < 6000; ++step) {
+        seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+        const int val = static_cast<int>((seed >> 33) % 700);
+        if ((seed >> 20) % 3 != 0) {
+            same &= (mixed.Insert(val) == lst.Insert(val));
+        } else {
+            same &= (mixed.Remove(val) == lst.Remove(val));
+        }
+    }
+    same &= (mixed.Size() == lst.Size());
+    lst.Traverse([&mixed, &same](const int& x) { same &= mixed.Exists(x); });
+    Check(same, "Carico misto coerente con SetLst");
+
+    std::cout << std::endl;
+}
+
+void TestSetHashCopyMove() {
+    std::cout << "==== Test SetHash copia, spostamento, stringhe ====" << std::endl;
+
+    lasd::Vector<int> values(100);
+    for (unsigned long i = 0; i < 100; ++i) values[i] = static_cast<int>(i % 40);
+    lasd::SetHash<int> hash(values);
+    Check(hash.Size() == 40 && hash.Exists(39) && !hash.Exists(40), "Costruttore da TraversableContainer");
+
+    lasd::SetHash<int> copy(hash);
+    Check(copy == hash && copy.Remove(7) && copy != hash && hash.Exists(7), "Costruttore di copia indipendente");
+    lasd::SetHash<int> moved(std::move(copy));
+    Check(moved.Size() == 39 && copy.Empty() && copy.Insert(1) && copy.Exists(1), "Costruttore di spostamento");
+
+    lasd::SetHash<int> assigned;
+    assigned = hash;
+    Check(assigned == hash, "Assegnamento di copia");
+    assigned = std::move(moved);
+    Check(assigned.Size() == 39 && !assigned.Exists(7), "Assegnamento di spostamento");
+
+    lasd::SetHash<int> reordered;
+    for (int i = 39; i >= 0; --i) reordered.Insert(i);
+    Check(reordered == hash, "Uguaglianza indipendente dall'ordine");
+
+    hash.Clear();
+    Check(hash.Empty() && !hash.Exists(3) && hash.Insert(3) && hash.Size() == 1, "Clear e riuso");
+    hash.Reserve(1000);
+    Check(hash.Exists(3) && hash.Size() == 1, "Reserve preserva il contenuto");
+
+    lasd::SetHash<std::string> words(std::vector<std::string>{"delta", "alfa", "charlie", "bravo", "alfa"});
+    Check(words.Size() == 4 && words.Exists("charlie") && !words.Exists("echo"), "SetHash<string>");
+    Check(words.InsertAll(std::vector<std::string>{"echo", "foxtrot"}) && !words.InsertAll(std::vector<std::string>{"golf", "alfa"}), "InsertAll su SetHash<string>");
+    Check(words.Remove("alfa") && !words.Exists("alfa") && words.Size() == 6, "Remove su SetHash<string>");
+
+    lasd::List<std::string> source;
+    source.InsertAtBack("uno");
+    source.InsertAtBack("due");
+    lasd::SetHash<std::string> fromMove(std::move(source));
+    Check(fromMove.Size() == 2 && fromMove.Exists("due"), "Costruttore da MappableContainer");
+
+    std::cout << std::endl;
+}
+
+void TestConcurrentSetSkip() {
+    std::cout << "==== Test ConcurrentSetSkip ====" << std::endl;
+
+    lasd::ConcurrentSetSkip<int> skip;
+    Check(skip.Empty() && !skip.Exists(1), "Costruttore di default");
+    bool thrown = false;
+    try { skip.Min(); } catch (std::length_error&) { thrown = true; }
+    Check(thrown, "Min su insieme vuoto lancia length_error");
+
+    bool inserted = true;
+    for (int i = 0; i < 200; ++i) inserted &= skip.Insert((i * 37) % 200);
+    Check(inserted && skip.Size() == 200 && !skip.Insert(50), "Insert e duplicati");
+    Check(skip.Min() == 0 && skip.Max() == 199, "Min e Max");
+    Check(skip.Remove(100) && !skip.Remove(100) && !skip.Exists(100), "Remove");
+    Check(skip.Predecessor(101) == 99 && skip.Successor(99) == 101, "Predecessor e Successor saltano l'elemento rimosso");
+
+    thrown = false;
+    try { skip.Predecessor(0); } catch (std::length_error&) { thrown = true; }
+    Check(thrown, "Predecessor del minimo lancia length_error");
+    thrown = false;
+    try { skip.Successor(199); } catch (std::length_error&) { thrown = true; }
+    Check(thrown, "Successor del massimo lancia length_error");
+
+    int last = -1;
+    bool sorted = true;
+    unsigned long visited = 0;
+    skip.Traverse([&](const int& dat) { sorted &= dat > last; last = dat; ++visited; });
+    Check(sorted && visited == 199, "Traverse in ordine crescente");
+
+    skip.Clear();
+    Check(skip.Empty() && skip.Insert(5) && skip.Min() == 5, "Clear e riuso");
+
+    // Each thread inserts its own residue class and removes half of it, while all
+    // of them compete on a shared block of values
+    lasd::ConcurrentSetSkip<int> shared;
+    const int threads = 4;
+    const int perThread = 2000;
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&shared, t]() {
+            for (int i = 0; i < perThread; ++i) {
+                shared.Insert(i * threads + t);
+                shared.Insert(-1 - (i % 100));
+                shared.Exists(i);
+            }
+            for (int i = 0; i < perThread; i += 2) shared.Remove(i * threads + t);
+        });
+    }
+    for (std::thread& worker : workers) worker.join();
+
+    bool exact = true;
+    for (int v = 0; v < threads * perThread; ++v) exact &= shared.Exists(v) == ((v / threads) % 2 == 1);
+    Check(exact && shared.Size() == threads * perThread / 2 + 100, "Insert e Remove concorrenti");
+    Check(shared.Min() == -100 && shared.Max() == threads * perThread - 1, "Min e Max dopo l'uso concorrente");
+
+    // Inserters and removers contend on a few values, so nodes get removed
+    // while their upper levels are still being linked
+    lasd::ConcurrentSetSkip<int> churn;
+    std::vector<std::thread> churners;
+    for (int t = 0; t < threads; ++t) {
+        churners.emplace_back([&churn, t]() {
+            for (int i = 0; i < perThread * 5; ++i) {
+                if ((i + t) % 2 == 0) churn.Insert(i % 8);
+                else churn.Remove(i % 8);
+            }
+        });
+    }
+    for (std::thread& churner : churners) churner.join();
+    unsigned long live = 0;
+    for (int v = 0; v < 8; ++v) live += churn.Exists(v) ? 1 : 0;
+    Check(churn.Size() == live, "Insert e Remove concorrenti sugli stessi valori");
+
+    lasd::ConcurrentSetSkip<std::string> words;
+    words.Insert("delta");
+    words.Insert("alfa");
+    words.Insert("charlie");
+    Check(words.Min() == "alfa" && words.Successor("alfa") == "charlie" && words.Max() == "delta", "ConcurrentSetSkip<string>");
+
+    std::cout << std::endl;
+}
+
+void TestShardedDictionary() {
+    std::cout << "==== Test ShardedDictionary ====" << std::endl;
+
+    lasd::ShardedDictionary<int, lasd::SetVec<int>> sharded(6);
+    Check(sharded.Shards() == 8 && sharded.Empty() && sharded.Size() == 0, "Costruttore (shard arrotondati a potenza di 2)");
+    Check(sharded.Insert(3) && !sharded.Insert(3) && sharded.Exists(3) && !sharded.Exists(4), "Insert ed Exists");
+    Check(sharded.Remove(3) && !sharded.Remove(3) && sharded.Empty(), "Remove");
+
+    lasd::Vector<int> values(1000);
+    for (unsigned long i = 0; i < 1000; ++i) values[i] = static_cast<int>(i);
+    Check(sharded.InsertAll(values) && sharded.Size() == 1000, "InsertAll ripartito per shard");
+    Check(!sharded.InsertAll(values) && !sharded.InsertSome(values), "InsertAll/InsertSome senza nuovi valori");
+
+    lasd::Vector<int> evens(500);
+    for (unsigned long i = 0; i < 500; ++i) evens[i] = static_cast<int>(2 * i);
+    Check(sharded.RemoveAll(evens) && sharded.Size() == 500 && !sharded.Exists(10) && sharded.Exists(11), "RemoveAll ripartito per shard");
+    Check(sharded.RemoveSome(values) && sharded.Empty() && !sharded.RemoveSome(values), "RemoveSome");
+
+    Check(sharded.InsertAll(std::vector<int>{5, 1, 9}) && sharded.InsertSome(std::vector<int>{9, 7}) && sharded.Size() == 4, "InsertAll/InsertSome da range");
+    long sum = 0;
+    sharded.Traverse([&sum](const int& dat) { sum += dat; });
+    Check(sum == 22, "Traverse visita tutti gli shard");
+    sharded.Clear();
+    Check(sharded.Empty() && sharded.Insert(1), "Clear");
+
+    lasd::List<std::string> words;
+    words.InsertAtBack("alfa");
+    words.InsertAtBack("bravo");
+    words.InsertAtBack("alfa");
+    lasd::ShardedDictionary<std::string, lasd::SetLst<std::string>> strings(std::move(words), 4);
+    Check(strings.Size() == 2 && strings.Exists("bravo") && !strings.Exists("charlie"), "ShardedDictionary<string, SetLst> da MappableContainer");
+
+    // The shard must not come from the bits SetHash uses for its home slot,
+    // or every table would crowd its values into a fraction of its slots
+    lasd::ShardedDictionary<int, lasd::SetHash<int>> hashed(8);
+    const int hashedCount = 1 << 18;
+    bool inserted = true;
+    for (int v = 0; v < hashedCount; ++v) inserted &= hashed.Insert(v);
+    bool found = true;
+    for (int v = 0; v < hashedCount; v += 7) found &= hashed.Exists(v) && !hashed.Exists(-1 - v);
+    Check(inserted && found && hashed.Size() == hashedCount, "ShardedDictionary<int, SetHash> con chiavi consecutive");
+
+    // Each thread owns a residue class: it inserts it one value at a time and
+    // removes the first half of it with a single RemoveAll
+    lasd::ShardedDictionary<int, lasd::SetVec<int>> shared;
+    const int threads = 4;
+    const int perThread = 2000;
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&shared, t]() {
+            lasd::Vector<int> half(perThread / 2);
+            for (int i = 0; i < perThread; ++i) {
+                shared.Insert(i * threads + t);
+                if (i < perThread / 2) half[i] = i * threads + t;
+            }
+            shared.RemoveAll(half);
+        });
+    }
+    for (std::thread& worker : workers) worker.join();
+
+    bool exact = true;
+    for (int v = 0; v < threads * perThread; ++v) exact &= shared.Exists(v) == (v >= threads * perThread / 2);
+    Check(exact && shared.Size() == threads * perThread / 2, "Insert e RemoveAll concorrenti");
+
+    std::cout << std::endl;
+}
+
+void TestBloomSet() {
+    std::cout << "==== Test BloomSet ====" << std::endl;
+
+    lasd::BloomSet<int, lasd::SetVec<int>> bloom;
+    Check(bloom.Empty() && !bloom.Exists(1) && !bloom.MayContain(1), "Costruttore di default");
+
+    bool inserted = true;
+    for (int i = 0; i < 4000; i += 2) inserted &= bloom.Insert(i);
+    Check(inserted && bloom.Size() == 2000 && !bloom.Insert(10), "Insert");
+
+    bool noFalseNegatives = true;
+    unsigned long misses = 0;
+    unsigned long falsePositives = 0;
+    for (int i = 0; i < 4000; ++i) {
+        if (i % 2 == 0) {
+            noFalseNegatives &= bloom.MayContain(i) && bloom.Exists(i);
+        } else {
+            ++misses;
+            falsePositives += bloom.MayContain(i);
+            noFalseNegatives &= !bloom.Exists(i);
+        }
+    }
+    Check(noFalseNegatives, "Nessun falso negativo, Exists esatto");
+    Check(falsePositives * 100 < misses, "Falsi positivi sotto l'1%");
+
+    // Rimozioni: il filtro le ignora finche' non viene ricostruito
+    bool removed = true;
+    for (int i = 0; i < 4000; i += 4) removed &= bloom.Remove(i);
+    bool exact = true;
+    for (int i = 0; i < 4000; ++i) exact &= bloom.Exists(i) == (i % 4 == 2);
+    Check(removed && exact && bloom.Size() == 1000, "Remove e ricostruzione pigra");
+
+    lasd::Vector<int> batch(500);
+    for (unsigned long i = 0; i < 500; ++i) batch[i] = static_cast<int>(10000 + i);
+    Check(bloom.InsertAll(batch) && bloom.Exists(10499) && !bloom.Exists(10500), "InsertAll");
+    Check(bloom.RemoveSome(batch) && !bloom.Exists(10000) && bloom.Size() == 1000, "RemoveSome");
+    Check(bloom.Underlying().Min() == 2 && bloom.Underlying().Max() == 3998, "Accesso in lettura al set sottostante");
+
+    lasd::BloomSet<int, lasd::SetVec<int>> copy(bloom);
+    Check(copy == bloom && copy.Remove(2) && !copy.Exists(2) && bloom.Exists(2), "Copia indipendente");
+    lasd::BloomSet<int, lasd::SetVec<int>> moved(std::move(copy));
+    Check(moved.Size() == 999 && copy.Empty() && copy.Insert(1) && copy.Exists(1), "Spostamento");
+
+    bloom.Clear();
+    Check(bloom.Empty() && !bloom.Exists(2) && bloom.Insert(2) && bloom.Exists(2), "Clear");
+
+    lasd::List<std::string> words;
+    words.InsertAtBack("alfa");
+    words.InsertAtBack("bravo");
+    lasd::BloomSet<std::string, lasd::SetLst<std::string>> strings(std::move(words));
+    Check(strings.Size() == 2 && strings.Exists("alfa") && !strings.Exists("charlie"), "BloomSet<string, SetLst>");
+
+    std::cout << std::endl;
+}
+
+void TestOrderedMap() {
+    std::cout << "==== Test OrderedMap ====" << std::endl;
+
+    lasd::OrderedMap<int, std::string> map;
+    Check(map.Empty() && !map.Exists(1), "Costruttore di default");
+    bool thrown = false;
+    try { map.Min(); } catch (std::length_error&) { thrown = true; }
+    Check(thrown, "Min su mappa vuota lancia length_error");
+
+    // Chiavi in ordine sparso: entrambi i lati del buffer circolare vengono spostati
+    bool inserted = true;
+    for (int i = 0; i < 200; ++i) {
+        int key = (i * 37) % 200;
+        inserted &= map.Insert(key, std::to_string(key));
+    }
+    Check(inserted && map.Size() == 200 && !map.Insert(5, "cinque") && map.Find(5) == "5", "Insert (senza sovrascrivere)");
+
+    bool ordered = true;
+    int expected = 0;
+    map.Traverse([&](const int& key, const std::string& val) {
+        ordered &= (key == expected && val == std::to_string(expected));
+        ++expected;
+    });
+    Check(ordered && expected == 200, "Traverse in ordine di chiave, valori allineati");
+
+    Check(map.Min() == 0 && map.Max() == 199 && map.ValueAt(0) == "0" && map.KeyAt(199) == 199, "Min, Max, KeyAt, ValueAt");
+
+    bool removed = true;
+    for (int key = 0; key < 200; key += 2) removed &= map.Remove(key);
+    Check(removed && !map.Remove(0) && map.Size() == 100, "Remove");
+    Check(map.Predecessor(10) == 9 && map.Predecessor(11) == 9 && map.Successor(11) == 13 && map.Successor(10) == 11,
+          "Predecessor e Successor");
+    thrown = false;
+    try { map.Successor(199); } catch (std::length_error&) { thrown = true; }
+    Check(thrown, "Successor del massimo lancia length_error");
+    thrown = false;
+    try { map.Find(4); } catch (std::length_error&) { thrown = true; }
+    Check(thrown, "Find di una chiave assente lancia length_error");
+    thrown = false;
+    try { map.KeyAt(100); } catch (std::out_of_range&) { thrown = true; }
+    Check(thrown, "KeyAt fuori intervallo lancia out_of_range");
+
+    map.Find(7) = "sette";
+    map.Map([](const int& key, std::string& val) { if (key == 9) val = "nove"; });
+    Check(map.Find(7) == "sette" && map.Find(9) == "nove", "Find e Map modificano il valore");
+
+    lasd::OrderedMap<int, std::string> copy(map);
+    Check(copy == map && copy.Remove(7) && copy != map && map.Exists(7), "Copia indipendente");
+    lasd::OrderedMap<int, std::string> moved(std::move(copy));
+    Check(moved.Size() == 99 && copy.Empty() && copy.Insert(1, "uno") && copy.Find(1) == "uno", "Spostamento");
+    copy = map;
+    Check(copy == map, "Assegnamento per copia");
+
+    // Rimozioni fino a vuota: la capacita' si dimezza lungo la strada
+    bool drained = true;
+    while (!map.Empty()) {
+        int key = map.Max();
+        drained &= map.Remove(key) && !map.Exists(key);
+    }
+    Check(drained && map.Insert(3, "tre") && map.Size() == 1, "Svuotamento e reinserimento");
+
+    map.Clear();
+    Check(map.Empty() && !map.Exists(3), "Clear");
+
+    std::cout << std::endl;
+}
+
+void TestSetRoaring() {
+    std::cout << "==== Test SetRoaring ====" << std::endl;
+
+    lasd::SetRoaring<int> set;
+    Check(set.Empty() && !set.Exists(0) && set.MemoryBytes() == 0, "Costruttore di default");
+    bool thrown = false;
+    try { set.Min(); } catch (std::length_error&) { thrown = true; }
+    Check(thrown, "Min su insieme vuoto lancia length_error");
+
+    // Valori negativi e positivi in blocchi diversi, piu' gli estremi di int
+    Check(set.Insert(-70000) && set.Insert(5) && set.Insert(-1) && set.Insert(70000) && !set.Insert(5), "Insert");
+    Check(set.Insert(std::numeric_limits<int>::min()) && set.Insert(std::numeric_limits<int>::max()), "Insert degli estremi");
+    Check(set.Min() == std::numeric_limits<int>::min() && set.Max() == std::numeric_limits<int>::max(), "Min e Max");
+    Check(set.Min() < set.Max() && set.Predecessor(5) < set.Successor(5) && set.LowerBound(0) < set.UpperBound(5) && set.Front() < set.Back(),
+          "Risposte di query diverse confrontabili tra loro");
+    // Le query per riferimento restituiscono lo stesso membro a ogni chiamata;
+    // per confrontare due risposte della stessa query servono le copie
+    Check(&set[0] == &set[2] && &set.Successor(-1) == &set.Successor(5), "operator[] e Successor riusano la propria risposta");
+    Check(set.At(0) < set.At(2) && set.SuccessorValue(-1) < set.SuccessorValue(5) && set.PredecessorValue(5) < set.PredecessorValue(70000)
+          && set.LowerBoundValue(-1) < set.UpperBoundValue(-1), "Query per valore");
+    Check(&set.Front() == &set.Min() && &set.Back() == &set.Max() && set.Front() == set.At(0), "Front e Back senza passare da operator[]");
+    set.RemoveMax();
+    Check(set.Max() == 70000 && set.Remove(std::numeric_limits<int>::min()) && set.Min() == -70000, "Min e Max aggiornati dalle rimozioni");
+    set.Insert(std::numeric_limits<int>::min());
+    set.Insert(std::numeric_limits<int>::max());
+    Check(set.Successor(-1) == 5 && set.Predecessor(5) == -1 && set.Successor(5) == 70000 && set.Predecessor(-1) == -70000,
+          "Predecessor e Successor tra blocchi");
+    std::string seen;
+    set.Traverse([&seen](const int& x) { seen += std::to_string(x) + " "; });
+    Check(seen == "-2147483648 -70000 -1 5 70000 2147483647 ", "Traverse in ordine crescente");
+    Check(set[2] == -1 && set[5] == std::numeric_limits<int>::max(), "operator[] per rango");
+
+    // Un blocco denso passa da array a bitmap e ritorna array svuotandosi
+    set.Clear();
+    bool inserted = true;
+    for (int i = 0; i < 10000; ++i) inserted &= set.Insert(7 * i % 65536);
+    Check(inserted && set.Size() == 10000 && set.Exists(7 * 9999 % 65536) && !set.Exists(1), "Conversione in bitmap");
+    Check(set.MemoryBytes() < 10000 * sizeof(int), "Bitmap piu' piccola dei valori");
+    bool removed = true;
+    for (int i = 0; i < 9990; ++i) removed &= set.Remove(7 * i % 65536);
+    Check(removed && set.Size() == 10 && set.Min() == 7 * 9990 % 65536 && set.MemoryBytes() < 1024, "Riconversione in array");
+
+    // Intervalli contigui: Optimize li salva come sequenze
+    set.Clear();
+    for (int i = -50000; i < 150000; ++i) set.Insert(i);
+    set.Optimize();
+    Check(set.Size() == 200000 && set.MemoryBytes() < 1024, "Sequenze dopo Optimize");
+    Check(set.Remove(1000) && !set.Exists(1000) && set.Successor(999) == 1001 && set.Predecessor(1001) == 999,
+          "Remove spezza una sequenza");
+    Check(set.RangeCount(-50000, 150000) == 199999 && set.RangeRemove(0, 100000) == 99999, "RangeCount e RangeRemove su sequenze");
+    Check(set.Max() == 149999 && set.Predecessor(100000) == -1 && set[50000] == 100000, "Ordine dopo RangeRemove");
+
+    lasd::Vector<int> fives(20);
+    for (unsigned long i = 0; i < 20; ++i) fives[i] = static_cast<int>(5 * (19 - i));
+    lasd::SetRoaring<int> range(fives);
+    TestRangeQueries(range, "SetRoaring");
+
+    // Algebra confrontata con SetVec
+    lasd::SetRoaring<int> evens;
+    lasd::SetRoaring<int> triples;
+    lasd::SetVec<int> evensVec;
+    lasd::SetVec<int> triplesVec;
+    for (int i = -3000; i < 9000; ++i) {
+        if (i % 2 == 0) { evens.Insert(i); evensVec.Insert(i); }
+        if (i % 3 == 0) { triples.Insert(i); triplesVec.Insert(i); }
+    }
+    auto same = [](const lasd::SetRoaring<int>& roaring, const lasd::SetVec<int>& vec) {
+        bool equal = roaring.Size() == vec.Size();
+        for (unsigned long i = 0; equal && i < vec.Size(); ++i) equal = roaring[i] == vec[i];
+        return equal;
+    };
+    Check(same(evens.Union(triples), evensVec.Union(triplesVec)), "Union");
+    Check(same(evens.Intersection(triples), evensVec.Intersection(triplesVec)), "Intersection");
+    Check(same(evens.Difference(triples), evensVec.Difference(triplesVec)), "Difference");
+    Check(same(evens.SymmetricDifference(triples), evensVec.SymmetricDifference(triplesVec)), "SymmetricDifference");
+
+    lasd::SetRoaring<int> copy(evens);
+    Check(copy == evens && copy.Remove(0) && copy != evens && evens.Exists(0), "Copia indipendente");
+    lasd::SetRoaring<int> moved(std::move(copy));
+    Check(moved.Size() == evens.Size() - 1 && copy.Empty(), "Spostamento");
+    copy = evens;
+    copy.Optimize();
+    Check(copy == evens, "Uguaglianza tra rappresentazioni diverse");
+
+    evens.Resize(10);
+    Check(evens.Size() == 10 && evens.Max() == -2982 && evens.Min() == -3000, "Resize rimuove i massimi");
+
+    lasd::SetRoaring<unsigned int> big(std::vector<unsigned int>{4294967295U, 0U, 65536U});
+    Check(big.Size() == 3 && big.Max() == 4294967295U && big.Successor(0U) == 65536U, "SetRoaring<unsigned int>");
+    thrown = false;
+    try { big.Successor(4294967295U); } catch (std::length_error&) { thrown = true; }
+    Check(thrown, "Successor del massimo lancia length_error");
+
+    std::cout << std::endl;
+}
+
+void TestSetVEB() {
+    std::cout << "==== Test SetVEB ====" << std::endl;
+
+    lasd::SetVEB set;
+    Check(set.Empty() && !set.Exists(0U) && set.MemoryBytes() == 0, "Costruttore di default");
+    bool thrown = false;
+    try { set.Successor(0U); } catch (std::length_error&) { thrown = true; }
+    Check(thrown, "Successor su insieme vuoto lancia length_error");
+
+    // Il minimo resta fuori dai cluster: primo inserimento, sostituzione e rimozione
+    Check(set.Insert(1000U) && set.Min() == 1000U && set.Max() == 1000U && !set.Insert(1000U), "Insert del primo valore");
+    Check(set.Insert(5U) && set.Min() == 5U && set.Exists(1000U) && set.Successor(5U) == 1000U, "Nuovo minimo");
+    Check(set.Insert(4294967295U) && set.Insert(65536U) && set.Insert(65535U), "Insert in cluster diversi");
+    Check(set.Predecessor(65536U) == 65535U && set.Successor(65535U) == 65536U && set.Predecessor(1000U) == 5U,
+          "Predecessor e Successor tra cluster");
+    Check(set.Predecessor(4294967295U) == 65536U && set.Successor(4294967294U) == 4294967295U, "Estremi dell'universo");
+    Check(set.Predecessor(65536U) < set.Successor(65535U) && set.LowerBound(6U) < set.UpperBound(65535U), "Risposte di query diverse confrontabili tra loro");
+    Check(&set.Predecessor(65536U) == &set.Predecessor(1000U) && &set.LowerBound(6U) == &set.LowerBound(0U), "Ogni query per riferimento riusa la propria risposta");
+    Check(set.PredecessorValue(1000U) < set.PredecessorValue(65536U) && set.SuccessorValue(5U) < set.SuccessorValue(65535U)
+          && set.LowerBoundValue(1000U) == 1000U && set.UpperBoundValue(1000U) == 65535U, "Query per valore");
+    Check(set.Remove(5U) && set.Min() == 1000U && set.Predecessor(65535U) == 1000U, "Remove del minimo");
+    Check(set.Remove(4294967295U) && set.Max() == 65536U, "Remove del massimo");
+
+    // Foglie piene e vuote dentro un cluster
+    set.Clear();
+    bool inserted = true;
+    for (unsigned int i = 0; i < 3000; ++i) inserted &= set.Insert(7U * i);
+    Check(inserted && set.Size() == 3000 && set.Exists(7U * 2999) && !set.Exists(1U), "Insert di 3000 valori");
+    bool neighbours = true;
+    for (unsigned int x = 1; x < 7U * 2999; x += 13) {
+        neighbours &= set.Successor(x) == (x / 7 + 1) * 7 && set.Predecessor(x) == (x - 1) / 7 * 7;
+    }
+    Check(neighbours, "Predecessor e Successor su tutti i vicini");
+    Check(set.RangeCount(0U, 70U) == 10 && set.RangeCount(7U, 8U) == 1 && set.RangeCount(20000U, 4294967295U) == 142, "RangeCount");
+    std::string seen;
+    set.RangeTraverse(12U, 36U, [&seen](const unsigned int& x) { seen += std::to_string(x) + " "; });
+    Check(seen == "14 21 28 35 ", "RangeTraverse");
+    Check(set.LowerBound(14U) == 14U && set.LowerBound(15U) == 21U && set.UpperBound(14U) == 21U, "LowerBound e UpperBound");
+    Check(set.RangeRemove(10U, 20000U) == 2856 && set.Size() == 144 && set.Successor(7U) == 20006U, "RangeRemove");
+
+    unsigned long count = 0;
+    unsigned int last = 0;
+    bool ordered = true;
+    set.Traverse([&](const unsigned int& x) { ordered &= (count == 0 || last < x); last = x; ++count; });
+    Check(ordered && count == set.Size(), "Traverse in ordine crescente");
+
+    lasd::SetVEB copy(set);
+    Check(copy == set && copy.Remove(20006U) && copy != set && set.Exists(20006U), "Copia indipendente");
+    lasd::SetVEB moved(std::move(copy));
+    Check(moved.Size() == 143 && copy.Empty(), "Spostamento");
+    copy = set;
+    Check(copy == set, "Assegnamento per copia");
+
+    bool drained = true;
+    while (!set.Empty()) {
+        const unsigned int max = set.Max();
+        drained &= set.MaxNRemove() == max && !set.Exists(max);
+    }
+    Check(drained && set.MemoryBytes() == 0, "Svuotamento dal massimo");
+
+    lasd::Vector<unsigned int> values(4);
+    values[0] = 9U; values[1] = 3U; values[2] = 9U; values[3] = 100000U;
+    lasd::SetVEB built(values);
+    Check(built.Size() == 3 && built.Min() == 3U && built.Max() == 100000U, "Costruttore da TraversableContainer");
+
+    std::cout << std::endl;
+}
+
+void TestSetPMA() {
+    std::cout << "==== Test SetPMA ====" << std::endl;
+
+    lasd::SetPMA<int> set;
+    Check(set.Empty() && !set.Exists(0) && set.Capacity() == 0, "Costruttore di default");
+    bool thrown = false;
+    try { set.Min(); } catch (std::length_error&) { thrown = true; }
+    Check(thrown, "Min su insieme vuoto lancia length_error");
+
+    // Inserimenti crescenti: ogni segmento si riempie in coda e la finestra viene ridistribuita
+    bool inserted = true;
+    for (int i = 0; i < 5000; ++i) inserted &= set.Insert(2 * i);
+    Check(inserted && set.Size() == 5000 && !set.Insert(4000), "Insert crescenti");
+    Check(set.Capacity() >= 5000 && set.Capacity() <= 4 * 5000, "Capacita' con spazi liberi");
+    Check(set.Min() == 0 && set.Max() == 9998 && set[1234] == 2468 && set.Exists(9998) && !set.Exists(9999), "Min, Max e operator[]");
+    Check(set.Successor(2467) == 2468 && set.Predecessor(2468) == 2466 && set.LowerBound(2467) == 2468 && set.UpperBound(2468) == 2470,
+          "Predecessor, Successor e limiti");
+
+    // Inserimenti decrescenti e nel mezzo, poi rimozioni che svuotano i segmenti
+    for (int i = 1; i <= 3000; ++i) set.Insert(-i);
+    for (int i = 0; i < 5000; ++i) set.Insert(2 * i + 1);
+    Check(set.Size() == 13000 && set.Min() == -3000 && set[3000] == 0 && set[3001] == 1, "Insert decrescenti e intercalati");
+    bool removed = true;
+    for (int i = -3000; i < 10000; i += 2) removed &= set.Remove(i);
+    Check(removed && set.Size() == 6500 && !set.Remove(0) && set.Min() == -2999 && set.Successor(-1) == 1, "Remove di un valore su due");
+    unsigned long count = 0;
+    int last = 0;
+    bool ordered = true;
+    set.Traverse([&](const int& x) { ordered &= (count == 0 || last < x); last = x; ++count; });
+    Check(ordered && count == set.Size(), "Traverse in ordine crescente");
+    std::string seen;
+    set.RangeTraverse(-6, 4, [&seen](const int& x) { seen += std::to_string(x) + " "; });
+    Check(seen == "-5 -3 -1 1 3 " && set.RangeCount(-6, 4) == 5, "RangeTraverse e RangeCount");
+    Check(set.RangeRemove(0, 9000) == 4500 && set.Size() == 2000 && set.Successor(-1) == 9001, "RangeRemove");
+
+    // Confronto con SetVec su operazioni casuali
+    lasd::SetPMA<int> random;
+    lasd::SetVec<int> reference;
+    unsigned long seed = 12345;
+    bool agree = true;
+    for (int i = 0; i < 20000; ++i) {
+        seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+        const int value = static_cast<int>((seed >> 33) % 4000);
+        if ((seed >> 20) % 3 == 0) {
+            agree &= random.Remove(value) == reference.Remove(value);
+        } else {
+            agree &= random.Insert(value) == reference.Insert(value);
+        }
+    }
+    agree &= random.Size() == reference.Size();
+    for (unsigned long i = 0; agree && i < reference.Size(); ++i) agree &= random[i] == reference[i];
+    Check(agree, "Operazioni casuali come SetVec");
+
+    lasd::SetPMA<int> copy(set);
+    Check(copy == set && copy.Remove(9001) && copy != set && set.Exists(9001), "Copia indipendente");
+    lasd::SetPMA<int> moved(std::move(copy));
+    Check(moved.Size() == 1999 && copy.Empty(), "Spostamento");
+    copy = set;
+    Check(copy == set, "Assegnamento per copia");
+    copy.Resize(10);
+    Check(copy.Size() == 10 && copy.Max() == -2981 && copy.Capacity() < set.Capacity(), "Resize rimuove i valori piu' grandi");
+
+    bool drained = true;
+    while (!set.Empty()) {
+        const int min = set.Min();
+        drained &= set.MinNRemove() == min && !set.Exists(min);
+    }
+    Check(drained && set.Capacity() == 0, "Svuotamento dal minimo");
+
+    lasd::Vector<std::string> words(4);
+    words[0] = "delta"; words[1] = "alfa"; words[2] = "delta"; words[3] = "charlie";
+    lasd::SetPMA<std::string> strings(words);
+    Check(strings.Size() == 3 && strings[0] == "alfa" && strings.Max() == "delta", "Costruttore da TraversableContainer");
+
+    lasd::Vector<int> fives(20);
+    for (unsigned long i = 0; i < 20; ++i) fives[i] = static_cast<int>(5 * (19 - i));
+    lasd::SetPMA<int> range(fives);
+    TestRangeQueries(range, "SetPMA");
+
+    std::cout << std::endl;
+}
+
+void RunAllTests3() {
+
+    TestResetCounter();
+
+    TestSetAVLInt();
+    TestSetAVLCopyMove();
+    TestSetAVLRangeQueries();
+    TestSetBTreeInt();
+    TestSetBTreeBulk();
+    TestSetHashInt();
+    TestSetHashCopyMove();
+    TestBloomSet();
+    TestConcurrentSetSkip();
+    TestShardedDictionary();
+    TestOrderedMap();
+    TestSetRoaring();
+    TestSetVEB();
+    TestSetPMA();
+
+    std::cout << "== RISULTATI TOTALI ES3 ==" << std::endl;
+    std::cout << "Totale test eseguiti: " << totalTests << std::endl;
+    std::cout << "Test falliti:         " << failedTests << std::endl;
+    std::cout << std::endl;
+}
+
 void RunAllTests()
 {
     TestResetCounter();
@@ -3223,9 +5059,15 @@ void RunAllTests()
     TestResetCounter();
     RunAllTests2();
 
+    int testpart2 = totalTests;
+    int testerror2 = failedTests;
+
+    TestResetCounter();
+    RunAllTests3();
+
     std::cout << "== RISULTATI TOTALI ==" << std::endl;
-    std::cout << "Totale test eseguiti: " << totalTests + testpart1 << std::endl;
-    std::cout << "Test falliti:         " << failedTests + testerror1 << std::endl;
+    std::cout << "Totale test eseguiti: " << totalTests + testpart1 + testpart2 << std::endl;
+    std::cout << "Test falliti:         " << failedTests + testerror1 + testerror2 << std::endl;
     std::cout << std::endl;
 
 }
@@ -5,6 +5,7 @@ namespace lasd {
 
 void RunAllTests1();
 void RunAllTests2();
+void RunAllTests3();
 void RunAllTests();
 }
 